@@ -0,0 +1,169 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/benchmark_suite.h"
+#include "benchgen/record_batch_iterator.h"
+#include "harness.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::bench {
+namespace {
+
+// Every table is measured at this scale so results are comparable across
+// releases.
+constexpr double kScaleFactor = 1.0;
+// Rows generated per iteration (or the whole table, if smaller).
+constexpr int64_t kRowsPerIteration = 20000;
+
+internal::RecordBatchWriterFormat FormatFor(SuiteId suite) {
+  switch (suite) {
+    case SuiteId::kTpcds:
+      return internal::RecordBatchWriterFormat::kTpcds;
+    case SuiteId::kSsb:
+      return internal::RecordBatchWriterFormat::kSsb;
+    default:
+      return internal::RecordBatchWriterFormat::kTpch;
+  }
+}
+
+// Builds the iterator for one table on first use and keeps only the most
+// recent one, so generator setup stays out of the timings without holding
+// every table's state at once.
+class IteratorCache {
+ public:
+  arrow::Status Get(SuiteId suite, const std::string& table,
+                    RecordBatchIterator** out) {
+    std::string key = std::string(SuiteIdToString(suite)) + "/" + table;
+    if (key != key_ || !iterator_) {
+      iterator_.reset();
+      auto benchmark_suite = MakeBenchmarkSuite(suite);
+      GeneratorOptions options;
+      options.scale_factor = kScaleFactor;
+      ARROW_RETURN_NOT_OK(
+          benchmark_suite->MakeIterator(table, options, &iterator_));
+      key_ = std::move(key);
+    }
+    *out = iterator_.get();
+    return arrow::Status::OK();
+  }
+
+ private:
+  std::string key_;
+  std::unique_ptr<RecordBatchIterator> iterator_;
+};
+
+IteratorCache& Cache() {
+  static IteratorCache cache;
+  return cache;
+}
+
+void GenerateTable(State& state, SuiteId suite, const std::string& table) {
+  state.PauseTiming();
+  RecordBatchIterator* iterator = nullptr;
+  auto status = Cache().Get(suite, table, &iterator);
+  state.ResumeTiming();
+  if (!status.ok()) {
+    state.SkipWithError(status.ToString());
+    return;
+  }
+  internal::RecordBatchWriter writer(FormatFor(suite));
+  CountingStream out;
+  int64_t rows = 0;
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    status = iterator->Seek(0, kRowsPerIteration);
+    std::shared_ptr<arrow::RecordBatch> batch;
+    while (status.ok()) {
+      status = iterator->Next(&batch);
+      if (!status.ok() || !batch) {
+        break;
+      }
+      rows += batch->num_rows();
+      status = writer.Write(&out, batch);
+    }
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString());
+      return;
+    }
+  }
+  state.SetItemsProcessed(rows);
+  state.SetBytesProcessed(out.bytes());
+}
+
+// Time to re-target an iterator at offset and produce one row there.
+void SeekTo(State& state, SuiteId suite, const std::string& table,
+            int64_t offset) {
+  state.PauseTiming();
+  RecordBatchIterator* iterator = nullptr;
+  auto status = Cache().Get(suite, table, &iterator);
+  state.ResumeTiming();
+  if (!status.ok()) {
+    state.SkipWithError(status.ToString());
+    return;
+  }
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    status = iterator->Seek(offset, 1);
+    if (status.ok()) {
+      status = iterator->Next(&batch);
+    }
+    if (!status.ok() || !batch || batch->num_rows() != 1) {
+      state.SkipWithError(status.ok() ? "no row at offset"
+                                      : status.ToString());
+      return;
+    }
+    DoNotOptimize(batch);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+void RegisterGeneratorBenchmarks() {
+  for (SuiteId suite : {SuiteId::kTpch, SuiteId::kTpcds, SuiteId::kSsb}) {
+    auto benchmark_suite = MakeBenchmarkSuite(suite);
+    const std::string suite_name(SuiteIdToString(suite));
+    for (int i = 0; i < benchmark_suite->table_count(); ++i) {
+      std::string table(benchmark_suite->TableName(i));
+      RegisterBenchmark("generate/" + suite_name + "/" + table,
+                        [suite, table](State& state) {
+                          GenerateTable(state, suite, table);
+                        });
+    }
+  }
+
+  const std::pair<SuiteId, const char*> seek_tables[] = {
+      {SuiteId::kTpch, "lineitem"},       {SuiteId::kTpch, "orders"},
+      {SuiteId::kTpcds, "store_sales"},   {SuiteId::kTpcds, "catalog_sales"},
+      {SuiteId::kTpcds, "inventory"},     {SuiteId::kSsb, "lineorder"},
+  };
+  for (const auto& [suite, table] : seek_tables) {
+    for (int64_t offset : {int64_t{0}, int64_t{1000}, int64_t{100000},
+                           int64_t{1000000}}) {
+      std::string name = "seek/" + std::string(SuiteIdToString(suite)) + "/" +
+                         table + "/" + std::to_string(offset);
+      std::string table_name = table;
+      RegisterBenchmark(name, [suite, table_name, offset](State& state) {
+        SeekTo(state, suite, table_name, offset);
+      });
+    }
+  }
+}
+
+}  // namespace benchgen::bench
@@ -0,0 +1,257 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "harness.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "util/json.h"
+
+namespace benchgen::bench {
+namespace {
+
+struct Registered {
+  std::string name;
+  BenchmarkFn fn;
+};
+
+std::vector<Registered>& Registry() {
+  static std::vector<Registered> registry;
+  return registry;
+}
+
+struct Result {
+  std::string name;
+  int64_t iterations = 0;
+  double seconds = 0.0;
+  int64_t items = 0;
+  int64_t bytes = 0;
+  std::string error;
+};
+
+void PrintUsage(const char* argv0) {
+  std::cerr << "Usage: " << argv0
+            << " [--filter <substring>] [--min-time <seconds>]"
+               " [--output <file.json>] [--list]\n";
+}
+
+std::string CurrentDate() {
+  std::time_t now = std::time(nullptr);
+  char buf[32];
+  std::strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  return buf;
+}
+
+void WriteJson(std::ostream* out, const std::vector<Result>& results) {
+  *out << "{\n  \"context\": {\n    \"date\": ";
+  internal::WriteJsonString(out, CurrentDate());
+  *out << ",\n    \"library\": \"benchgen\",\n    \"num_cpus\": "
+       << std::thread::hardware_concurrency()
+       << ",\n    \"library_build_type\": "
+#ifdef NDEBUG
+       << "\"release\""
+#else
+       << "\"debug\""
+#endif
+       << "\n  },\n  \"benchmarks\": [";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    *out << (i == 0 ? "\n" : ",\n") << "    {\n      \"name\": ";
+    internal::WriteJsonString(out, result.name);
+    *out << ",\n      \"run_name\": ";
+    internal::WriteJsonString(out, result.name);
+    *out << ",\n      \"run_type\": \"iteration\"";
+    if (!result.error.empty()) {
+      *out << ",\n      \"error_occurred\": true,\n      \"error_message\": ";
+      internal::WriteJsonString(out, result.error);
+    }
+    const double per_iteration_ns =
+        result.iterations > 0 ? result.seconds * 1e9 / result.iterations : 0;
+    char buf[64];
+    *out << ",\n      \"iterations\": " << result.iterations;
+    std::snprintf(buf, sizeof(buf), "%.3f", per_iteration_ns);
+    *out << ",\n      \"real_time\": " << buf << ",\n      \"cpu_time\": "
+         << buf << ",\n      \"time_unit\": \"ns\"";
+    if (result.items > 0 && result.seconds > 0) {
+      std::snprintf(buf, sizeof(buf), "%.1f", result.items / result.seconds);
+      *out << ",\n      \"items_per_second\": " << buf;
+    }
+    if (result.bytes > 0 && result.seconds > 0) {
+      std::snprintf(buf, sizeof(buf), "%.1f", result.bytes / result.seconds);
+      *out << ",\n      \"bytes_per_second\": " << buf;
+    }
+    *out << "\n    }";
+  }
+  *out << (results.empty() ? "]\n" : "\n  ]\n") << "}\n";
+}
+
+}  // namespace
+
+void State::Start() {
+  running_ = true;
+  started_ = Clock::now();
+}
+
+void State::Stop() {
+  if (running_) {
+    elapsed_ += Clock::now() - started_;
+    running_ = false;
+  }
+}
+
+void State::PauseTiming() { Stop(); }
+
+void State::ResumeTiming() {
+  if (!running_) {
+    Start();
+  }
+}
+
+double State::elapsed_seconds() const {
+  return std::chrono::duration<double>(elapsed_).count();
+}
+
+// Grows the iteration count until a run takes at least min_time.
+class Runner {
+ public:
+  explicit Runner(double min_time) : min_time_(min_time) {}
+
+  Result Run(const Registered& benchmark) const {
+    Result result;
+    result.name = benchmark.name;
+    int64_t iterations = 1;
+    while (true) {
+      State state(iterations);
+      state.Start();
+      benchmark.fn(state);
+      state.Stop();
+      const double seconds = state.elapsed_seconds();
+      if (!state.error().empty() || seconds >= min_time_ ||
+          iterations >= kMaxIterations) {
+        result.iterations = iterations;
+        result.seconds = seconds;
+        result.items = state.items();
+        result.bytes = state.bytes();
+        result.error = state.error();
+        return result;
+      }
+      // Aim 40% past min_time, growing at most 10x per round.
+      double multiplier = seconds > 0 ? min_time_ * 1.4 / seconds : 10.0;
+      multiplier = std::min(std::max(multiplier, 2.0), 10.0);
+      iterations = std::min<int64_t>(
+          kMaxIterations, static_cast<int64_t>(iterations * multiplier));
+    }
+  }
+
+ private:
+  static constexpr int64_t kMaxIterations = 1000000000;
+  double min_time_;
+};
+
+void RegisterBenchmark(std::string name, BenchmarkFn fn) {
+  Registry().push_back({std::move(name), std::move(fn)});
+}
+
+int RunBenchmarks(int argc, char** argv) {
+  std::string filter;
+  std::string output;
+  double min_time = 0.5;
+  bool list = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto require_value = [&](const char* name) -> const char* {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << name << "\n";
+        return nullptr;
+      }
+      return argv[++i];
+    };
+    if (arg == "--filter") {
+      const char* value = require_value("--filter");
+      if (!value) return 1;
+      filter = value;
+    } else if (arg == "--min-time") {
+      const char* value = require_value("--min-time");
+      if (!value) return 1;
+      char* end = nullptr;
+      min_time = std::strtod(value, &end);
+      if (end == value || *end != '\0' || min_time < 0) {
+        std::cerr << "Invalid min time: " << value << "\n";
+        return 1;
+      }
+    } else if (arg == "--output" || arg == "-o") {
+      const char* value = require_value("--output");
+      if (!value) return 1;
+      output = value;
+    } else if (arg == "--list") {
+      list = true;
+    } else if (arg == "--help" || arg == "-h") {
+      PrintUsage(argv[0]);
+      return 0;
+    } else {
+      std::cerr << "Unknown argument: " << arg << "\n";
+      PrintUsage(argv[0]);
+      return 1;
+    }
+  }
+
+  Runner runner(min_time);
+  std::vector<Result> results;
+  bool failed = false;
+  for (const Registered& benchmark : Registry()) {
+    if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) {
+      continue;
+    }
+    if (list) {
+      std::cout << benchmark.name << "\n";
+      continue;
+    }
+    Result result = runner.Run(benchmark);
+    std::cerr << result.name << ": " << result.iterations << " iterations";
+    if (!result.error.empty()) {
+      std::cerr << ", error: " << result.error;
+      failed = true;
+    } else if (result.iterations > 0) {
+      std::cerr << ", " << result.seconds * 1e9 / result.iterations
+                << " ns/iteration";
+    }
+    std::cerr << "\n";
+    results.push_back(std::move(result));
+  }
+  if (list) {
+    return 0;
+  }
+
+  if (output.empty()) {
+    WriteJson(&std::cout, results);
+  } else {
+    std::ofstream out(output);
+    if (!out) {
+      std::cerr << "Failed to open output file: " << output << "\n";
+      return 1;
+    }
+    WriteJson(&out, results);
+  }
+  return failed ? 1 : 0;
+}
+
+}  // namespace benchgen::bench
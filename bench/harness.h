@@ -0,0 +1,107 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+namespace benchgen::bench {
+
+// Passed to a benchmark body, which runs its measured work iterations()
+// times. Setup that must not be timed goes before the loop or between
+// PauseTiming()/ResumeTiming().
+class State {
+ public:
+  explicit State(int64_t iterations) : iterations_(iterations) {}
+
+  int64_t iterations() const { return iterations_; }
+
+  void PauseTiming();
+  void ResumeTiming();
+
+  // Totals over all iterations; reported as items/s and bytes/s.
+  void SetItemsProcessed(int64_t items) { items_ = items; }
+  void SetBytesProcessed(int64_t bytes) { bytes_ = bytes; }
+  void SkipWithError(std::string message) { error_ = std::move(message); }
+
+  int64_t items() const { return items_; }
+  int64_t bytes() const { return bytes_; }
+  const std::string& error() const { return error_; }
+  double elapsed_seconds() const;
+
+ private:
+  friend class Runner;
+  void Start();
+  void Stop();
+
+  using Clock = std::chrono::steady_clock;
+  int64_t iterations_;
+  int64_t items_ = 0;
+  int64_t bytes_ = 0;
+  std::string error_;
+  bool running_ = false;
+  Clock::time_point started_;
+  Clock::duration elapsed_{};
+};
+
+using BenchmarkFn = std::function<void(State&)>;
+
+void RegisterBenchmark(std::string name, BenchmarkFn fn);
+
+// Runs the registered benchmarks matching --filter (substring) for at
+// least --min-time seconds each and prints Google Benchmark-compatible
+// JSON to stdout or --output.
+int RunBenchmarks(int argc, char** argv);
+
+// Keeps the compiler from discarding a computed value.
+template <typename T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &value;
+#endif
+}
+
+// Output stream that discards what is written and counts the bytes.
+class CountingStream : private std::streambuf, public std::ostream {
+ public:
+  CountingStream() : std::ostream(static_cast<std::streambuf*>(this)) {}
+
+  int64_t bytes() const { return bytes_; }
+
+ private:
+  std::streambuf::int_type overflow(std::streambuf::int_type ch) override {
+    ++bytes_;
+    return std::streambuf::traits_type::not_eof(ch);
+  }
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    bytes_ += count;
+    return count;
+  }
+
+  int64_t bytes_ = 0;
+};
+
+void RegisterGeneratorBenchmarks();
+void RegisterKernelBenchmarks();
+void RegisterWriterBenchmarks();
+
+}  // namespace benchgen::bench
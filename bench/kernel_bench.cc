@@ -0,0 +1,110 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <string>
+
+#include "distribution/dst_distribution_store.h"
+#include "harness.h"
+#include "utils/columns.h"
+#include "utils/pricing.h"
+#include "utils/random_number_stream.h"
+#include "utils/text.h"
+
+namespace benchgen::bench {
+namespace {
+
+using tpcds::internal::DstDistributionStore;
+using tpcds::internal::RandomNumberStream;
+
+DstDistributionStore& Store() {
+  static DstDistributionStore store;
+  return store;
+}
+
+void NextRandom(State& state) {
+  RandomNumberStream stream(0, 1);
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    DoNotOptimize(stream.NextRandom());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void SkipRows(State& state, int64_t rows) {
+  RandomNumberStream stream(SS_PRICING, 8);
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    stream.SkipRows(rows);
+    DoNotOptimize(stream);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void SetPricing(State& state) {
+  RandomNumberStream stream(SS_PRICING, 8);
+  tpcds::internal::PricingState pricing_state;
+  tpcds::internal::Pricing pricing;
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    tpcds::internal::SetPricing(SS_PRICING, &pricing, &stream,
+                                &pricing_state);
+    DoNotOptimize(pricing);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void GenerateText(State& state) {
+  state.PauseTiming();
+  DstDistributionStore& store = Store();
+  state.ResumeTiming();
+  RandomNumberStream stream(0, 1);
+  int64_t bytes = 0;
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    std::string text = tpcds::internal::GenerateText(20, 100, &store, &stream);
+    bytes += static_cast<int64_t>(text.size());
+    DoNotOptimize(text);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(bytes);
+}
+
+void PickIndex(State& state, const char* distribution) {
+  state.PauseTiming();
+  const auto& dist = Store().Get(distribution);
+  state.ResumeTiming();
+  RandomNumberStream stream(0, 1);
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    DoNotOptimize(dist.PickIndex(1, &stream));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+void RegisterKernelBenchmarks() {
+  RegisterBenchmark("kernel/tpcds/RandomNumberStream::NextRandom", NextRandom);
+  for (int64_t rows : {int64_t{1}, int64_t{1000}, int64_t{1000000}}) {
+    RegisterBenchmark(
+        "kernel/tpcds/RandomNumberStream::SkipRows/" + std::to_string(rows),
+        [rows](State& state) { SkipRows(state, rows); });
+  }
+  RegisterBenchmark("kernel/tpcds/SetPricing", SetPricing);
+  RegisterBenchmark("kernel/tpcds/GenerateText", GenerateText);
+  // A short and a long weighted distribution.
+  for (const char* distribution : {"call_center_hours", "first_names"}) {
+    RegisterBenchmark(
+        std::string("kernel/tpcds/PickIndex/") + distribution,
+        [distribution](State& state) { PickIndex(state, distribution); });
+  }
+}
+
+}  // namespace benchgen::bench
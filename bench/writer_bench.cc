@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "benchgen/arrow_compat.h"
+#include "harness.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::bench {
+namespace {
+
+constexpr int64_t kRows = 10000;
+
+// Deterministic single-column batch of the given type, with every 50th
+// value null.
+arrow::Result<std::shared_ptr<arrow::RecordBatch>> MakeColumn(
+    const std::shared_ptr<arrow::DataType>& type) {
+  std::unique_ptr<arrow::ArrayBuilder> builder;
+  ARROW_RETURN_NOT_OK(
+      arrow::MakeBuilder(arrow::default_memory_pool(), type, &builder));
+  uint64_t state = 0x9e3779b97f4a7c15ULL;
+  for (int64_t row = 0; row < kRows; ++row) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    const int64_t value = static_cast<int64_t>(state >> 33);
+    if (row % 50 == 49) {
+      ARROW_RETURN_NOT_OK(builder->AppendNull());
+      continue;
+    }
+    switch (type->id()) {
+      case arrow::Type::INT32:
+        ARROW_RETURN_NOT_OK(static_cast<arrow::Int32Builder&>(*builder).Append(
+            static_cast<int32_t>(value)));
+        break;
+      case arrow::Type::INT64:
+        ARROW_RETURN_NOT_OK(
+            static_cast<arrow::Int64Builder&>(*builder).Append(value));
+        break;
+      case arrow::Type::DOUBLE:
+        ARROW_RETURN_NOT_OK(static_cast<arrow::DoubleBuilder&>(*builder).Append(
+            static_cast<double>(value) / 1000.0));
+        break;
+      case arrow::Type::DECIMAL128:
+        ARROW_RETURN_NOT_OK(
+            static_cast<arrow::Decimal128Builder&>(*builder).Append(
+                arrow::Decimal128(value % 10000000)));
+        break;
+      case arrow::Type::DATE32:
+        ARROW_RETURN_NOT_OK(static_cast<arrow::Date32Builder&>(*builder).Append(
+            static_cast<int32_t>(value % 20000)));
+        break;
+      case arrow::Type::BOOL:
+        ARROW_RETURN_NOT_OK(
+            static_cast<arrow::BooleanBuilder&>(*builder).Append((value & 1) != 0));
+        break;
+      case arrow::Type::STRING:
+        ARROW_RETURN_NOT_OK(static_cast<arrow::StringBuilder&>(*builder).Append(
+            std::string(static_cast<size_t>(5 + value % 40), 'a' + value % 26)));
+        break;
+      default:
+        return arrow::Status::NotImplemented(type->ToString());
+    }
+  }
+  std::shared_ptr<arrow::Array> array;
+  ARROW_RETURN_NOT_OK(builder->Finish(&array));
+  return arrow::RecordBatch::Make(arrow::schema({arrow::field("c", type)}),
+                                  kRows, {array});
+}
+
+void WriteColumn(State& state, const std::shared_ptr<arrow::DataType>& type) {
+  state.PauseTiming();
+  auto batch = MakeColumn(type);
+  state.ResumeTiming();
+  if (!batch.ok()) {
+    state.SkipWithError(batch.status().ToString());
+    return;
+  }
+  internal::RecordBatchWriter writer(internal::RecordBatchWriterFormat::kTpcds);
+  CountingStream out;
+  for (int64_t i = 0; i < state.iterations(); ++i) {
+    auto status = writer.Write(&out, *batch);
+    if (!status.ok()) {
+      state.SkipWithError(status.ToString());
+      return;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kRows);
+  state.SetBytesProcessed(out.bytes());
+}
+
+}  // namespace
+
+void RegisterWriterBenchmarks() {
+  const std::shared_ptr<arrow::DataType> types[] = {
+      arrow::int32(),  arrow::int64(),          arrow::float64(),
+      arrow::date32(), arrow::decimal128(7, 2), arrow::boolean(),
+      arrow::utf8(),
+  };
+  for (const auto& type : types) {
+    RegisterBenchmark("writer/" + type->ToString(),
+                      [type](State& state) { WriteColumn(state, type); });
+  }
+}
+
+}  // namespace benchgen::bench
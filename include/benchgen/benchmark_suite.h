@@ -37,6 +37,12 @@ class BenchmarkSuite {
       std::string_view table_name, GeneratorOptions options,
       std::unique_ptr<RecordBatchIterator>* out) const = 0;
 
+  virtual arrow::Status TableSchema(
+      std::string_view table_name, const GeneratorOptions& options,
+      std::shared_ptr<arrow::Schema>* out) const {
+    return MakeTableSchema(suite_id(), table_name, options, out);
+  }
+
   virtual arrow::Status ResolveTableRowCount(std::string_view table_name,
                                              const GeneratorOptions& options,
                                              int64_t* out,
@@ -25,11 +25,24 @@ enum class DbgenSeedMode {
   kPerTable,
 };
 
+enum class SampleMode {
+  kNone,
+  // Keeps rows whose table-wide index i satisfies
+  // i % sample_interval == sample_seed % sample_interval.
+  kSystematic,
+  // Keeps each row independently with probability sample_fraction. The
+  // decision is a hash of (sample_seed, table-wide row index).
+  kBernoulli,
+};
+
 struct GeneratorOptions {
   double scale_factor = 1.0;
   int64_t start_row = 0;   // 0-based row index.
   int64_t row_count = -1;  // Negative means "to the end of the table".
   int64_t chunk_size = 4096;
+  // Target RecordBatch size in bytes. When positive, rows per batch are
+  // derived from the estimated row width and chunk_size is ignored.
+  int64_t chunk_bytes = 0;
   // Override distribution files directory; empty uses embedded resources.
   std::string distribution_dir;
   // When set, only these columns are returned (order preserved). Empty means
@@ -38,6 +51,31 @@ struct GeneratorOptions {
   // Controls dbgen seed initialization. kPerTable matches `dbgen -T <table>`,
   // kAllTables matches `dbgen -T a`.
   DbgenSeedMode seed_mode = DbgenSeedMode::kPerTable;
+  // Row sampling within [start_row, start_row + row_count). Unsampled rows
+  // are skipped rather than generated, and decisions depend only on the row
+  // index, so disjoint ranges of one table sample consistently.
+  SampleMode sample_mode = SampleMode::kNone;
+  int64_t sample_interval = 1;
+  double sample_fraction = 1.0;
+  uint64_t sample_seed = 0;
+  // TPC-DS catalog_sales only: restricts the table to the orders sold within
+  // [sold_date_min_sk, sold_date_max_sk] (d_date_sk julian day numbers,
+  // inclusive; negative means unbounded). start_row and row_count are then
+  // relative to the first row of that window.
+  int64_t sold_date_min_sk = -1;
+  int64_t sold_date_max_sk = -1;
+  // When positive, generate update stream refresh_stream's refresh sets
+  // instead of the base tables. TPC-H (what `dbgen -U` writes): "orders"
+  // and "lineitem" return the RF1 insert rows (orders.tbl.u<n>,
+  // lineitem.tbl.u<n>) and the pseudo table "delete" the RF2 order keys
+  // (delete.<n>). TPC-DS: approximate fact table sources for run n
+  // (tpcds::RefreshTableId: s_purchase, s_store_returns, ..., delete). This
+  // output is NOT dsdgen-compatible: it matches neither the bytes nor the
+  // order/line/return layout of `dsdgen -update`, and the dimension sources
+  // (s_customer, s_item, ...) are not generated, so it cannot stand in for
+  // a TPC-DS refresh run.
+  // start_row and row_count are relative to the stream.
+  int32_t refresh_stream = 0;
 };
 
 }  // namespace benchgen
@@ -16,8 +16,10 @@
 
 #include <arrow/status.h>
 
+#include <cstdint>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace arrow {
 class RecordBatch;
@@ -37,6 +39,38 @@ class RecordBatchIterator {
 
   // Sets *out to nullptr when iteration is complete.
   virtual arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) = 0;
+
+  // Re-targets the iterator at the zero-based row range [start_row,
+  // start_row + row_count), with the same meaning as
+  // GeneratorOptions::start_row/row_count (row_count < 0 means "to the end").
+  // Distributions, permutations and other immutable state are kept, so this
+  // only costs the skip to start_row. Seek(0, -1) rewinds to the beginning.
+  virtual arrow::Status Seek(int64_t start_row, int64_t row_count) = 0;
+};
+
+// Generates several tables of a suite in one pass, for tables whose rows
+// dbgen draws together (TPC-H part and partsupp). Rows, start_row and
+// row_count count rows of driving_table() (TPC-H: part, in either table
+// order); every Next returns the rows the other tables derive from that
+// batch.
+class MultiRecordBatchIterator {
+ public:
+  virtual ~MultiRecordBatchIterator() = default;
+
+  virtual std::string_view suite_name() const = 0;
+  virtual int table_count() const = 0;
+  virtual std::string_view name(int table) const = 0;
+  virtual std::shared_ptr<arrow::Schema> schema(int table) const = 0;
+  // Index of the table whose rows start_row and row_count count.
+  virtual int driving_table() const = 0;
+
+  // Sets *out to one batch per table, in table order, or clears it when
+  // iteration is complete.
+  virtual arrow::Status Next(
+      std::vector<std::shared_ptr<arrow::RecordBatch>>* out) = 0;
+
+  // Same as RecordBatchIterator::Seek, in rows of driving_table().
+  virtual arrow::Status Seek(int64_t start_row, int64_t row_count) = 0;
 };
 
 }  // namespace benchgen
@@ -17,8 +17,10 @@
 #include <arrow/status.h>
 
 #include <memory>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "benchgen/generator_options.h"
 #include "benchgen/record_batch_iterator.h"
@@ -37,4 +39,17 @@ arrow::Status MakeRecordBatchIterator(
     SuiteId suite, std::string_view table_name, GeneratorOptions options,
     std::unique_ptr<RecordBatchIterator>* out);
 
+// The schema MakeRecordBatchIterator's iterator would have (column_names
+// applied), without any data dependent work: no distributions, row counts
+// or RNG replay, so it is cheap at any scale factor.
+arrow::Status MakeTableSchema(SuiteId suite, std::string_view table_name,
+                              GeneratorOptions options,
+                              std::shared_ptr<arrow::Schema>* out);
+
+// Co-generates table_names in one pass. Supported: TPC-H {part, partsupp},
+// in either order. options.column_names must be empty.
+arrow::Status MakeMultiRecordBatchIterator(
+    SuiteId suite, const std::vector<std::string>& table_names,
+    GeneratorOptions options, std::unique_ptr<MultiRecordBatchIterator>* out);
+
 }  // namespace benchgen
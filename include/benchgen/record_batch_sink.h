@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <arrow/status.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace arrow {
+class RecordBatch;
+class Schema;
+}  // namespace arrow
+
+namespace benchgen {
+
+// Destination for generated batches. Write is called in generation order;
+// Close flushes anything still buffered and must be called before the
+// output is considered complete.
+class RecordBatchSink {
+ public:
+  virtual ~RecordBatchSink() = default;
+
+  virtual arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) = 0;
+  virtual arrow::Status Close() = 0;
+};
+
+// Writes batches to path in the suite's text format (.tbl for TPC-H and
+// SSB, .dat for TPC-DS), as the gen_table tool does.
+arrow::Status MakeTextFileSink(SuiteId suite, const std::string& path,
+                               std::unique_ptr<RecordBatchSink>* out);
+
+// Writes batches of schema to path as an Arrow IPC file.
+arrow::Status MakeArrowIpcFileSink(const std::string& path,
+                                   const std::shared_ptr<arrow::Schema>& schema,
+                                   std::unique_ptr<RecordBatchSink>* out);
+
+// Hands every batch to each of sinks, which write on their own threads with
+// at most queue_depth batches queued. Write blocks while any queue is full
+// and returns the first sink error; Close closes every sink and returns the
+// first error.
+std::unique_ptr<RecordBatchSink> MakeFanOutSink(
+    std::vector<std::unique_ptr<RecordBatchSink>> sinks, int64_t queue_depth);
+
+}  // namespace benchgen
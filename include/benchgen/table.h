@@ -70,6 +70,29 @@ enum class TableId {
 std::string_view TableIdToString(TableId table);
 bool TableIdFromString(std::string_view name, TableId* out);
 
+// Approximate fact table sources, only generated when
+// GeneratorOptions::refresh_stream is set. The names match the files
+// `dsdgen -update` writes but the contents are not dsdgen-compatible, and
+// the dimension sources (s_customer, s_item, ...) are not generated.
+enum class RefreshTableId {
+  kSPurchase = 0,
+  kSPurchaseLineitem,
+  kSCatalogOrder,
+  kSCatalogOrderLineitem,
+  kSWebOrder,
+  kSWebOrderLineitem,
+  kSStoreReturns,
+  kSCatalogReturns,
+  kSWebReturns,
+  kSInventory,
+  kDelete,
+  kInventoryDelete,
+  kTableCount
+};
+
+std::string_view RefreshTableIdToString(RefreshTableId table);
+bool RefreshTableIdFromString(std::string_view name, RefreshTableId* out);
+
 }  // namespace tpcds
 
 namespace ssb {
@@ -80,6 +103,7 @@ enum class TableId {
   kSupplier,
   kDate,
   kLineorder,
+  kLineorderFlat,
   kTableCount
 };
 
@@ -0,0 +1,362 @@
+#!/usr/bin/env python3
+# Copyright 2021-present StarRocks, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Throughput regression check for benchgen.
+
+Runs a fixed matrix (each suite's largest tables, every requested scale,
+serial and --parallel) through the benchgen CLI with --stats, and compares
+the throughput against a stored JSON baseline. Two throughputs are taken
+from every run:
+
+  text   rows / wall seconds for the whole run, i.e. generating, rendering
+         the .tbl/.dat text and writing it to disk;
+  arrow  rows / seconds spent producing Arrow record batches (iterator
+         creation plus every Next() call, slowest worker), i.e. what a C++
+         API consumer pays before any text formatting.
+
+Optionally the official dbgen/dsdgen binaries (the same ones
+validate_scale10_parallel.sh uses) are timed on the serial cells to report
+benchgen's speed relative to them.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+DEFAULT_TABLES = [
+    ("tpch", "lineitem"),
+    ("tpch", "orders"),
+    ("tpcds", "store_sales"),
+    ("tpcds", "catalog_sales"),
+    ("ssb", "lineorder"),
+]
+
+METRICS = ("text_rows_per_second", "arrow_rows_per_second")
+
+EXTENSIONS = {"tpch": ".tbl", "tpcds": ".dat", "ssb": ".tbl"}
+
+TPCH_TABLE_CODES = {
+    "customer": "c",
+    "supplier": "s",
+    "nation": "n",
+    "region": "r",
+    "part": "P",
+    "partsupp": "S",
+    "orders": "O",
+    "lineitem": "L",
+}
+
+SSB_TABLE_CODES = {
+    "customer": "c",
+    "part": "p",
+    "supplier": "s",
+    "date": "d",
+    "lineorder": "l",
+}
+
+
+def parse_tables(value):
+    tables = []
+    for item in value.split(","):
+        item = item.strip()
+        if not item:
+            continue
+        suite, sep, table = item.partition(":")
+        if not sep or suite not in EXTENSIONS or not table:
+            raise argparse.ArgumentTypeError(
+                "expected <suite>:<table>[,...], got {!r}".format(item)
+            )
+        tables.append((suite, table))
+    return tables
+
+
+def cell_key(suite, table, scale, parallel):
+    mode = "serial" if parallel == 1 else "parallel{}".format(parallel)
+    return "{}/{}/sf{}/{}".format(suite, table, scale, mode)
+
+
+def run_benchgen(args, suite, table, scale, parallel, work_dir):
+    output = os.path.join(work_dir, table + EXTENSIONS[suite])
+    stats_path = os.path.join(work_dir, "stats.json")
+    command = [
+        args.benchgen,
+        "--benchmark", suite,
+        "--table", table,
+        "--scale", str(scale),
+        "--output", output,
+        "--stats", stats_path,
+    ]
+    if parallel > 1:
+        command += ["--parallel", str(parallel)]
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+    with open(stats_path, "r") as handle:
+        stats = json.load(handle)
+
+    arrow_seconds = 0.0
+    for worker in stats["workers"]:
+        startup = worker["startup"]
+        seconds = (
+            startup["make_iterator_seconds"]
+            + startup["first_batch_seconds"]
+            + worker["phases"]["generate_seconds"]
+        )
+        arrow_seconds = max(arrow_seconds, seconds)
+    rows = stats["rows"]
+    wall = stats["wall_seconds"]
+    return {
+        "rows": rows,
+        "bytes": stats["bytes"],
+        "seconds": wall,
+        "text_rows_per_second": rows / wall if wall > 0 else 0.0,
+        "arrow_rows_per_second": rows / arrow_seconds if arrow_seconds > 0 else 0.0,
+    }
+
+
+def official_command(args, suite, table, scale, work_dir):
+    """Returns (command, env) for the official generator, or None."""
+    env = dict(os.environ)
+    if suite == "tpch" and args.tpch_dbgen and table in TPCH_TABLE_CODES:
+        env["DSS_PATH"] = work_dir
+        env["DSS_CONFIG"] = os.path.dirname(args.tpch_dbgen)
+        return [args.tpch_dbgen, "-s", str(scale), "-T", TPCH_TABLE_CODES[table], "-f"], env
+    if suite == "ssb" and args.ssb_dbgen and table in SSB_TABLE_CODES:
+        env["DSS_PATH"] = work_dir
+        env["DSS_CONFIG"] = os.path.dirname(args.ssb_dbgen)
+        return [args.ssb_dbgen, "-s", str(scale), "-T", SSB_TABLE_CODES[table], "-f"], env
+    if suite == "tpcds" and args.tpcds_dsdgen:
+        dists = os.path.join(os.path.dirname(args.tpcds_dsdgen), "tpcds.idx")
+        return [
+            args.tpcds_dsdgen,
+            "-SCALE", str(scale),
+            "-TABLE", table,
+            "-DIR", work_dir,
+            "-DISTRIBUTIONS", dists,
+            "-FORCE", "Y",
+        ], env
+    return None
+
+
+def time_official(args, suite, table, scale, work_dir):
+    spec = official_command(args, suite, table, scale, work_dir)
+    if spec is None:
+        return None
+    command, env = spec
+    # The official generators write relative to their own directory.
+    cwd = os.path.dirname(command[0]) or None
+    started = time.monotonic()
+    subprocess.run(command, check=True, cwd=cwd, env=env,
+                   stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    return time.monotonic() - started
+
+
+def best_of(results):
+    best = dict(results[0])
+    for metric in METRICS:
+        best[metric] = max(result[metric] for result in results)
+    best["seconds"] = min(result["seconds"] for result in results)
+    return best
+
+
+def run_matrix(args):
+    results = {}
+    for scale in args.scales:
+        for suite, table in args.tables:
+            for parallel in sorted({1, args.parallel}):
+                key = cell_key(suite, table, scale, parallel)
+                runs = []
+                for _ in range(args.repeat):
+                    work_dir = tempfile.mkdtemp(prefix="run-", dir=args.work_dir)
+                    try:
+                        runs.append(run_benchgen(args, suite, table, scale, parallel, work_dir))
+                    finally:
+                        shutil.rmtree(work_dir, ignore_errors=True)
+                result = best_of(runs)
+                if parallel == 1:
+                    work_dir = tempfile.mkdtemp(prefix="official-", dir=args.work_dir)
+                    try:
+                        official = time_official(args, suite, table, scale, work_dir)
+                    finally:
+                        shutil.rmtree(work_dir, ignore_errors=True)
+                    if official is not None:
+                        result["official_seconds"] = official
+                        result["speedup_vs_official"] = official / result["seconds"]
+                results[key] = result
+                line = "{:<40} {:>12.0f} text rows/s {:>12.0f} arrow rows/s".format(
+                    key, result["text_rows_per_second"], result["arrow_rows_per_second"]
+                )
+                if "speedup_vs_official" in result:
+                    line += "  {:.2f}x official".format(result["speedup_vs_official"])
+                print(line, flush=True)
+    return results
+
+
+def git_revision():
+    try:
+        return subprocess.run(
+            ["git", "-C", ROOT_DIR, "rev-parse", "--short", "HEAD"],
+            check=True, capture_output=True, text=True,
+        ).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return ""
+
+
+def write_report(path, results):
+    report = {
+        "host": socket.gethostname(),
+        "revision": git_revision(),
+        "date": datetime.datetime.now(datetime.timezone.utc).isoformat(timespec="seconds"),
+        "results": results,
+    }
+    directory = os.path.dirname(os.path.abspath(path))
+    os.makedirs(directory, exist_ok=True)
+    temp_path = path + ".tmp"
+    with open(temp_path, "w") as handle:
+        json.dump(report, handle, indent=2, sort_keys=True)
+        handle.write("\n")
+    os.replace(temp_path, path)
+
+
+def compare(baseline, results, threshold):
+    """Prints the comparison and returns the number of regressions."""
+    regressions = 0
+    for key, result in sorted(results.items()):
+        base = baseline.get(key)
+        if base is None:
+            print("{:<40} no baseline".format(key))
+            continue
+        if base.get("rows") != result["rows"]:
+            print("{:<40} row count changed: {} -> {}".format(
+                key, base.get("rows"), result["rows"]))
+            regressions += 1
+            continue
+        for metric in METRICS:
+            before = base.get(metric, 0.0)
+            if before <= 0.0:
+                continue
+            change = result[metric] / before - 1.0
+            status = "ok"
+            if change < -threshold:
+                status = "REGRESSION"
+                regressions += 1
+            print("{:<40} {:<22} {:>+7.1%}  {}".format(key, metric, change, status))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Check benchgen throughput against a stored baseline."
+    )
+    parser.add_argument(
+        "--benchgen",
+        default=os.environ.get("BENCHGEN_BIN", os.path.join(ROOT_DIR, "build", "src", "benchgen")),
+        help="benchgen binary (default: $BENCHGEN_BIN or build/src/benchgen)",
+    )
+    parser.add_argument(
+        "--baseline",
+        default=os.path.join(ROOT_DIR, "scripts", "perf", "baselines",
+                             socket.gethostname() + ".json"),
+        help="Baseline JSON (default: scripts/perf/baselines/<host>.json)",
+    )
+    parser.add_argument(
+        "--update-baseline", action="store_true",
+        help="Store this run as the baseline instead of comparing",
+    )
+    parser.add_argument(
+        "--results", default="",
+        help="Also write this run's results to this JSON file",
+    )
+    parser.add_argument(
+        "--threshold", type=float, default=0.10,
+        help="Fail when a throughput drops by more than this fraction (default: 0.10)",
+    )
+    parser.add_argument(
+        "--scales", type=lambda v: [s for s in v.replace(",", " ").split() if s],
+        default=["1", "10"],
+        help="Scale factors to run (default: '1 10')",
+    )
+    parser.add_argument(
+        "--tables", type=parse_tables, default=DEFAULT_TABLES,
+        help="<suite>:<table>[,...] (default: the largest tables of each suite)",
+    )
+    parser.add_argument(
+        "--parallel", type=int, default=os.cpu_count() or 1,
+        help="Worker count for the parallel runs (default: all CPUs)",
+    )
+    parser.add_argument(
+        "--repeat", type=int, default=1,
+        help="Runs per cell; the best throughput is kept (default: 1)",
+    )
+    parser.add_argument(
+        "--work-dir", default=os.path.join(ROOT_DIR, "build", "perf"),
+        help="Scratch directory for generated files (default: build/perf)",
+    )
+    parser.add_argument("--tpch-dbgen", default=os.environ.get("TPCH_DBGEN_BIN", ""),
+                        help="Official TPC-H dbgen to time (default: $TPCH_DBGEN_BIN)")
+    parser.add_argument("--tpcds-dsdgen", default=os.environ.get("TPCDS_DSDGEN_BIN", ""),
+                        help="Official TPC-DS dsdgen to time (default: $TPCDS_DSDGEN_BIN)")
+    parser.add_argument("--ssb-dbgen", default=os.environ.get("SSB_DBGEN_BIN", ""),
+                        help="Official SSB dbgen to time (default: $SSB_DBGEN_BIN)")
+    args = parser.parse_args()
+
+    if not os.access(args.benchgen, os.X_OK):
+        print("benchgen is not executable: {}".format(args.benchgen), file=sys.stderr)
+        return 1
+    if args.parallel < 1 or args.repeat < 1:
+        print("--parallel and --repeat must be positive", file=sys.stderr)
+        return 1
+    for label in ("tpch_dbgen", "tpcds_dsdgen", "ssb_dbgen"):
+        path = getattr(args, label)
+        if path and not os.access(path, os.X_OK):
+            print("{} is not executable: {}".format(label, path), file=sys.stderr)
+            return 1
+        setattr(args, label, os.path.abspath(path) if path else "")
+    args.benchgen = os.path.abspath(args.benchgen)
+    os.makedirs(args.work_dir, exist_ok=True)
+
+    try:
+        results = run_matrix(args)
+    except subprocess.CalledProcessError as exc:
+        print("Command failed ({}): {}".format(exc.returncode, " ".join(exc.cmd)),
+              file=sys.stderr)
+        return 1
+    if args.results:
+        write_report(args.results, results)
+
+    if args.update_baseline or not os.path.exists(args.baseline):
+        write_report(args.baseline, results)
+        print("Baseline written to {}".format(args.baseline))
+        return 0
+
+    with open(args.baseline, "r") as handle:
+        baseline = json.load(handle).get("results", {})
+    regressions = compare(baseline, results, args.threshold)
+    if regressions:
+        print("{} throughput regression(s) beyond {:.0%}".format(regressions, args.threshold),
+              file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
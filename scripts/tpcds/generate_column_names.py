@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# Copyright 2021-present StarRocks, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     https://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import os
+import re
+import sys
+
+DEFINE_RE = re.compile(r"#define\s+(\w+)\s+(\d+)\s*$")
+
+
+def read_column_names(path):
+    names = {}
+    with open(path, "r") as handle:
+        for line in handle:
+            match = DEFINE_RE.match(line)
+            if not match:
+                continue
+            name, value = match.group(1), int(match.group(2))
+            # *_START/*_END mark table ranges and alias real columns.
+            if name.endswith("_START") or name.endswith("_END"):
+                continue
+            if name == "MAX_COLUMN":
+                continue
+            names.setdefault(value, name)
+    return names
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the TPC-DS column id to name table."
+    )
+    parser.add_argument(
+        "--columns",
+        default="src/tpcds/utils/columns.h",
+        help="Column id header (default: src/tpcds/utils/columns.h)",
+    )
+    parser.add_argument(
+        "--output",
+        default="generated/tpcds_column_names.cc",
+        help="Output C++ source file (default: generated/tpcds_column_names.cc)",
+    )
+    args = parser.parse_args()
+
+    try:
+        names = read_column_names(args.columns)
+    except OSError as exc:
+        print("Failed to read {}: {}".format(args.columns, exc), file=sys.stderr)
+        return 1
+    if not names:
+        print("No column ids found in {}".format(args.columns), file=sys.stderr)
+        return 1
+
+    output_dir = os.path.dirname(args.output)
+    if output_dir:
+        os.makedirs(output_dir, exist_ok=True)
+
+    max_id = max(names)
+    with open(args.output, "w", newline="\n") as out:
+        out.write("// Generated by scripts/tpcds/generate_column_names.py\n")
+        out.write("#include \"utils/column_profiler.h\"\n\n")
+        out.write("namespace benchgen::tpcds::internal {\n\n")
+        out.write("const char* ColumnName(int column_id) {\n")
+        out.write("  static const char* const kNames[] = {\n")
+        for column_id in range(max_id + 1):
+            out.write("      \"%s\",\n" % names.get(column_id, ""))
+        out.write("  };\n")
+        out.write("  if (column_id < 0 ||\n")
+        out.write("      column_id >= static_cast<int>(sizeof(kNames) / sizeof(kNames[0]))) {\n")
+        out.write("    return \"\";\n")
+        out.write("  }\n")
+        out.write("  return kNames[column_id];\n")
+        out.write("}\n")
+        out.write("\n}  // namespace benchgen::tpcds::internal\n")
+
+    print("Wrote {}".format(args.output))
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "benchgen/generator_options.h"
 
@@ -25,11 +26,42 @@ struct GenTableArgs {
   std::string table;
   double scale_factor = 1.0;
   int64_t chunk_size = 10000;
+  int64_t chunk_bytes = 0;
   int64_t start_row = 0;
   int64_t row_count = -1;
   std::string output;
+  // text (dbgen-style rows) or columnar-raw (a directory of raw column
+  // files).
+  std::string format = "text";
+  // --sink <kind>[:<path>] specs, fed from one generation pass instead of
+  // --output.
+  std::vector<std::string> sinks;
   benchgen::DbgenSeedMode seed_mode = benchgen::DbgenSeedMode::kPerTable;
   int64_t parallel = 1;
+  int64_t sample_every = 0;
+  double sample_fraction = 0.0;
+  int64_t sample_seed = 0;
+  int64_t sold_date_min_sk = -1;
+  int64_t sold_date_max_sk = -1;
+  std::string partition_by;
+  std::string bucket_by;
+  int64_t buckets = 0;
+  int64_t max_open_files = 64;
+  int64_t max_file_bytes = 0;
+  int64_t max_file_rows = 0;
+  int64_t node_index = 0;
+  int64_t node_count = 1;
+  std::string manifest;
+  bool pin_threads = false;
+  std::string numa_nodes;
+  std::string writer = "stream";
+  bool direct_io = false;
+  int64_t io_depth = 4;
+  std::string stats;
+  bool progress = false;
+  std::string trace;
+  // TPC-H update streams 1..refresh_streams instead of a base table.
+  int64_t refresh_streams = 0;
 };
 
 }  // namespace benchgen::cli
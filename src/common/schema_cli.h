@@ -16,7 +16,6 @@
 
 #include <algorithm>
 #include <cctype>
-#include <cstdio>
 #include <exception>
 #include <memory>
 #include <ostream>
@@ -27,6 +26,7 @@
 #include "benchgen/benchmark_suite.h"
 #include "benchgen/generator_options.h"
 #include "benchgen/record_batch_iterator.h"
+#include "util/json.h"
 
 namespace benchgen::cli {
 
@@ -149,50 +149,7 @@ inline bool ParseSchemaArgs(int argc, char** argv, SchemaArgs* args,
   return true;
 }
 
-inline std::string EscapeJson(std::string_view input) {
-  std::string output;
-  output.reserve(input.size());
-  for (unsigned char c : input) {
-    switch (c) {
-      case '"':
-        output += "\\\"";
-        break;
-      case '\\':
-        output += "\\\\";
-        break;
-      case '\b':
-        output += "\\b";
-        break;
-      case '\f':
-        output += "\\f";
-        break;
-      case '\n':
-        output += "\\n";
-        break;
-      case '\r':
-        output += "\\r";
-        break;
-      case '\t':
-        output += "\\t";
-        break;
-      default:
-        if (c < 0x20) {
-          char buf[7];
-          std::snprintf(buf, sizeof(buf), "\\u%04x",
-                        static_cast<unsigned int>(c));
-          output += buf;
-        } else {
-          output.push_back(static_cast<char>(c));
-        }
-        break;
-    }
-  }
-  return output;
-}
-
-inline void WriteJsonString(std::ostream* out, std::string_view value) {
-  *out << "\"" << EscapeJson(value) << "\"";
-}
+using ::benchgen::internal::WriteJsonString;
 
 template <typename TableId, typename TableIdToStringFn, typename MakeIteratorFn>
 bool WriteSchemaJsonForTables(std::ostream* out,
@@ -297,31 +254,15 @@ inline bool WriteSchemaJsonForSuite(std::ostream* out,
       return false;
     }
     std::string table_label(table_name);
-    std::unique_ptr<RecordBatchIterator> iter;
-    try {
-      auto status = suite.MakeIterator(table_name, options, &iter);
-      if (!status.ok()) {
-        if (error) {
-          *error = "failed to build schema for table " + table_label + ": " +
-                   status.ToString();
-        }
-        return false;
-      }
-    } catch (const std::exception& exc) {
+    std::shared_ptr<arrow::Schema> schema;
+    auto status = suite.TableSchema(table_name, options, &schema);
+    if (!status.ok()) {
       if (error) {
         *error = "failed to build schema for table " + table_label + ": " +
-                 exc.what();
-      }
-      return false;
-    } catch (...) {
-      if (error) {
-        *error = "failed to build schema for table " + table_label +
-                 ": unknown error";
+                 status.ToString();
       }
       return false;
     }
-
-    std::shared_ptr<arrow::Schema> schema = iter->schema();
     if (!schema) {
       if (error) {
         *error = "schema is null for table " + table_label;
@@ -14,11 +14,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,8 +32,25 @@
 #include "benchgen/benchmark_suite.h"
 #include "benchgen/generator_options.h"
 #include "benchgen/record_batch_iterator_factory.h"
+#include "benchgen/record_batch_sink.h"
+#include "benchgen/table.h"
 #include "common/gen_table_args.h"
+#include "tpcds/utils/date.h"
+#include "util/async_file_writer.h"
+#include "util/bucketed_file_sink.h"
+#include "util/buffered_file_set.h"
+#include "util/checksum_sink.h"
+#include "util/columnar_raw_sink.h"
+#include "util/generation_manifest.h"
+#include "util/ipc_file_sink.h"
+#include "util/json.h"
+#include "util/partitioned_file_sink.h"
+#include "util/rolling_file_sink.h"
+#include "util/record_batch_sink.h"
 #include "util/record_batch_writer.h"
+#include "util/run_stats.h"
+#include "util/thread_affinity.h"
+#include "util/trace.h"
 
 namespace {
 
@@ -65,6 +85,29 @@ bool ReadDouble(const char* value, double* out) {
   return true;
 }
 
+// Parses YYYY-MM-DD into a julian day number, the encoding of TPC-DS
+// d_date_sk.
+bool ReadDateSk(const char* value, int64_t* out) {
+  using benchgen::tpcds::internal::Date;
+  int year = 0;
+  int month = 0;
+  int day = 0;
+  char trailing = 0;
+  if (std::sscanf(value, "%d-%d-%d%c", &year, &month, &day, &trailing) != 3 ||
+      year < 1 || year > 9999 || month < 1 || month > 12 || day < 1) {
+    return false;
+  }
+  // ToJulianDays rolls 2000-02-30 over into March; a date that does not
+  // come back unchanged from its julian day does not exist.
+  const int julian = Date::ToJulianDays(Date{year, month, day});
+  const Date check = Date::FromJulianDays(julian);
+  if (check.year != year || check.month != month || check.day != day) {
+    return false;
+  }
+  *out = julian;
+  return true;
+}
+
 struct ParallelRange {
   int64_t start_row = 0;
   int64_t row_count = 0;
@@ -96,6 +139,8 @@ bool ResolveTableRowCount(const benchgen::BenchmarkSuite& suite,
   benchgen::GeneratorOptions options;
   options.scale_factor = args.scale_factor;
   options.seed_mode = args.seed_mode;
+  options.sold_date_min_sk = args.sold_date_min_sk;
+  options.sold_date_max_sk = args.sold_date_max_sk;
 
   auto status = suite.ResolveTableRowCount(args.table, options, out, known);
   if (!status.ok()) {
@@ -171,6 +216,48 @@ bool ResolveParallelRanges(const benchgen::BenchmarkSuite& suite,
     range.start_row += args.start_row;
     ranges->push_back(range);
   }
+  // Some totals (lineitem, lineorder) are interpolated; let the last worker
+  // run to the real end of the table instead of stopping at the estimate.
+  if (args.row_count < 0) {
+    ranges->back().row_count = -1;
+  }
+  return true;
+}
+
+// Narrows args to this node's share of the requested row window, split the
+// same way --parallel splits it across workers. The last node runs to the
+// end of the table when no --row-count was given.
+bool ResolveNodeRange(const benchgen::BenchmarkSuite& suite,
+                      benchgen::cli::GenTableArgs* args, int64_t* total_rows,
+                      std::string* error) {
+  bool known = false;
+  *total_rows = -1;
+  if (!ResolveTableRowCount(suite, *args, total_rows, &known, error)) {
+    return false;
+  }
+  if (!known) {
+    *total_rows = -1;
+    if (args->node_count > 1) {
+      if (error) {
+        *error = "--node-count requires a table with a known row count";
+      }
+      return false;
+    }
+    return true;
+  }
+  if (args->node_count <= 1) {
+    return true;
+  }
+
+  int64_t available = std::max<int64_t>(*total_rows - args->start_row, 0);
+  int64_t base_count = args->row_count < 0
+                           ? available
+                           : std::min(args->row_count, available);
+  ParallelRange range =
+      SplitRange(base_count, args->node_count, args->node_index);
+  bool last_node = args->node_index == args->node_count - 1;
+  args->start_row += range.start_row;
+  args->row_count = (last_node && args->row_count < 0) ? -1 : range.row_count;
   return true;
 }
 
@@ -191,20 +278,88 @@ void PrintUsage(const char* argv0) {
       << " --benchmark <tpch|tpcds|ssb> --table <name> [options]\n"
          "Common options:\n"
          "  --benchmark, -b <name>   Benchmark to generate\n"
-         "  --table, -t <name>       Table name\n"
+         "  --table, -t <name>       Table name; tpch part,partsupp writes both\n"
+         "                           tables from one pass into the --output\n"
+         "                           directory\n"
          "  --scale, --scale-factor, -s <factor>  Scale factor (default: 1)\n"
          "  --chunk-size <rows>      Rows per RecordBatch (default: 10000)\n"
+         "  --chunk-bytes <bytes>    Target RecordBatch size in bytes; overrides\n"
+         "                           --chunk-size (default: 0 = disabled)\n"
          "  --start-row <row>        0-based row offset (default: 0)\n"
          "  --row-count <rows>       Rows to generate (default: -1 = to end)\n"
          "  --output, -o <path>      Output path (default: stdout)\n"
          "                           TPC-DS requires --output\n"
+         "  --format <text|columnar-raw>\n"
+         "                           Output format (default: text). columnar-raw\n"
+         "                           writes one raw little-endian file per column\n"
+         "                           plus schema.json into the --output directory\n"
          "  --dbgen-seed-mode <all-tables|per-table>  Seed init (default: per-table)\n"
+         "  --sample-every <k>       Keep every k-th row of the table\n"
+         "  --sample-fraction <p>    Keep each row with probability p, decided by\n"
+         "                           a hash of the row index\n"
+         "  --sample-seed <n>        Sampling seed / phase (default: 0)\n"
+         "  --sold-date-from <YYYY-MM-DD>  TPC-DS catalog_sales: first sold date\n"
+         "  --sold-date-to <YYYY-MM-DD>    TPC-DS catalog_sales: last sold date\n"
+         "  --partition-by <column[:year|:month]>\n"
+         "                           Write <output>/<column>=<value>/part-<worker>\n"
+         "                           files; --output names the root directory\n"
+         "  --bucket-by <column> --buckets <n>\n"
+         "                           Write <output>/bucket-<b>/part-<worker> files\n"
+         "                           routed by a stable hash of <column>\n"
+         "  --max-open-files <n>     Open file limit for --partition-by and\n"
+         "                           --bucket-by\n"
+         "                           (default: 64)\n"
+         "  --max-file-bytes <bytes>  Roll to <output>-<worker>-<seq> files of at\n"
+         "                           most this size, listed with their row ranges\n"
+         "                           in <output>-<worker>.manifest.json\n"
+         "  --max-file-rows <rows>   Like --max-file-bytes, by row count\n"
+         "  --node-index <i> --node-count <n>\n"
+         "                           Generate node i's share of the rows when the\n"
+         "                           table is split across n machines\n"
+         "  --manifest <path>        Write a JSON manifest of the generated row\n"
+         "                           ranges and files (sizes, CRC-32)\n"
+         "  --numa-nodes <list>      Place workers round-robin on these NUMA\n"
+         "                           nodes (e.g. 0,1 or 0-1) and report per-node\n"
+         "                           throughput\n"
+         "  --pin-threads            Pin each worker to one CPU, round-robin\n"
+         "                           across NUMA nodes\n"
+         "  --sink <kind>[:<path>]   Instead of --output, write the same rows to\n"
+         "                           several sinks from one pass; repeatable.\n"
+         "                           Kinds: text:<path>, arrow:<path> (Arrow IPC\n"
+         "                           file), columnar-raw:<dir>, checksum[:<path>]\n"
+         "                           (rows, bytes and CRC-32 of the text output;\n"
+         "                           stderr or JSON)\n"
+         "  --writer <stream|pwrite|io_uring>\n"
+         "                           Output file backend (default: stream)\n"
+         "  --direct-io              Open output with O_DIRECT (pwrite/io_uring)\n"
+         "  --io-depth <n>           io_uring writes in flight per worker\n"
+         "                           (default: 4)\n"
+         "  --stats <path>           Write per-worker rows, bytes, startup cost,\n"
+         "                           generate/format/write time and rows over\n"
+         "                           time as JSON\n"
+         "  --progress               Print rows, rows/s and MiB/s to stderr\n"
+         "                           every few seconds\n"
+         "  --trace <path>           Write per-worker generate/format/write,\n"
+         "                           setup and wait spans as a Chrome trace\n"
+         "                           (open in Perfetto or chrome://tracing)\n"
+         "  --refresh-stream <n>     TPC-H: write update streams 1..n (RF1\n"
+         "                           orders.tbl.u<i>, lineitem.tbl.u<i>, RF2\n"
+         "                           delete.<i>) into the --output directory\n"
+         "                           TPC-DS: write approximate fact table\n"
+         "                           sources for runs 1..n as\n"
+         "                           <table>_<i>.dat; not dsdgen -update\n"
+         "                           compatible, no dimension sources\n"
          "  --help, -h               Show this help\n"
          "Parallel options:\n"
          "  --parallel, -p <count>\n"
          "                           Worker threads (default: 1)\n"
          "                           Uses <output>-<index> (before extension)\n"
-         "                           Runs serially when total rows are unknown\n";
+         "                           Runs serially when total rows are unknown\n"
+         "Manifest verification:\n"
+         "  " << argv0 << " merge-manifests [--verify-files] [--output <path>]\n"
+         "      <manifest>...        Check that node manifests cover the table\n"
+         "                           exactly once; optionally re-checksum the\n"
+         "                           files and write a merged manifest\n";
 }
 
 benchgen::SuiteId ResolveBenchmark(int argc, char** argv, std::string* error) {
@@ -307,6 +462,15 @@ bool ParseArgs(int argc, char** argv, benchgen::SuiteId benchmark,
       }
       continue;
     }
+    if (arg == "--chunk-bytes") {
+      const char* value = require_value("--chunk-bytes");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->chunk_bytes)) {
+        *error = "Invalid chunk bytes";
+        return false;
+      }
+      continue;
+    }
     if (arg == "--start-row") {
       const char* value = require_value("--start-row");
       if (!value) return false;
@@ -340,6 +504,194 @@ bool ParseArgs(int argc, char** argv, benchgen::SuiteId benchmark,
       }
       continue;
     }
+    if (arg == "--sample-every") {
+      const char* value = require_value("--sample-every");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->sample_every)) {
+        *error = "Invalid sample interval";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--sample-fraction") {
+      const char* value = require_value("--sample-fraction");
+      if (!value) return false;
+      if (!ReadDouble(value, &args->sample_fraction)) {
+        *error = "Invalid sample fraction";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--sample-seed") {
+      const char* value = require_value("--sample-seed");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->sample_seed)) {
+        *error = "Invalid sample seed";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--sold-date-from") {
+      const char* value = require_value("--sold-date-from");
+      if (!value) return false;
+      if (!ReadDateSk(value, &args->sold_date_min_sk)) {
+        *error = "Invalid sold date: " + std::string(value);
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--sold-date-to") {
+      const char* value = require_value("--sold-date-to");
+      if (!value) return false;
+      if (!ReadDateSk(value, &args->sold_date_max_sk)) {
+        *error = "Invalid sold date: " + std::string(value);
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--partition-by") {
+      const char* value = require_value("--partition-by");
+      if (!value) return false;
+      args->partition_by = value;
+      continue;
+    }
+    if (arg == "--bucket-by") {
+      const char* value = require_value("--bucket-by");
+      if (!value) return false;
+      args->bucket_by = value;
+      continue;
+    }
+    if (arg == "--buckets") {
+      const char* value = require_value("--buckets");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->buckets)) {
+        *error = "Invalid bucket count";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--max-open-files") {
+      const char* value = require_value("--max-open-files");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->max_open_files)) {
+        *error = "Invalid max open files";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--max-file-bytes") {
+      const char* value = require_value("--max-file-bytes");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->max_file_bytes)) {
+        *error = "Invalid max file bytes";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--max-file-rows") {
+      const char* value = require_value("--max-file-rows");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->max_file_rows)) {
+        *error = "Invalid max file rows";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--node-index") {
+      const char* value = require_value("--node-index");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->node_index)) {
+        *error = "Invalid node index";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--node-count") {
+      const char* value = require_value("--node-count");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->node_count)) {
+        *error = "Invalid node count";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--manifest") {
+      const char* value = require_value("--manifest");
+      if (!value) return false;
+      args->manifest = value;
+      continue;
+    }
+    if (arg == "--pin-threads") {
+      args->pin_threads = true;
+      continue;
+    }
+    if (arg == "--numa-nodes") {
+      const char* value = require_value("--numa-nodes");
+      if (!value) return false;
+      args->numa_nodes = value;
+      continue;
+    }
+    if (arg == "--format") {
+      const char* value = require_value("--format");
+      if (!value) return false;
+      args->format = value;
+      if (args->format != "text" && args->format != "columnar-raw") {
+        *error = "Unknown format: " + args->format;
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--sink") {
+      const char* value = require_value("--sink");
+      if (!value) return false;
+      args->sinks.push_back(value);
+      continue;
+    }
+    if (arg == "--writer") {
+      const char* value = require_value("--writer");
+      if (!value) return false;
+      args->writer = value;
+      continue;
+    }
+    if (arg == "--direct-io") {
+      args->direct_io = true;
+      continue;
+    }
+    if (arg == "--io-depth") {
+      const char* value = require_value("--io-depth");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->io_depth)) {
+        *error = "Invalid io depth";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--stats") {
+      const char* value = require_value("--stats");
+      if (!value) return false;
+      args->stats = value;
+      continue;
+    }
+    if (arg == "--refresh-stream") {
+      const char* value = require_value("--refresh-stream");
+      if (!value) return false;
+      if (!ReadInt64(value, &args->refresh_streams) ||
+          args->refresh_streams <= 0) {
+        *error = "Invalid refresh stream count";
+        return false;
+      }
+      continue;
+    }
+    if (arg == "--trace") {
+      const char* value = require_value("--trace");
+      if (!value) return false;
+      args->trace = value;
+      continue;
+    }
+    if (arg == "--progress") {
+      args->progress = true;
+      continue;
+    }
     if (arg == "--dbgen-seed-mode") {
       const char* value = require_value("--dbgen-seed-mode");
       if (!value) return false;
@@ -364,6 +716,7 @@ bool ParseArgs(int argc, char** argv, benchgen::SuiteId benchmark,
 
 struct SuiteConfig {
   benchgen::internal::RecordBatchWriterFormat writer_format;
+  std::string file_extension;
   bool require_output = false;
   std::ios::openmode output_mode = std::ios::out | std::ios::binary;
 };
@@ -381,17 +734,20 @@ bool ResolveSuiteConfig(const benchgen::BenchmarkSuite& suite,
     case benchgen::SuiteId::kTpch:
       config->writer_format =
           benchgen::internal::RecordBatchWriterFormat::kTpch;
+      config->file_extension = "tbl";
       config->require_output = false;
       config->output_mode = std::ios::out | std::ios::binary;
       return true;
     case benchgen::SuiteId::kTpcds:
       config->writer_format =
           benchgen::internal::RecordBatchWriterFormat::kTpcds;
+      config->file_extension = "dat";
       config->require_output = true;
       config->output_mode = std::ios::out | std::ios::binary;
       return true;
     case benchgen::SuiteId::kSsb:
       config->writer_format = benchgen::internal::RecordBatchWriterFormat::kSsb;
+      config->file_extension = "tbl";
       config->require_output = false;
       config->output_mode = std::ios::out;
       return true;
@@ -405,6 +761,50 @@ bool ResolveSuiteConfig(const benchgen::BenchmarkSuite& suite,
   return false;
 }
 
+bool IsRollingOutput(const benchgen::cli::GenTableArgs& args) {
+  return args.max_file_bytes > 0 || args.max_file_rows > 0;
+}
+
+bool IsColumnarRaw(const benchgen::cli::GenTableArgs& args) {
+  return args.format == "columnar-raw";
+}
+
+// One --sink: text:<path>, arrow:<path>, columnar-raw:<dir> or
+// checksum[:<path>].
+struct SinkSpec {
+  std::string kind;
+  std::string path;
+};
+
+bool ParseSinkSpec(const std::string& text, SinkSpec* spec,
+                   std::string* error) {
+  const size_t colon = text.find(':');
+  spec->kind = text.substr(0, colon);
+  spec->path = colon == std::string::npos ? "" : text.substr(colon + 1);
+  if (spec->kind == "checksum" ||
+      ((spec->kind == "text" || spec->kind == "arrow" ||
+        spec->kind == "columnar-raw") &&
+       !spec->path.empty())) {
+    return true;
+  }
+  if (error) {
+    *error = "Invalid --sink " + text +
+             " (expected text:<path>, arrow:<path>, columnar-raw:<dir> or "
+             "checksum[:<path>])";
+  }
+  return false;
+}
+
+// Parallel workers write <path>-<worker>; a checksum without a path
+// reports each worker on stderr.
+std::string WorkerSinkSpec(const std::string& text, int64_t worker_index) {
+  SinkSpec spec;
+  if (!ParseSinkSpec(text, &spec, nullptr) || spec.path.empty()) {
+    return text;
+  }
+  return spec.kind + ":" + BuildParallelOutputPath(spec.path, worker_index);
+}
+
 bool ValidateSuiteArgs(const benchgen::BenchmarkSuite& suite,
                        const benchgen::cli::GenTableArgs& args,
                        std::string* error) {
@@ -421,118 +821,776 @@ bool ValidateSuiteArgs(const benchgen::BenchmarkSuite& suite,
     }
     return false;
   }
-
-  return true;
-}
-
-int RunSuiteGenTable(const benchgen::BenchmarkSuite& suite,
-                     const benchgen::cli::GenTableArgs& args,
-                     const SuiteConfig& config) {
-  if (args.table.empty()) {
-    std::cerr << "--table is required\n";
-    return 1;
-  }
-  if (config.require_output && args.output.empty()) {
-    std::cerr << "Output path is required\n";
-    return 1;
+  if (args.chunk_bytes < 0) {
+    if (error) {
+      *error = "Chunk bytes must be non-negative";
+    }
+    return false;
   }
-
-  benchgen::GeneratorOptions options;
-  options.scale_factor = args.scale_factor;
-  options.chunk_size = args.chunk_size;
-  options.start_row = args.start_row;
-  options.row_count = args.row_count;
-  options.seed_mode = args.seed_mode;
-
-  std::unique_ptr<benchgen::RecordBatchIterator> iterator;
-  auto status = suite.MakeIterator(args.table, options, &iterator);
-  if (!status.ok()) {
-    std::cerr << "Failed to create generator: " << status.ToString() << "\n";
-    return 1;
+  if (args.sample_every < 0) {
+    if (error) {
+      *error = "Sample interval must be non-negative";
+    }
+    return false;
   }
-
-  std::ofstream file;
-  std::ostream* output = &std::cout;
-  if (!args.output.empty()) {
-    file.open(args.output, config.output_mode);
-    if (!file) {
-      std::cerr << "Failed to open output file: " << args.output << "\n";
-      return 1;
+  if (args.sample_fraction < 0.0 || args.sample_fraction > 1.0) {
+    if (error) {
+      *error = "Sample fraction must be between 0 and 1";
     }
-    output = &file;
+    return false;
   }
-
-  benchgen::internal::RecordBatchWriter writer(config.writer_format);
-  std::shared_ptr<arrow::RecordBatch> batch;
-  while (true) {
-    status = iterator->Next(&batch);
-    if (!status.ok()) {
-      std::cerr << "Error generating batch: " << status.ToString() << "\n";
-      return 1;
+  if (args.sample_every > 0 && args.sample_fraction > 0.0) {
+    if (error) {
+      *error = "--sample-every and --sample-fraction are mutually exclusive";
     }
-    if (!batch) {
-      break;
+    return false;
+  }
+  if (args.sample_seed < 0) {
+    if (error) {
+      *error = "Sample seed must be non-negative";
     }
-    status = writer.Write(output, batch);
-    if (!status.ok()) {
-      std::cerr << "Error writing batch: " << status.ToString() << "\n";
-      return 1;
+    return false;
+  }
+  if (!args.partition_by.empty() && args.output.empty()) {
+    if (error) {
+      *error = "--partition-by requires --output (the root directory)";
     }
+    return false;
   }
-
-  return 0;
-}
-
-int RunSuiteGenTableParallel(const benchgen::BenchmarkSuite& suite,
-                             const benchgen::cli::GenTableArgs& args,
-                             const SuiteConfig& config,
-                             const std::vector<ParallelRange>& ranges) {
-  if (args.output.empty()) {
-    std::cerr << "Output path is required for parallel generation\n";
-    return 1;
+  if (args.bucket_by.empty() != (args.buckets == 0)) {
+    if (error) {
+      *error = "--bucket-by and --buckets must be given together";
+    }
+    return false;
   }
-
-  std::vector<std::string> part_paths;
-  part_paths.reserve(ranges.size());
-  for (size_t i = 0; i < ranges.size(); ++i) {
-    part_paths.push_back(
-        BuildParallelOutputPath(args.output, static_cast<int64_t>(i)));
+  if (args.buckets < 0 || args.buckets > INT32_MAX) {
+    if (error) {
+      *error = "Bucket count must be positive";
+    }
+    return false;
   }
-
-  std::atomic<bool> failed(false);
-  std::mutex mutex;
-  int status = 0;
-  std::string status_message;
-
-  auto worker = [&](size_t index) {
-    if (failed.load()) {
-      return;
+  if (!args.bucket_by.empty() && args.output.empty()) {
+    if (error) {
+      *error = "--bucket-by requires --output (the root directory)";
     }
-    benchgen::cli::GenTableArgs part_args = args;
-    part_args.start_row = ranges[index].start_row;
-    part_args.row_count = ranges[index].row_count;
-    part_args.output = part_paths[index];
-    part_args.parallel = 1;
-
-    int result = RunSuiteGenTable(suite, part_args, config);
-    if (result != 0) {
-      failed.store(true);
-      std::lock_guard<std::mutex> lock(mutex);
-      if (status == 0) {
-        status = result;
-        status_message =
-            "Parallel worker failed for part " + std::to_string(index);
-      }
+    return false;
+  }
+  if (!args.bucket_by.empty() && !args.partition_by.empty()) {
+    if (error) {
+      *error = "--bucket-by and --partition-by are mutually exclusive";
     }
-  };
-
-  std::vector<std::thread> threads;
-  threads.reserve(ranges.size());
-  for (size_t i = 0; i < ranges.size(); ++i) {
-    threads.emplace_back(worker, i);
+    return false;
   }
-  for (auto& thread : threads) {
-    thread.join();
+  if (args.max_open_files <= 0) {
+    if (error) {
+      *error = "Max open files must be positive";
+    }
+    return false;
+  }
+  if (args.max_file_bytes < 0 || args.max_file_rows < 0) {
+    if (error) {
+      *error = "Max file bytes and rows must be non-negative";
+    }
+    return false;
+  }
+  if (IsRollingOutput(args) && args.output.empty()) {
+    if (error) {
+      *error = "--max-file-bytes/--max-file-rows require --output";
+    }
+    return false;
+  }
+  if (IsRollingOutput(args) &&
+      (!args.partition_by.empty() || !args.bucket_by.empty())) {
+    if (error) {
+      *error =
+          "--max-file-bytes/--max-file-rows cannot be combined with "
+          "--partition-by or --bucket-by";
+    }
+    return false;
+  }
+  if (args.node_count <= 0) {
+    if (error) {
+      *error = "Node count must be positive";
+    }
+    return false;
+  }
+  if (args.node_index < 0 || args.node_index >= args.node_count) {
+    if (error) {
+      *error = "Node index must be in [0, node count)";
+    }
+    return false;
+  }
+  if (args.node_count > 1 && args.start_row < 0) {
+    if (error) {
+      *error = "Start row must be non-negative";
+    }
+    return false;
+  }
+  if (!args.manifest.empty() && args.output.empty()) {
+    if (error) {
+      *error = "--manifest requires --output";
+    }
+    return false;
+  }
+  benchgen::internal::FileWriteBackend backend;
+  if (!benchgen::internal::ParseFileWriteBackend(args.writer, &backend)) {
+    if (error) {
+      *error = "Unknown writer: " + args.writer;
+    }
+    return false;
+  }
+  if (backend != benchgen::internal::FileWriteBackend::kStream) {
+    if (args.output.empty() && args.sinks.empty()) {
+      if (error) {
+        *error = "--writer " + args.writer + " requires --output";
+      }
+      return false;
+    }
+    if (!args.partition_by.empty() || !args.bucket_by.empty() ||
+        IsRollingOutput(args)) {
+      if (error) {
+        *error = "--writer " + args.writer +
+                 " only applies to plain file output";
+      }
+      return false;
+    }
+  } else if (args.direct_io) {
+    if (error) {
+      *error = "--direct-io requires --writer pwrite or io_uring";
+    }
+    return false;
+  }
+  if (args.io_depth <= 0 || args.io_depth > 4096) {
+    if (error) {
+      *error = "IO depth must be in [1, 4096]";
+    }
+    return false;
+  }
+  if (!args.sinks.empty()) {
+    if (!args.output.empty() || !args.partition_by.empty() ||
+        !args.bucket_by.empty() || IsRollingOutput(args) ||
+        !args.manifest.empty()) {
+      if (error) {
+        *error = "--sink replaces --output and cannot be combined with "
+                 "--partition-by, --bucket-by, rolling output or --manifest";
+      }
+      return false;
+    }
+    for (const auto& text : args.sinks) {
+      SinkSpec spec;
+      if (!ParseSinkSpec(text, &spec, error)) {
+        return false;
+      }
+    }
+  }
+  if (IsColumnarRaw(args)) {
+    if (args.output.empty()) {
+      if (error) {
+        *error = "--format columnar-raw requires --output (the directory)";
+      }
+      return false;
+    }
+    if (!args.partition_by.empty() || !args.bucket_by.empty() ||
+        IsRollingOutput(args) || !args.manifest.empty() ||
+        backend != benchgen::internal::FileWriteBackend::kStream) {
+      if (error) {
+        *error = "--format columnar-raw cannot be combined with "
+                 "--partition-by, --bucket-by, rolling output, --manifest, "
+                 "--writer pwrite or --writer io_uring";
+      }
+      return false;
+    }
+  }
+  if (!args.manifest.empty() &&
+      (!args.partition_by.empty() || !args.bucket_by.empty())) {
+    if (error) {
+      *error =
+          "--manifest cannot be combined with --partition-by or --bucket-by";
+    }
+    return false;
+  }
+
+  return true;
+}
+
+// Plain stream output: the file (unless writing to stdout) and a timing
+// buffer in front of it that separates write time from formatting.
+struct StreamOutput {
+  std::ofstream file;
+  std::unique_ptr<benchgen::internal::TimedStreambuf> timed;
+  std::unique_ptr<std::ostream> stream;
+
+  // Flushes the timing buffer and closes the file.
+  bool Close() {
+    bool ok = true;
+    if (stream) {
+      ok = static_cast<bool>(stream->flush());
+    }
+    if (file.is_open()) {
+      file.close();
+      ok = ok && !file.fail();
+    }
+    return ok;
+  }
+};
+
+// Directory sinks name their per-worker files part-<worker>.<ext>.
+bool MakeOutputSink(const benchgen::cli::GenTableArgs& args,
+                    const SuiteConfig& config,
+                    const std::shared_ptr<arrow::Schema>& schema,
+                    int64_t worker_index, StreamOutput* stream_output,
+                    std::unique_ptr<benchgen::internal::RecordBatchSink>* out,
+                    std::string* error) {
+  if (IsColumnarRaw(args)) {
+    std::unique_ptr<benchgen::internal::ColumnarRawSink> sink;
+    auto status =
+        benchgen::internal::ColumnarRawSink::Open(args.output, schema, &sink);
+    if (!status.ok()) {
+      *error = status.ToString();
+      return false;
+    }
+    *out = std::move(sink);
+    return true;
+  }
+  const std::string part_name =
+      "part-" + std::to_string(worker_index) + "." + config.file_extension;
+  if (!args.partition_by.empty()) {
+    benchgen::internal::PartitionSpec spec;
+    auto status =
+        benchgen::internal::PartitionSpec::Parse(args.partition_by, &spec);
+    if (!status.ok()) {
+      *error = status.message();
+      return false;
+    }
+    *out = std::make_unique<benchgen::internal::PartitionedFileSink>(
+        args.output, std::move(spec), part_name, config.writer_format,
+        args.max_open_files,
+        benchgen::internal::BufferedFileSet::kDefaultMaxBufferedBytes);
+    return true;
+  }
+  if (!args.bucket_by.empty()) {
+    *out = std::make_unique<benchgen::internal::BucketedFileSink>(
+        args.output, args.bucket_by, static_cast<int32_t>(args.buckets),
+        part_name, config.writer_format, args.max_open_files,
+        benchgen::internal::BufferedFileSet::kDefaultMaxBufferedBytes);
+    return true;
+  }
+
+  if (IsRollingOutput(args)) {
+    *out = std::make_unique<benchgen::internal::RollingFileSink>(
+        args.output, worker_index, args.start_row, args.max_file_bytes,
+        args.max_file_rows, config.writer_format);
+    return true;
+  }
+
+  benchgen::internal::AsyncFileWriterOptions writer_options;
+  if (!benchgen::internal::ParseFileWriteBackend(args.writer,
+                                                 &writer_options.backend)) {
+    *error = "Unknown writer: " + args.writer;
+    return false;
+  }
+  if (writer_options.backend != benchgen::internal::FileWriteBackend::kStream) {
+    writer_options.direct_io = args.direct_io;
+    writer_options.queue_depth = static_cast<int32_t>(args.io_depth);
+    std::unique_ptr<benchgen::internal::AsyncFileSink> async_sink;
+    auto status = benchgen::internal::AsyncFileSink::Open(
+        args.output, config.writer_format, writer_options, &async_sink);
+    if (!status.ok()) {
+      *error = status.ToString();
+      return false;
+    }
+    *out = std::move(async_sink);
+    return true;
+  }
+
+  std::streambuf* target = std::cout.rdbuf();
+  if (!args.output.empty()) {
+    stream_output->file.open(args.output, config.output_mode);
+    if (!stream_output->file) {
+      *error = "Failed to open output file: " + args.output;
+      return false;
+    }
+    target = stream_output->file.rdbuf();
+  }
+  stream_output->timed =
+      std::make_unique<benchgen::internal::TimedStreambuf>(target);
+  stream_output->stream =
+      std::make_unique<std::ostream>(stream_output->timed.get());
+  *out = std::make_unique<benchgen::internal::StreamRecordBatchSink>(
+      stream_output->stream.get(), config.writer_format);
+  return true;
+}
+
+struct ChecksumReport {
+  std::string path;
+  const benchgen::internal::ChecksumSink* sink = nullptr;
+};
+
+constexpr int64_t kSinkQueueDepth = 4;
+
+// Builds the --sink outputs behind one FanOutSink. The checksum sinks stay
+// owned by it; their results are read after it is closed.
+bool MakeSinkOutputs(const benchgen::cli::GenTableArgs& args,
+                     const SuiteConfig& config,
+                     const std::shared_ptr<arrow::Schema>& schema,
+                     std::unique_ptr<benchgen::internal::RecordBatchSink>* out,
+                     std::vector<ChecksumReport>* checksums,
+                     std::string* error) {
+  benchgen::internal::AsyncFileWriterOptions writer_options;
+  if (!benchgen::internal::ParseFileWriteBackend(args.writer,
+                                                 &writer_options.backend)) {
+    *error = "Unknown writer: " + args.writer;
+    return false;
+  }
+  writer_options.direct_io = args.direct_io;
+  writer_options.queue_depth = static_cast<int32_t>(args.io_depth);
+
+  std::vector<std::unique_ptr<benchgen::internal::RecordBatchSink>> sinks;
+  for (const auto& text : args.sinks) {
+    SinkSpec spec;
+    if (!ParseSinkSpec(text, &spec, error)) {
+      return false;
+    }
+    arrow::Status status;
+    if (spec.kind == "checksum") {
+      auto sink = std::make_unique<benchgen::internal::ChecksumSink>(
+          config.writer_format);
+      checksums->push_back({spec.path, sink.get()});
+      sinks.push_back(std::move(sink));
+    } else if (spec.kind == "arrow") {
+      std::unique_ptr<benchgen::internal::ArrowIpcFileSink> sink;
+      status = benchgen::internal::ArrowIpcFileSink::Open(spec.path, schema,
+                                                          &sink);
+      sinks.push_back(std::move(sink));
+    } else if (spec.kind == "columnar-raw") {
+      std::unique_ptr<benchgen::internal::ColumnarRawSink> sink;
+      status = benchgen::internal::ColumnarRawSink::Open(spec.path, schema,
+                                                         &sink);
+      sinks.push_back(std::move(sink));
+    } else if (writer_options.backend !=
+               benchgen::internal::FileWriteBackend::kStream) {
+      std::unique_ptr<benchgen::internal::AsyncFileSink> sink;
+      status = benchgen::internal::AsyncFileSink::Open(
+          spec.path, config.writer_format, writer_options, &sink);
+      sinks.push_back(std::move(sink));
+    } else {
+      std::unique_ptr<benchgen::internal::FileRecordBatchSink> sink;
+      status = benchgen::internal::FileRecordBatchSink::Open(
+          spec.path, config.writer_format, &sink);
+      sinks.push_back(std::move(sink));
+    }
+    if (!status.ok()) {
+      *error = status.ToString();
+      return false;
+    }
+  }
+  *out = benchgen::MakeFanOutSink(std::move(sinks), kSinkQueueDepth);
+  return true;
+}
+
+// Prints each checksum to stderr, or writes it as JSON to its path.
+bool ReportChecksums(const std::vector<ChecksumReport>& checksums,
+                     const std::string& table, int64_t worker_index,
+                     std::string* error) {
+  for (const auto& checksum : checksums) {
+    char crc[9];
+    std::snprintf(crc, sizeof(crc), "%08x",
+                  static_cast<unsigned int>(checksum.sink->crc32()));
+    if (checksum.path.empty()) {
+      std::cerr << table << " worker " << worker_index
+                << ": rows=" << checksum.sink->rows()
+                << " bytes=" << checksum.sink->bytes() << " crc32=" << crc
+                << "\n";
+      continue;
+    }
+    std::ofstream out(checksum.path, std::ios::out | std::ios::trunc);
+    out << "{\"table\": ";
+    benchgen::internal::WriteJsonString(&out, table);
+    out << ", \"rows\": " << checksum.sink->rows()
+        << ", \"bytes\": " << checksum.sink->bytes() << ", \"crc32\": \""
+        << crc << "\"}\n";
+    if (!out) {
+      *error = "Failed to write checksum: " + checksum.path;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Lists the files written by a plain or rolling output sink, with sizes and
+// checksums, for the generation manifest.
+bool CollectOutputFiles(const benchgen::cli::GenTableArgs& args,
+                        const benchgen::internal::RecordBatchSink& sink,
+                        int64_t rows_written,
+                        std::vector<benchgen::internal::ManifestFile>* files,
+                        std::string* error) {
+  files->clear();
+  if (IsRollingOutput(args)) {
+    const auto& rolling =
+        static_cast<const benchgen::internal::RollingFileSink&>(sink);
+    for (const auto& info : rolling.files()) {
+      benchgen::internal::ManifestFile file;
+      file.path = info.path;
+      file.first_row = info.first_row;
+      file.row_count = info.row_count;
+      files->push_back(std::move(file));
+    }
+  } else {
+    benchgen::internal::ManifestFile file;
+    file.path = args.output;
+    file.first_row = args.start_row;
+    file.row_count = rows_written;
+    files->push_back(std::move(file));
+  }
+  for (auto& file : *files) {
+    auto status = benchgen::internal::ChecksumFile(file.path, &file.bytes,
+                                                   &file.crc32);
+    if (!status.ok()) {
+      *error = status.ToString();
+      return false;
+    }
+  }
+  return true;
+}
+
+// NUMA nodes workers are spread over; empty when placement is off.
+struct PlacementConfig {
+  std::vector<benchgen::internal::NumaNode> nodes;
+  bool pin_cpu = false;
+};
+
+bool ResolvePlacement(const benchgen::cli::GenTableArgs& args,
+                      PlacementConfig* placement, std::string* error) {
+  placement->nodes.clear();
+  placement->pin_cpu = args.pin_threads;
+  if (!args.pin_threads && args.numa_nodes.empty()) {
+    return true;
+  }
+  std::vector<benchgen::internal::NumaNode> nodes =
+      benchgen::internal::DetectNumaNodes();
+  if (args.numa_nodes.empty()) {
+    placement->nodes = std::move(nodes);
+    return true;
+  }
+  std::vector<int> ids;
+  auto status = benchgen::internal::ParseCpuList(args.numa_nodes, &ids);
+  if (!status.ok() || ids.empty()) {
+    *error = "Invalid NUMA node list: " + args.numa_nodes;
+    return false;
+  }
+  for (int id : ids) {
+    auto it = std::find_if(nodes.begin(), nodes.end(),
+                           [id](const benchgen::internal::NumaNode& node) {
+                             return node.id == id;
+                           });
+    if (it == nodes.end()) {
+      *error = "NUMA node " + std::to_string(id) +
+               " does not exist or has no usable CPUs";
+      return false;
+    }
+    placement->nodes.push_back(*it);
+  }
+  return true;
+}
+
+struct WorkerResult {
+  int numa_node = -1;
+  int64_t rows = 0;
+  double seconds = 0.0;
+  std::vector<benchgen::internal::ManifestFile> files;
+  benchgen::internal::WorkerStats stats;
+};
+
+// Prints rows and rows/s per NUMA node; a node's time is its slowest
+// worker's.
+void PrintPlacementReport(const std::vector<WorkerResult>& results) {
+  struct NodeTotals {
+    int64_t workers = 0;
+    int64_t rows = 0;
+    double seconds = 0.0;
+  };
+  std::map<int, NodeTotals> totals;
+  for (const WorkerResult& result : results) {
+    NodeTotals& node = totals[result.numa_node];
+    ++node.workers;
+    node.rows += result.rows;
+    node.seconds = std::max(node.seconds, result.seconds);
+  }
+  for (const auto& [node_id, node] : totals) {
+    double rate = node.seconds > 0.0 ? node.rows / node.seconds : 0.0;
+    std::fprintf(stderr,
+                 "numa node %d: %lld workers, %lld rows in %.3f s "
+                 "(%.0f rows/s)\n",
+                 node_id, static_cast<long long>(node.workers),
+                 static_cast<long long>(node.rows), node.seconds, rate);
+  }
+}
+
+int RunSuiteGenTable(const benchgen::BenchmarkSuite& suite,
+                     const benchgen::cli::GenTableArgs& args,
+                     const SuiteConfig& config, int64_t worker_index,
+                     const PlacementConfig& placement, WorkerResult* result,
+                     benchgen::internal::WorkerProgress* progress,
+                     benchgen::internal::TraceRecorder* trace) {
+  if (args.table.empty()) {
+    std::cerr << "--table is required\n";
+    return 1;
+  }
+  if (config.require_output && args.output.empty() && args.sinks.empty()) {
+    std::cerr << "Output path is required\n";
+    return 1;
+  }
+  // Bind before the generator and sink allocate anything, so first-touch
+  // places their buffers on the worker's node. Generation and writing run
+  // on this same thread.
+  if (!placement.nodes.empty()) {
+    benchgen::internal::WorkerPlacement where = benchgen::internal::PlaceWorker(
+        placement.nodes, worker_index, placement.pin_cpu);
+    auto bind_status = benchgen::internal::BindCurrentThread(where.cpus);
+    if (!bind_status.ok()) {
+      std::cerr << "Failed to place worker " << worker_index << ": "
+                << bind_status.ToString() << "\n";
+      return 1;
+    }
+    result->numa_node = where.node;
+  }
+  // Library code (shared caches, the io_uring writer) records lock and I/O
+  // waits into the thread's current buffer.
+  benchgen::internal::TraceBuffer* trace_buffer = nullptr;
+  if (trace) {
+    std::string thread_name = "worker " + std::to_string(worker_index);
+    if (result->numa_node >= 0) {
+      thread_name += " (node " + std::to_string(result->numa_node) + ")";
+    }
+    trace_buffer = trace->AddThread(worker_index + 1, std::move(thread_name));
+  }
+  benchgen::internal::TraceBuffer::ThreadScope trace_scope(trace_buffer);
+
+  using Clock = std::chrono::steady_clock;
+  auto seconds_since = [](Clock::time_point from) {
+    return std::chrono::duration<double>(Clock::now() - from).count();
+  };
+  const auto started = Clock::now();
+  benchgen::internal::WorkerStats& stats = result->stats;
+  stats.worker_index = worker_index;
+  stats.numa_node = result->numa_node;
+  stats.start_row = args.start_row;
+  stats.row_count = args.row_count;
+
+  benchgen::GeneratorOptions options;
+  options.scale_factor = args.scale_factor;
+  options.chunk_size = args.chunk_size;
+  options.chunk_bytes = args.chunk_bytes;
+  options.start_row = args.start_row;
+  options.row_count = args.row_count;
+  options.seed_mode = args.seed_mode;
+  if (args.sample_every > 0) {
+    options.sample_mode = benchgen::SampleMode::kSystematic;
+    options.sample_interval = args.sample_every;
+  } else if (args.sample_fraction > 0.0) {
+    options.sample_mode = benchgen::SampleMode::kBernoulli;
+    options.sample_fraction = args.sample_fraction;
+  }
+  options.sample_seed = static_cast<uint64_t>(args.sample_seed);
+  options.sold_date_min_sk = args.sold_date_min_sk;
+  options.sold_date_max_sk = args.sold_date_max_sk;
+  // RunRefreshStreams hands each task the single stream it writes.
+  options.refresh_stream = static_cast<int32_t>(args.refresh_streams);
+
+  std::unique_ptr<benchgen::RecordBatchIterator> iterator;
+  auto phase_started = Clock::now();
+  arrow::Status status;
+  {
+    benchgen::internal::TraceSpan span("create iterator", "setup");
+    status = suite.MakeIterator(args.table, options, &iterator);
+  }
+  if (!status.ok()) {
+    std::cerr << "Failed to create generator: " << status.ToString() << "\n";
+    return 1;
+  }
+  stats.make_iterator_seconds = seconds_since(phase_started);
+
+  StreamOutput stream_output;
+  std::unique_ptr<benchgen::internal::RecordBatchSink> sink;
+  std::vector<ChecksumReport> checksums;
+  std::string error;
+  const bool made_sink =
+      args.sinks.empty()
+          ? MakeOutputSink(args, config, iterator->schema(), worker_index,
+                           &stream_output, &sink, &error)
+          : MakeSinkOutputs(args, config, iterator->schema(), &sink,
+                            &checksums, &error);
+  if (!made_sink) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+  const benchgen::internal::TimedStreambuf* timed = stream_output.timed.get();
+  stats.write_timed = timed != nullptr;
+
+  std::shared_ptr<arrow::RecordBatch> batch;
+  int64_t rows_written = 0;
+  while (true) {
+    phase_started = Clock::now();
+    {
+      benchgen::internal::TraceSpan span(
+          stats.batches == 0 ? "first batch" : "generate", "generate");
+      status = iterator->Next(&batch);
+      if (status.ok() && batch) {
+        span.set_rows(batch->num_rows());
+      }
+    }
+    if (!status.ok()) {
+      std::cerr << "Error generating batch: " << status.ToString() << "\n";
+      return 1;
+    }
+    (stats.batches == 0 ? stats.first_batch_seconds : stats.generate_seconds) +=
+        seconds_since(phase_started);
+    if (!batch) {
+      break;
+    }
+    ++stats.batches;
+    rows_written += batch->num_rows();
+
+    const double write_before = timed ? timed->write_seconds() : 0.0;
+    const int64_t trace_started = trace_buffer ? trace_buffer->NowNs() : 0;
+    phase_started = Clock::now();
+    status = sink->Write(batch);
+    if (!status.ok()) {
+      std::cerr << "Error writing batch: " << status.ToString() << "\n";
+      return 1;
+    }
+    const double write_delta = timed ? timed->write_seconds() - write_before
+                                     : 0.0;
+    stats.format_seconds += seconds_since(phase_started) - write_delta;
+    stats.write_seconds += write_delta;
+    if (trace_buffer) {
+      // Writes happen in 64 KiB flushes interleaved with formatting; the
+      // trace shows their total as one span at the end of the batch.
+      const int64_t trace_ended = trace_buffer->NowNs();
+      if (timed) {
+        const int64_t write_ns = static_cast<int64_t>(write_delta * 1e9);
+        trace_buffer->Add("format", "format", trace_started,
+                          trace_ended - write_ns, batch->num_rows());
+        trace_buffer->Add("write", "write", trace_ended - write_ns,
+                          trace_ended);
+      } else {
+        trace_buffer->Add("format and write", "format", trace_started,
+                          trace_ended, batch->num_rows());
+      }
+    }
+
+    stats.timeline.Update(seconds_since(started), rows_written);
+    if (progress) {
+      progress->rows.store(rows_written, std::memory_order_relaxed);
+      if (timed) {
+        progress->bytes.store(timed->bytes(), std::memory_order_relaxed);
+      }
+    }
+  }
+  phase_started = Clock::now();
+  {
+    benchgen::internal::TraceSpan span("close", "write");
+    status = sink->Close();
+    if (status.ok() && !stream_output.Close()) {
+      status = arrow::Status::IOError("Error writing output");
+    }
+  }
+  if (!status.ok()) {
+    std::cerr << "Error closing output: " << status.ToString() << "\n";
+    return 1;
+  }
+  stats.close_seconds = seconds_since(phase_started);
+  if (!ReportChecksums(checksums, args.table, worker_index, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+
+  result->rows = rows_written;
+  result->seconds = seconds_since(started);
+  stats.rows = rows_written;
+  stats.bytes = timed ? timed->bytes() : -1;
+  stats.total_seconds = result->seconds;
+  stats.timeline.Finish(result->seconds, rows_written);
+  if (progress) {
+    progress->rows.store(rows_written, std::memory_order_relaxed);
+    if (timed) {
+      progress->bytes.store(timed->bytes(), std::memory_order_relaxed);
+    }
+  }
+  if (!args.manifest.empty() &&
+      !CollectOutputFiles(args, *sink, rows_written, &result->files,
+                          &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+int RunSuiteGenTableParallel(
+    const benchgen::BenchmarkSuite& suite,
+    const benchgen::cli::GenTableArgs& args, const SuiteConfig& config,
+    const std::vector<ParallelRange>& ranges,
+    const PlacementConfig& placement, std::vector<WorkerResult>* results,
+    std::vector<benchgen::internal::WorkerProgress>* progress,
+    benchgen::internal::TraceRecorder* trace) {
+  if (args.output.empty() && args.sinks.empty()) {
+    std::cerr << "Output path is required for parallel generation\n";
+    return 1;
+  }
+
+  std::vector<std::string> part_paths;
+  part_paths.reserve(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    part_paths.push_back(
+        BuildParallelOutputPath(args.output, static_cast<int64_t>(i)));
+  }
+
+  std::atomic<bool> failed(false);
+  std::mutex mutex;
+  int status = 0;
+  std::string status_message;
+
+  auto worker = [&](size_t index) {
+    if (failed.load()) {
+      return;
+    }
+    benchgen::cli::GenTableArgs part_args = args;
+    part_args.start_row = ranges[index].start_row;
+    part_args.row_count = ranges[index].row_count;
+    // Directory and rolling sinks derive per-worker names themselves.
+    if (!args.sinks.empty()) {
+      for (auto& sink : part_args.sinks) {
+        sink = WorkerSinkSpec(sink, static_cast<int64_t>(index));
+      }
+    } else if (args.partition_by.empty() && args.bucket_by.empty() &&
+               !IsRollingOutput(args)) {
+      part_args.output = part_paths[index];
+    }
+    part_args.parallel = 1;
+
+    int result = RunSuiteGenTable(suite, part_args, config,
+                                  static_cast<int64_t>(index), placement,
+                                  &(*results)[index], &(*progress)[index],
+                                  trace);
+    if (result != 0) {
+      failed.store(true);
+      std::lock_guard<std::mutex> lock(mutex);
+      if (status == 0) {
+        status = result;
+        status_message =
+            "Parallel worker failed for part " + std::to_string(index);
+      }
+    }
+  };
+
+  results->assign(ranges.size(), WorkerResult());
+  std::vector<std::thread> threads;
+  threads.reserve(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    threads.emplace_back(worker, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
   }
 
   if (status != 0) {
@@ -545,6 +1603,391 @@ int RunSuiteGenTableParallel(const benchgen::BenchmarkSuite& suite,
   return 0;
 }
 
+// Rows the run is expected to emit, for progress percentages; -1 when the
+// table size is unknown or rows are sampled.
+int64_t ExpectedRows(const benchgen::BenchmarkSuite& suite,
+                     const benchgen::cli::GenTableArgs& args) {
+  if (args.sample_every > 0 || args.sample_fraction > 0.0) {
+    return -1;
+  }
+  if (args.row_count >= 0) {
+    return args.row_count;
+  }
+  int64_t total_rows = 0;
+  bool known = false;
+  if (!ResolveTableRowCount(suite, args, &total_rows, &known, nullptr) ||
+      !known) {
+    return -1;
+  }
+  return std::max<int64_t>(total_rows - args.start_row, 0);
+}
+
+struct RefreshTask {
+  int64_t stream = 0;
+  std::string table;
+  std::string output;
+};
+
+// The RF1/RF2 files of TPC-H update streams 1..refresh_streams.
+bool MakeTpchRefreshTasks(const benchgen::BenchmarkSuite& suite,
+                          const benchgen::cli::GenTableArgs& args,
+                          std::vector<RefreshTask>* tasks) {
+  const std::string orders(
+      benchgen::tpch::TableIdToString(benchgen::tpch::TableId::kOrders));
+  const std::string lineitem(
+      benchgen::tpch::TableIdToString(benchgen::tpch::TableId::kLineItem));
+  const std::string deletes = "delete";
+  if (!args.table.empty() && args.table != orders && args.table != lineitem &&
+      args.table != deletes) {
+    std::cerr << "--refresh-stream only writes orders, lineitem and delete\n";
+    return false;
+  }
+
+  // Stream n deletes the base orders its inserts are generated from, so
+  // the streams must fit in the base table.
+  benchgen::GeneratorOptions options;
+  options.scale_factor = args.scale_factor;
+  int64_t base_orders = 0;
+  int64_t stream_orders = 0;
+  bool known = false;
+  auto status =
+      suite.ResolveTableRowCount(orders, options, &base_orders, &known);
+  if (status.ok()) {
+    options.refresh_stream = 1;
+    status =
+        suite.ResolveTableRowCount(orders, options, &stream_orders, &known);
+  }
+  if (!status.ok()) {
+    std::cerr << status.ToString() << "\n";
+    return false;
+  }
+  if (args.refresh_streams * stream_orders > base_orders) {
+    std::cerr << "At most " << base_orders / stream_orders
+              << " refresh streams fit in the orders table at this scale\n";
+    return false;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(args.output, ec);
+  if (ec) {
+    std::cerr << "Failed to create output directory " << args.output << ": "
+              << ec.message() << "\n";
+    return false;
+  }
+  const std::filesystem::path dir(args.output);
+  for (int64_t stream = 1; stream <= args.refresh_streams; ++stream) {
+    const std::string suffix = std::to_string(stream);
+    if (args.table.empty() || args.table == orders) {
+      tasks->push_back(
+          {stream, orders, (dir / (orders + ".tbl.u" + suffix)).string()});
+    }
+    if (args.table.empty() || args.table == lineitem) {
+      tasks->push_back(
+          {stream, lineitem, (dir / (lineitem + ".tbl.u" + suffix)).string()});
+    }
+    if (args.table.empty() || args.table == deletes) {
+      tasks->push_back(
+          {stream, deletes, (dir / (deletes + "." + suffix)).string()});
+    }
+  }
+
+  return true;
+}
+
+// The approximate TPC-DS fact sources for runs 1..refresh_streams, named
+// like `dsdgen -update` names them: <output>/<table>_<n>.dat.
+bool MakeTpcdsRefreshTasks(const benchgen::cli::GenTableArgs& args,
+                           std::vector<RefreshTask>* tasks) {
+  benchgen::tpcds::RefreshTableId only;
+  if (!args.table.empty() &&
+      !benchgen::tpcds::RefreshTableIdFromString(args.table, &only)) {
+    std::cerr << "--refresh-stream only writes the approximate tpcds "
+                 "fact sources (s_purchase, s_purchase_lineitem, "
+                 "s_catalog_order, s_catalog_order_lineitem, s_web_order, "
+                 "s_web_order_lineitem, s_store_returns, "
+                 "s_catalog_returns, s_web_returns, s_inventory, delete and "
+                 "inventory_delete)\n";
+    return false;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(args.output, ec);
+  if (ec) {
+    std::cerr << "Failed to create output directory " << args.output << ": "
+              << ec.message() << "\n";
+    return false;
+  }
+  const std::filesystem::path dir(args.output);
+  const int table_count =
+      static_cast<int>(benchgen::tpcds::RefreshTableId::kTableCount);
+  for (int64_t stream = 1; stream <= args.refresh_streams; ++stream) {
+    for (int i = 0; i < table_count; ++i) {
+      auto table = static_cast<benchgen::tpcds::RefreshTableId>(i);
+      if (!args.table.empty() && table != only) {
+        continue;
+      }
+      std::string name(benchgen::tpcds::RefreshTableIdToString(table));
+      tasks->push_back(
+          {stream, name,
+           (dir / (name + "_" + std::to_string(stream) + ".dat")).string()});
+    }
+  }
+  return true;
+}
+
+// Writes TPC-H update streams 1..refresh_streams like `dbgen -U`: the RF1
+// inserts to <output>/orders.tbl.u<n> and lineitem.tbl.u<n> and the RF2
+// delete keys to <output>/delete.<n>. For TPC-DS it writes approximate
+// fact sources for runs 1..refresh_streams instead. The files
+// are independent, so --parallel workers take them from a shared queue.
+int RunRefreshStreams(const benchgen::BenchmarkSuite& suite,
+                      const benchgen::cli::GenTableArgs& args,
+                      const SuiteConfig& config) {
+  if (suite.suite_id() != benchgen::SuiteId::kTpch &&
+      suite.suite_id() != benchgen::SuiteId::kTpcds) {
+    std::cerr << "--refresh-stream is only supported for tpch and tpcds\n";
+    return 1;
+  }
+  if (args.output.empty()) {
+    std::cerr << "--refresh-stream requires --output (the directory)\n";
+    return 1;
+  }
+  if (args.start_row != 0 || args.row_count >= 0 || args.sample_every > 0 ||
+      args.sample_fraction > 0.0 || !args.partition_by.empty() ||
+      !args.bucket_by.empty() || IsRollingOutput(args) ||
+      args.node_count > 1 || !args.manifest.empty() || !args.stats.empty() ||
+      !args.trace.empty() || args.progress || !args.sinks.empty() ||
+      IsColumnarRaw(args)) {
+    std::cerr << "--refresh-stream only combines with --table, --scale, "
+                 "--chunk-size, --chunk-bytes, --dbgen-seed-mode, "
+                 "--parallel, placement and --writer options\n";
+    return 1;
+  }
+  std::string error;
+  if (!ValidateSuiteArgs(suite, args, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+
+  std::vector<RefreshTask> tasks;
+  const bool ok = suite.suite_id() == benchgen::SuiteId::kTpcds
+                      ? MakeTpcdsRefreshTasks(args, &tasks)
+                      : MakeTpchRefreshTasks(suite, args, &tasks);
+  if (!ok) {
+    return 1;
+  }
+
+  PlacementConfig placement;
+  if (!ResolvePlacement(args, &placement, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+
+  std::atomic<size_t> next_task(0);
+  std::atomic<bool> failed(false);
+  auto worker = [&](int64_t worker_index) {
+    for (size_t index = next_task.fetch_add(1);
+         index < tasks.size() && !failed.load();
+         index = next_task.fetch_add(1)) {
+      const RefreshTask& task = tasks[index];
+      benchgen::cli::GenTableArgs task_args = args;
+      task_args.table = task.table;
+      task_args.output = task.output;
+      task_args.parallel = 1;
+      task_args.refresh_streams = task.stream;
+      WorkerResult result;
+      benchgen::internal::WorkerProgress progress;
+      if (RunSuiteGenTable(suite, task_args, config, worker_index, placement,
+                           &result, &progress, nullptr) != 0) {
+        std::cerr << "Failed to write " << task.output << "\n";
+        failed.store(true);
+      }
+    }
+  };
+
+  const int64_t workers =
+      std::min<int64_t>(args.parallel, static_cast<int64_t>(tasks.size()));
+  std::vector<std::thread> threads;
+  for (int64_t i = 1; i < workers; ++i) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return failed.load() ? 1 : 0;
+}
+
+std::vector<std::string> SplitTableList(const std::string& tables) {
+  std::vector<std::string> names;
+  size_t begin = 0;
+  while (begin <= tables.size()) {
+    size_t end = tables.find(',', begin);
+    if (end == std::string::npos) {
+      end = tables.size();
+    }
+    names.push_back(tables.substr(begin, end - begin));
+    begin = end + 1;
+  }
+  return names;
+}
+
+// Writes the tables of a comma separated --table list from one pass of a
+// co-generating iterator (TPC-H part,partsupp) to <output>/<table>.<ext>.
+// Row ranges, --parallel and --node-index split the first table's rows;
+// parallel workers write <table>-<worker>.<ext>.
+int RunCoGeneratedTables(const benchgen::BenchmarkSuite& suite,
+                         const benchgen::cli::GenTableArgs& args,
+                         const SuiteConfig& config) {
+  const std::vector<std::string> tables = SplitTableList(args.table);
+  if (args.output.empty()) {
+    std::cerr << "--table " << args.table
+              << " requires --output (the directory)\n";
+    return 1;
+  }
+  if (args.sample_every > 0 || args.sample_fraction > 0.0 ||
+      !args.partition_by.empty() || !args.bucket_by.empty() ||
+      IsRollingOutput(args) || !args.manifest.empty() ||
+      !args.stats.empty() || !args.trace.empty() || args.progress ||
+      !args.numa_nodes.empty() || args.pin_threads || !args.sinks.empty()) {
+    std::cerr << "Several --table names only combine with --scale, "
+                 "--chunk-size, --chunk-bytes, --start-row, --row-count, "
+                 "--dbgen-seed-mode, --parallel, --node-index/--node-count "
+                 "and --writer options\n";
+    return 1;
+  }
+
+  std::string error;
+  if (!ValidateSuiteArgs(suite, args, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+
+  // Row ranges count rows of the driving table (part), whatever the order
+  // of --table.
+  benchgen::GeneratorOptions probe_options;
+  probe_options.scale_factor = args.scale_factor;
+  probe_options.chunk_size = args.chunk_size;
+  probe_options.seed_mode = args.seed_mode;
+  std::unique_ptr<benchgen::MultiRecordBatchIterator> probe;
+  auto probe_status = benchgen::MakeMultiRecordBatchIterator(
+      suite.suite_id(), tables, probe_options, &probe);
+  if (!probe_status.ok()) {
+    std::cerr << "Failed to create generator: " << probe_status.ToString()
+              << "\n";
+    return 1;
+  }
+  benchgen::cli::GenTableArgs range_args = args;
+  range_args.table = std::string(probe->name(probe->driving_table()));
+  probe.reset();
+  int64_t total_rows = -1;
+  if (args.node_count > 1 &&
+      !ResolveNodeRange(suite, &range_args, &total_rows, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+  std::vector<ParallelRange> ranges;
+  if (!ResolveParallelRanges(suite, range_args, &ranges, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+  const bool parallel = !ranges.empty();
+  if (!parallel) {
+    ranges.push_back({range_args.start_row, range_args.row_count});
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(args.output, ec);
+  if (ec) {
+    std::cerr << "Failed to create output directory " << args.output << ": "
+              << ec.message() << "\n";
+    return 1;
+  }
+
+  std::atomic<bool> failed(false);
+  auto worker = [&](size_t index) {
+    auto fail = [&](const std::string& message) {
+      std::cerr << message << "\n";
+      failed.store(true);
+    };
+    benchgen::GeneratorOptions options;
+    options.scale_factor = args.scale_factor;
+    options.chunk_size = args.chunk_size;
+    options.chunk_bytes = args.chunk_bytes;
+    options.start_row = ranges[index].start_row;
+    options.row_count = ranges[index].row_count;
+    options.seed_mode = args.seed_mode;
+    std::unique_ptr<benchgen::MultiRecordBatchIterator> iterator;
+    auto status = benchgen::MakeMultiRecordBatchIterator(
+        suite.suite_id(), tables, options, &iterator);
+    if (!status.ok()) {
+      fail("Failed to create generator: " + status.ToString());
+      return;
+    }
+
+    const int table_count = iterator->table_count();
+    std::vector<StreamOutput> outputs(static_cast<size_t>(table_count));
+    std::vector<std::unique_ptr<benchgen::internal::RecordBatchSink>> sinks(
+        static_cast<size_t>(table_count));
+    for (int t = 0; t < table_count; ++t) {
+      benchgen::cli::GenTableArgs table_args = args;
+      // columnar-raw writes a directory per table.
+      std::string table_name(iterator->name(t));
+      if (!IsColumnarRaw(args)) {
+        table_name += "." + config.file_extension;
+      }
+      table_args.output =
+          (std::filesystem::path(args.output) / table_name).string();
+      if (parallel) {
+        table_args.output = BuildParallelOutputPath(
+            table_args.output, static_cast<int64_t>(index));
+      }
+      if (!MakeOutputSink(table_args, config, iterator->schema(t),
+                          static_cast<int64_t>(index), &outputs[t], &sinks[t],
+                          &error)) {
+        fail(error);
+        return;
+      }
+    }
+
+    std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+    while (!failed.load()) {
+      status = iterator->Next(&batches);
+      if (!status.ok()) {
+        fail("Error generating batch: " + status.ToString());
+        return;
+      }
+      if (batches.empty()) {
+        break;
+      }
+      for (int t = 0; t < table_count; ++t) {
+        status = sinks[t]->Write(batches[t]);
+        if (!status.ok()) {
+          fail("Error writing batch: " + status.ToString());
+          return;
+        }
+      }
+    }
+    for (int t = 0; t < table_count; ++t) {
+      status = sinks[t]->Close();
+      if (!status.ok() || !outputs[t].Close()) {
+        fail("Error closing output for " + std::string(iterator->name(t)));
+        return;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    threads.emplace_back(worker, i);
+  }
+  worker(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return failed.load() ? 1 : 0;
+}
+
 int RunSuiteWithConfig(const benchgen::BenchmarkSuite& suite,
                        const benchgen::cli::GenTableArgs& args) {
   SuiteConfig config;
@@ -553,7 +1996,13 @@ int RunSuiteWithConfig(const benchgen::BenchmarkSuite& suite,
     std::cerr << error << "\n";
     return 1;
   }
-  if (config.require_output && args.output.empty()) {
+  if (args.refresh_streams > 0) {
+    return RunRefreshStreams(suite, args, config);
+  }
+  if (args.table.find(',') != std::string::npos) {
+    return RunCoGeneratedTables(suite, args, config);
+  }
+  if (config.require_output && args.output.empty() && args.sinks.empty()) {
     std::cerr << "Output path is required\n";
     return 1;
   }
@@ -561,20 +2010,191 @@ int RunSuiteWithConfig(const benchgen::BenchmarkSuite& suite,
     std::cerr << error << "\n";
     return 1;
   }
+  benchgen::cli::GenTableArgs node_args = args;
+  int64_t total_rows = -1;
+  if ((args.node_count > 1 || !args.manifest.empty()) &&
+      !ResolveNodeRange(suite, &node_args, &total_rows, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
   std::vector<ParallelRange> ranges;
-  if (!ResolveParallelRanges(suite, args, &ranges, &error)) {
+  if (!ResolveParallelRanges(suite, node_args, &ranges, &error)) {
+    std::cerr << error << "\n";
+    return 1;
+  }
+
+  PlacementConfig placement;
+  if (!ResolvePlacement(args, &placement, &error)) {
     std::cerr << error << "\n";
     return 1;
   }
-  if (!ranges.empty()) {
-    return RunSuiteGenTableParallel(suite, args, config, ranges);
+
+  const bool parallel = !ranges.empty();
+  std::vector<benchgen::internal::WorkerProgress> progress(
+      parallel ? ranges.size() : 1);
+  std::unique_ptr<benchgen::internal::ProgressReporter> reporter;
+  if (args.progress) {
+    reporter = std::make_unique<benchgen::internal::ProgressReporter>(
+        std::string(benchgen::SuiteIdToString(suite.suite_id())) + "." +
+            args.table,
+        ExpectedRows(suite, node_args), &progress,
+        std::chrono::seconds(5));
+    reporter->Start();
+  }
+
+  std::unique_ptr<benchgen::internal::TraceRecorder> trace;
+  if (!args.trace.empty()) {
+    trace = std::make_unique<benchgen::internal::TraceRecorder>(
+        "benchgen " + std::string(benchgen::SuiteIdToString(suite.suite_id())) +
+        "." + args.table);
+  }
+
+  const auto started = std::chrono::steady_clock::now();
+  std::vector<WorkerResult> results;
+  int result = 0;
+  if (parallel) {
+    result = RunSuiteGenTableParallel(suite, node_args, config, ranges,
+                                      placement, &results, &progress,
+                                      trace.get());
+  } else {
+    ranges.push_back({node_args.start_row, node_args.row_count});
+    results.resize(1);
+    result = RunSuiteGenTable(suite, node_args, config, 0, placement,
+                              &results[0], &progress[0], trace.get());
+  }
+  const double wall_seconds = std::chrono::duration<double>(
+                                  std::chrono::steady_clock::now() - started)
+                                  .count();
+  if (reporter) {
+    reporter->Stop();
+  }
+  if (result != 0) {
+    return result;
+  }
+  if (!placement.nodes.empty()) {
+    PrintPlacementReport(results);
+  }
+  if (trace) {
+    auto status = trace->Write(args.trace);
+    if (!status.ok()) {
+      std::cerr << status.ToString() << "\n";
+      return 1;
+    }
+  }
+  if (!args.stats.empty()) {
+    benchgen::internal::RunStats stats;
+    stats.benchmark = benchgen::SuiteIdToString(suite.suite_id());
+    stats.table = args.table;
+    stats.scale_factor = args.scale_factor;
+    stats.node_index = args.node_index;
+    stats.node_count = args.node_count;
+    stats.wall_seconds = wall_seconds;
+    for (WorkerResult& worker : results) {
+      stats.workers.push_back(std::move(worker.stats));
+    }
+    auto status = benchgen::internal::WriteRunStats(args.stats, stats);
+    if (!status.ok()) {
+      std::cerr << status.ToString() << "\n";
+      return 1;
+    }
   }
-  return RunSuiteGenTable(suite, args, config);
+  if (args.manifest.empty()) {
+    return 0;
+  }
+
+  benchgen::internal::GenerationManifest manifest;
+  manifest.benchmark = benchgen::SuiteIdToString(suite.suite_id());
+  manifest.table = args.table;
+  manifest.scale_factor = args.scale_factor;
+  manifest.node_index = args.node_index;
+  manifest.node_count = args.node_count;
+  manifest.total_rows = total_rows;
+  manifest.table_start_row = args.start_row;
+  manifest.table_row_count = args.row_count;
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    benchgen::internal::ManifestRange range;
+    range.start_row = ranges[i].start_row;
+    range.row_count = ranges[i].row_count;
+    range.files = std::move(results[i].files);
+    manifest.ranges.push_back(std::move(range));
+  }
+  auto status =
+      benchgen::internal::WriteGenerationManifest(args.manifest, manifest);
+  if (!status.ok()) {
+    std::cerr << status.ToString() << "\n";
+    return 1;
+  }
+  return 0;
+}
+
+int RunMergeManifests(int argc, char** argv) {
+  bool verify_files = false;
+  std::string output;
+  std::vector<std::string> inputs;
+  for (int i = 2; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--verify-files") {
+      verify_files = true;
+    } else if (arg == "--output" || arg == "-o") {
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for --output\n";
+        return 1;
+      }
+      output = argv[++i];
+    } else if (IsHelpArg(arg)) {
+      PrintUsage(argv[0]);
+      return 0;
+    } else {
+      inputs.push_back(arg);
+    }
+  }
+  if (inputs.empty()) {
+    std::cerr << "merge-manifests requires at least one manifest\n";
+    PrintUsage(argv[0]);
+    return 1;
+  }
+
+  std::vector<benchgen::internal::GenerationManifest> manifests(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    auto status =
+        benchgen::internal::ReadGenerationManifest(inputs[i], &manifests[i]);
+    if (!status.ok()) {
+      std::cerr << status.ToString() << "\n";
+      return 1;
+    }
+  }
+  auto status = benchgen::internal::VerifyManifestCoverage(manifests);
+  if (!status.ok()) {
+    std::cerr << "Manifests do not cover the table exactly once: "
+              << status.message() << "\n";
+    return 1;
+  }
+  if (verify_files) {
+    for (const auto& manifest : manifests) {
+      status = benchgen::internal::VerifyManifestFiles(manifest);
+      if (!status.ok()) {
+        std::cerr << status.message() << "\n";
+        return 1;
+      }
+    }
+  }
+  if (!output.empty()) {
+    status = benchgen::internal::WriteGenerationManifest(
+        output, benchgen::internal::MergeManifests(manifests));
+    if (!status.ok()) {
+      std::cerr << status.ToString() << "\n";
+      return 1;
+    }
+  }
+  return 0;
 }
 
 }  // namespace
 
 int main(int argc, char** argv) {
+  if (argc > 1 && std::string(argv[1]) == "merge-manifests") {
+    return RunMergeManifests(argc, argv);
+  }
   bool show_help = HasHelpArg(argc, argv);
   std::string error;
   benchgen::SuiteId benchmark = ResolveBenchmark(argc, argv, &error);
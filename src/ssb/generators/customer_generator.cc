@@ -24,6 +24,7 @@
 #include "benchgen/generator_options.h"
 #include "benchgen/table.h"
 #include "generators/customer_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 #include "utils/scaling.h"
 
@@ -70,29 +71,38 @@ struct CustomerGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
 
     total_rows_ = internal::RowCount(TableId::kCustomer, options_.scale_factor);
     if (total_rows_ < 0) {
       return arrow::Status::Invalid("failed to compute row count for customer");
     }
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
       return arrow::Status::OK();
     }
-
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-
-    row_generator_.SkipRows(options_.start_row);
     return arrow::Status::OK();
   }
 
@@ -102,6 +112,7 @@ struct CustomerGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::CustomerRowGenerator row_generator_;
 };
 
@@ -122,6 +133,10 @@ std::shared_ptr<arrow::Schema> CustomerGenerator::schema() const {
   return impl_->schema_;
 }
 
+arrow::Status CustomerGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CustomerGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -130,7 +145,7 @@ arrow::Status CustomerGenerator::Next(
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder c_custkey(pool);
@@ -191,8 +206,10 @@ arrow::Status CustomerGenerator::Next(
   SSB_RETURN_NOT_OK(c_mktsegment.Finish(&array));
   columns.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows,
-                                                  std::move(columns), out);
+  SSB_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 }  // namespace benchgen::ssb
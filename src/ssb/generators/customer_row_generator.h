@@ -31,6 +31,8 @@ class CustomerRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   void GenerateRow(int64_t row_number, customer_t* out);
 
  private:
@@ -39,6 +41,7 @@ class CustomerRowGenerator {
   bool initialized_ = false;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::ssb::internal
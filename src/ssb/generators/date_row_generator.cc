@@ -38,10 +38,15 @@ arrow::Status DateRowGenerator::Init() {
       return status;
     }
   }
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void DateRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void DateRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
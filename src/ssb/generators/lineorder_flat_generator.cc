@@ -0,0 +1,517 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/lineorder_flat_generator.h"
+
+#include <arrow/array/concatenate.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/generator_options.h"
+#include "benchgen/table.h"
+#include "generators/customer_generator.h"
+#include "generators/lineorder_row_generator.h"
+#include "generators/part_generator.h"
+#include "generators/supplier_generator.h"
+#include "util/batch_sizer.h"
+#include "util/column_selection.h"
+#include "util/trace.h"
+
+namespace benchgen::ssb {
+namespace {
+
+#define SSB_RETURN_NOT_OK(status)       \
+  do {                                  \
+    ::arrow::Status _status = (status); \
+    if (!_status.ok()) {                \
+      return _status;                   \
+    }                                   \
+  } while (false)
+
+// The dimension columns copied into every row, in schema order, after the
+// lineorder columns. Index 0..2 is also the order of the keys gathered per
+// batch: lo_custkey, lo_suppkey, lo_partkey.
+struct DimensionSpec {
+  TableId table;
+  std::vector<std::string> columns;
+};
+
+constexpr size_t kDimensionCount = 3;
+constexpr int kLineorderColumnCount = 17;
+constexpr int64_t kDimensionChunkRows = 65536;
+
+const std::array<DimensionSpec, kDimensionCount>& DimensionSpecs() {
+  static const std::array<DimensionSpec, kDimensionCount> specs = {{
+      {TableId::kCustomer,
+       {"c_name", "c_address", "c_city", "c_nation", "c_region", "c_phone",
+        "c_mktsegment"}},
+      {TableId::kSupplier,
+       {"s_name", "s_address", "s_city", "s_nation", "s_region", "s_phone"}},
+      {TableId::kPart,
+       {"p_name", "p_mfgr", "p_category", "p_brand", "p_color", "p_type",
+        "p_size", "p_container"}},
+  }};
+  return specs;
+}
+
+std::shared_ptr<arrow::Schema> BuildLineorderFlatSchema() {
+  std::vector<std::shared_ptr<arrow::Field>> fields = {
+      arrow::field("lo_orderkey", arrow::int64(), false),
+      arrow::field("lo_linenumber", arrow::int32(), false),
+      arrow::field("lo_custkey", arrow::int64(), false),
+      arrow::field("lo_partkey", arrow::int64(), false),
+      arrow::field("lo_suppkey", arrow::int64(), false),
+      arrow::field("lo_orderdate", arrow::utf8(), false),
+      arrow::field("lo_orderpriority", arrow::utf8(), false),
+      arrow::field("lo_shippriority", arrow::int32(), false),
+      arrow::field("lo_quantity", arrow::int32(), false),
+      arrow::field("lo_extendedprice", arrow::int64(), false),
+      arrow::field("lo_order_totalprice", arrow::int64(), false),
+      arrow::field("lo_discount", arrow::int32(), false),
+      arrow::field("lo_revenue", arrow::int64(), false),
+      arrow::field("lo_supplycost", arrow::int64(), false),
+      arrow::field("lo_tax", arrow::int32(), false),
+      arrow::field("lo_commitdate", arrow::utf8(), false),
+      arrow::field("lo_shipmode", arrow::utf8(), false),
+  };
+  for (const auto& spec : DimensionSpecs()) {
+    for (const auto& column : spec.columns) {
+      fields.push_back(arrow::field(
+          column, column == "p_size" ? arrow::int32() : arrow::utf8(),
+          false));
+    }
+  }
+  return arrow::schema(std::move(fields));
+}
+
+// dbgen order priority strings are at most 15 characters.
+constexpr int32_t kDbgenOrderPriorityLen = 15;
+
+// A dimension's copied columns as single arrays, so key k is row k - 1.
+struct DimensionColumns {
+  int64_t rows = 0;
+  std::vector<std::shared_ptr<arrow::Array>> columns;
+};
+
+template <typename Generator>
+arrow::Status OpenDimension(GeneratorOptions options,
+                            std::unique_ptr<RecordBatchIterator>* out) {
+  auto iter = std::make_unique<Generator>(std::move(options));
+  SSB_RETURN_NOT_OK(iter->Init());
+  *out = std::move(iter);
+  return arrow::Status::OK();
+}
+
+arrow::Status LoadDimension(const DimensionSpec& spec,
+                            const GeneratorOptions& flat_options,
+                            DimensionColumns* out) {
+  GeneratorOptions options;
+  options.scale_factor = flat_options.scale_factor;
+  options.seed_mode = flat_options.seed_mode;
+  options.chunk_size = kDimensionChunkRows;
+  options.column_names = spec.columns;
+
+  std::unique_ptr<RecordBatchIterator> iter;
+  switch (spec.table) {
+    case TableId::kCustomer:
+      SSB_RETURN_NOT_OK(OpenDimension<CustomerGenerator>(options, &iter));
+      break;
+    case TableId::kSupplier:
+      SSB_RETURN_NOT_OK(OpenDimension<SupplierGenerator>(options, &iter));
+      break;
+    case TableId::kPart:
+      SSB_RETURN_NOT_OK(OpenDimension<PartGenerator>(options, &iter));
+      break;
+    default:
+      return arrow::Status::Invalid("lineorder_flat does not copy table ",
+                                    std::string(TableIdToString(spec.table)));
+  }
+
+  std::vector<arrow::ArrayVector> chunks(spec.columns.size());
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    SSB_RETURN_NOT_OK(iter->Next(&batch));
+    if (!batch) {
+      break;
+    }
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      chunks[i].push_back(batch->column(static_cast<int>(i)));
+    }
+    out->rows += batch->num_rows();
+  }
+  if (out->rows == 0) {
+    return arrow::Status::Invalid("SSB table ",
+                                  std::string(TableIdToString(spec.table)),
+                                  " has no rows");
+  }
+  for (const auto& column_chunks : chunks) {
+    ARROW_ASSIGN_OR_RAISE(auto column, arrow::Concatenate(column_chunks));
+    out->columns.push_back(std::move(column));
+  }
+  return arrow::Status::OK();
+}
+
+// Dimension arrays are shared by every lineorder_flat generator of the same
+// scale and seed mode, so parallel workers load each dimension once. They
+// stay cached for the life of the process.
+arrow::Status GetDimension(size_t index, const GeneratorOptions& options,
+                           std::shared_ptr<const DimensionColumns>* out) {
+  using Key = std::tuple<int64_t, int, size_t>;
+  static std::mutex mutex;
+  static std::map<Key, std::shared_ptr<const DimensionColumns>> cache;
+  Key key(std::llround(options.scale_factor * 1000.0),
+          static_cast<int>(options.seed_mode), index);
+
+  auto lock = benchgen::internal::TracedLock(mutex, "wait ssb dimensions");
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    *out = it->second;
+    return arrow::Status::OK();
+  }
+  benchgen::internal::TraceSpan span("load ssb dimension", "init");
+  auto dimension = std::make_shared<DimensionColumns>();
+  SSB_RETURN_NOT_OK(
+      LoadDimension(DimensionSpecs()[index], options, dimension.get()));
+  cache.emplace(key, dimension);
+  *out = std::move(dimension);
+  return arrow::Status::OK();
+}
+
+arrow::Status GatherColumn(const arrow::Array& values,
+                           const std::vector<int64_t>& keys,
+                           std::shared_ptr<arrow::Array>* out) {
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  const int64_t rows = static_cast<int64_t>(keys.size());
+  switch (values.type_id()) {
+    case arrow::Type::STRING: {
+      const auto& strings = static_cast<const arrow::StringArray&>(values);
+      arrow::StringBuilder builder(pool);
+      SSB_RETURN_NOT_OK(builder.Reserve(rows));
+      if (strings.length() > 0) {
+        SSB_RETURN_NOT_OK(builder.ReserveData(
+            strings.total_values_length() / strings.length() * rows));
+      }
+      for (int64_t key : keys) {
+        SSB_RETURN_NOT_OK(builder.Append(strings.GetView(key - 1)));
+      }
+      return builder.Finish(out);
+    }
+    case arrow::Type::INT32: {
+      const auto& ints = static_cast<const arrow::Int32Array&>(values);
+      arrow::Int32Builder builder(pool);
+      SSB_RETURN_NOT_OK(builder.Reserve(rows));
+      for (int64_t key : keys) {
+        builder.UnsafeAppend(ints.Value(key - 1));
+      }
+      return builder.Finish(out);
+    }
+    default:
+      return arrow::Status::NotImplemented(
+          "lineorder_flat cannot copy a column of type ",
+          values.type()->ToString());
+  }
+}
+
+}  // namespace
+
+struct LineorderFlatGenerator::Impl {
+  explicit Impl(GeneratorOptions options)
+      : options_(std::move(options)),
+        schema_(BuildLineorderFlatSchema()),
+        row_generator_(options_.scale_factor, options_.seed_mode) {}
+
+  arrow::Status Init() {
+    if (options_.chunk_size <= 0) {
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    SSB_RETURN_NOT_OK(row_generator_.Init());
+
+    auto status = column_selection_.Init(schema_, options_.column_names);
+    if (!status.ok()) {
+      return status;
+    }
+    selected_.assign(static_cast<size_t>(schema_->num_fields()),
+                     options_.column_names.empty());
+    for (const auto& name : options_.column_names) {
+      selected_[static_cast<size_t>(schema_->GetFieldIndex(name))] = true;
+    }
+    schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
+
+    if (row_count < 0) {
+      remaining_rows_ = -1;
+    } else {
+      remaining_rows_ = row_count;
+    }
+
+    return arrow::Status::OK();
+  }
+
+  // Loads the dimensions with a selected column on the first Next, so that
+  // opening the generator for its schema stays cheap.
+  arrow::Status LoadDimensions() {
+    if (dimensions_loaded_) {
+      return arrow::Status::OK();
+    }
+    size_t field = kLineorderColumnCount;
+    for (size_t d = 0; d < kDimensionCount; ++d) {
+      const auto& spec = DimensionSpecs()[d];
+      bool needed = false;
+      for (size_t c = 0; c < spec.columns.size(); ++c, ++field) {
+        needed = needed || selected_[field];
+      }
+      if (needed) {
+        SSB_RETURN_NOT_OK(GetDimension(d, options_, &dimensions_[d]));
+      }
+    }
+    dimensions_loaded_ = true;
+    return arrow::Status::OK();
+  }
+
+  GeneratorOptions options_;
+  int64_t remaining_rows_ = -1;
+  int64_t current_row_ = 0;
+  std::shared_ptr<arrow::Schema> schema_;
+  ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  internal::LineorderRowGenerator row_generator_;
+  // Indexed by full schema field.
+  std::vector<bool> selected_;
+  bool dimensions_loaded_ = false;
+  std::array<std::shared_ptr<const DimensionColumns>, kDimensionCount>
+      dimensions_;
+};
+
+LineorderFlatGenerator::LineorderFlatGenerator(GeneratorOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {}
+
+LineorderFlatGenerator::~LineorderFlatGenerator() = default;
+
+arrow::Status LineorderFlatGenerator::Init() { return impl_->Init(); }
+
+std::string_view LineorderFlatGenerator::name() const {
+  return TableIdToString(TableId::kLineorderFlat);
+}
+
+std::string_view LineorderFlatGenerator::suite_name() const { return "ssb"; }
+
+std::shared_ptr<arrow::Schema> LineorderFlatGenerator::schema() const {
+  return impl_->schema_;
+}
+
+arrow::Status LineorderFlatGenerator::Seek(int64_t start_row,
+                                           int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
+arrow::Status LineorderFlatGenerator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  if (impl_->remaining_rows_ == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+  SSB_RETURN_NOT_OK(impl_->LoadDimensions());
+
+  int64_t target_rows = impl_->batch_sizer_.batch_rows();
+  if (impl_->remaining_rows_ > 0) {
+    target_rows = std::min(target_rows, impl_->remaining_rows_);
+  }
+
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  arrow::Int64Builder lo_orderkey(pool);
+  arrow::Int32Builder lo_linenumber(pool);
+  arrow::Int64Builder lo_custkey(pool);
+  arrow::Int64Builder lo_partkey(pool);
+  arrow::Int64Builder lo_suppkey(pool);
+  arrow::StringBuilder lo_orderdate(pool);
+  arrow::StringBuilder lo_orderpriority(pool);
+  arrow::Int32Builder lo_shippriority(pool);
+  arrow::Int32Builder lo_quantity(pool);
+  arrow::Int64Builder lo_extendedprice(pool);
+  arrow::Int64Builder lo_order_totalprice(pool);
+  arrow::Int32Builder lo_discount(pool);
+  arrow::Int64Builder lo_revenue(pool);
+  arrow::Int64Builder lo_supplycost(pool);
+  arrow::Int32Builder lo_tax(pool);
+  arrow::StringBuilder lo_commitdate(pool);
+  arrow::StringBuilder lo_shipmode(pool);
+
+  SSB_RETURN_NOT_OK(lo_orderkey.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_linenumber.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_custkey.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_partkey.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_suppkey.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_orderdate.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_orderpriority.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_shippriority.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_quantity.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_extendedprice.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_order_totalprice.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_discount.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_revenue.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_supplycost.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_tax.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_commitdate.Reserve(target_rows));
+  SSB_RETURN_NOT_OK(lo_shipmode.Reserve(target_rows));
+
+  std::array<std::vector<int64_t>, kDimensionCount> keys;
+  for (auto& dimension_keys : keys) {
+    dimension_keys.reserve(static_cast<size_t>(target_rows));
+  }
+
+  int64_t produced = 0;
+  const internal::lineorder_t* row = nullptr;
+  while (produced < target_rows && impl_->row_generator_.NextRow(&row)) {
+    SSB_RETURN_NOT_OK(lo_orderkey.Append(static_cast<int64_t>(row->okey)));
+    SSB_RETURN_NOT_OK(
+        lo_linenumber.Append(static_cast<int32_t>(row->linenumber)));
+    SSB_RETURN_NOT_OK(lo_custkey.Append(row->custkey));
+    SSB_RETURN_NOT_OK(lo_partkey.Append(row->partkey));
+    SSB_RETURN_NOT_OK(lo_suppkey.Append(row->suppkey));
+    SSB_RETURN_NOT_OK(lo_orderdate.Append(row->orderdate));
+    int32_t priority_len = static_cast<int32_t>(
+        std::min<size_t>(std::strlen(row->opriority), kDbgenOrderPriorityLen));
+    SSB_RETURN_NOT_OK(lo_orderpriority.Append(row->opriority, priority_len));
+    SSB_RETURN_NOT_OK(
+        lo_shippriority.Append(static_cast<int32_t>(row->ship_priority)));
+    SSB_RETURN_NOT_OK(lo_quantity.Append(static_cast<int32_t>(row->quantity)));
+    SSB_RETURN_NOT_OK(
+        lo_extendedprice.Append(static_cast<int64_t>(row->extended_price)));
+    SSB_RETURN_NOT_OK(lo_order_totalprice.Append(
+        static_cast<int64_t>(row->order_totalprice)));
+    SSB_RETURN_NOT_OK(lo_discount.Append(static_cast<int32_t>(row->discount)));
+    SSB_RETURN_NOT_OK(lo_revenue.Append(static_cast<int64_t>(row->revenue)));
+    SSB_RETURN_NOT_OK(
+        lo_supplycost.Append(static_cast<int64_t>(row->supp_cost)));
+    SSB_RETURN_NOT_OK(lo_tax.Append(static_cast<int32_t>(row->tax)));
+    SSB_RETURN_NOT_OK(lo_commitdate.Append(row->commit_date));
+    SSB_RETURN_NOT_OK(lo_shipmode.Append(row->shipmode));
+
+    const std::array<int64_t, kDimensionCount> row_keys = {
+        row->custkey, row->suppkey, row->partkey};
+    for (size_t d = 0; d < kDimensionCount; ++d) {
+      const auto& dimension = impl_->dimensions_[d];
+      if (!dimension) {
+        continue;
+      }
+      if (row_keys[d] < 1 || row_keys[d] > dimension->rows) {
+        return arrow::Status::Invalid(
+            "lineorder key ", row_keys[d], " is outside SSB table ",
+            std::string(TableIdToString(DimensionSpecs()[d].table)));
+      }
+      keys[d].push_back(row_keys[d]);
+    }
+    ++produced;
+  }
+
+  if (produced == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+
+  impl_->current_row_ += produced;
+  if (impl_->remaining_rows_ > 0) {
+    impl_->remaining_rows_ -= produced;
+  }
+
+  std::vector<std::shared_ptr<arrow::Array>> columns;
+  columns.reserve(impl_->selected_.size());
+  std::shared_ptr<arrow::Array> array;
+  SSB_RETURN_NOT_OK(lo_orderkey.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_linenumber.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_custkey.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_partkey.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_suppkey.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_orderdate.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_orderpriority.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_shippriority.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_quantity.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_extendedprice.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_order_totalprice.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_discount.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_revenue.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_supplycost.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_tax.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_commitdate.Finish(&array));
+  columns.push_back(array);
+  SSB_RETURN_NOT_OK(lo_shipmode.Finish(&array));
+  columns.push_back(array);
+
+  // Unselected dimension columns are never gathered; the column selection
+  // drops their null placeholders.
+  size_t field = kLineorderColumnCount;
+  for (size_t d = 0; d < kDimensionCount; ++d) {
+    const auto& dimension = impl_->dimensions_[d];
+    const size_t column_count = DimensionSpecs()[d].columns.size();
+    for (size_t c = 0; c < column_count; ++c, ++field) {
+      if (!dimension || !impl_->selected_[field]) {
+        columns.push_back(nullptr);
+        continue;
+      }
+      SSB_RETURN_NOT_OK(GatherColumn(*dimension->columns[c], keys[d], &array));
+      columns.push_back(array);
+    }
+  }
+
+  SSB_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      produced, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::ssb
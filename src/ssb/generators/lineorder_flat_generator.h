@@ -0,0 +1,46 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "benchgen/generator_options.h"
+#include "benchgen/record_batch_iterator.h"
+
+namespace benchgen::ssb {
+
+// lineorder joined with the customer, supplier and part columns its keys
+// reference, as the pre-joined lineorder_flat table of the SSB variants
+// run by ClickHouse and StarRocks.
+class LineorderFlatGenerator : public RecordBatchIterator {
+ public:
+  explicit LineorderFlatGenerator(GeneratorOptions options);
+  ~LineorderFlatGenerator() override;
+
+  arrow::Status Init();
+
+  std::string_view name() const override;
+
+  std::string_view suite_name() const override;
+  std::shared_ptr<arrow::Schema> schema() const override;
+  arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace benchgen::ssb
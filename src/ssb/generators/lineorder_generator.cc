@@ -24,6 +24,7 @@
 #include "benchgen/generator_options.h"
 #include "benchgen/table.h"
 #include "generators/lineorder_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::ssb {
@@ -81,16 +82,30 @@ struct LineorderGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+
+    return Seek(options_.start_row, options_.row_count);
+  }
 
-    if (options_.start_row < 0) {
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    row_generator_.SkipRows(options_.start_row);
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
 
-    if (options_.row_count < 0) {
+    if (row_count < 0) {
       remaining_rows_ = -1;
     } else {
-      remaining_rows_ = options_.row_count;
+      remaining_rows_ = row_count;
     }
 
     return arrow::Status::OK();
@@ -98,8 +113,10 @@ struct LineorderGenerator::Impl {
 
   GeneratorOptions options_;
   int64_t remaining_rows_ = -1;
+  int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::LineorderRowGenerator row_generator_;
 };
 
@@ -120,6 +137,10 @@ std::shared_ptr<arrow::Schema> LineorderGenerator::schema() const {
   return impl_->schema_;
 }
 
+arrow::Status LineorderGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status LineorderGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -127,7 +148,7 @@ arrow::Status LineorderGenerator::Next(
     return arrow::Status::OK();
   }
 
-  int64_t target_rows = impl_->options_.chunk_size;
+  int64_t target_rows = impl_->batch_sizer_.batch_rows();
   if (impl_->remaining_rows_ > 0) {
     target_rows = std::min(target_rows, impl_->remaining_rows_);
   }
@@ -204,6 +225,7 @@ arrow::Status LineorderGenerator::Next(
     return arrow::Status::OK();
   }
 
+  impl_->current_row_ += produced;
   if (impl_->remaining_rows_ > 0) {
     impl_->remaining_rows_ -= produced;
   }
@@ -246,8 +268,10 @@ arrow::Status LineorderGenerator::Next(
   SSB_RETURN_NOT_OK(lo_shipmode.Finish(&array));
   columns.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(produced, std::move(columns),
-                                                  out);
+  SSB_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      produced, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 }  // namespace benchgen::ssb
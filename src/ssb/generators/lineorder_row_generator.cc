@@ -78,6 +78,7 @@ arrow::Status LineorderRowGenerator::Init() {
   current_order_index_ = 1;
   current_line_index_ = 0;
   has_order_ = false;
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
@@ -197,6 +198,13 @@ int64_t LineorderRowGenerator::CustKeyMax() const {
   return RowCount(TableId::kCustomer, scale_factor_);
 }
 
+void LineorderRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+  current_order_index_ = 1;
+  current_line_index_ = 0;
+  has_order_ = false;
+}
+
 void LineorderRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0 || current_order_index_ > total_orders_) {
     return;
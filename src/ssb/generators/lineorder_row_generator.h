@@ -33,6 +33,8 @@ class LineorderRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   int64_t SkipOrders(int64_t orders);
   bool NextRow(const lineorder_t** out);
 
@@ -50,6 +52,7 @@ class LineorderRowGenerator {
   bool initialized_ = false;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 
   int64_t total_orders_ = 0;
   int64_t current_order_index_ = 1;
@@ -33,6 +33,7 @@ class PartGenerator : public RecordBatchIterator {
   std::string_view suite_name() const override;
   std::shared_ptr<arrow::Schema> schema() const override;
   arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
 
  private:
   struct Impl;
@@ -41,10 +41,15 @@ arrow::Status PartRowGenerator::Init() {
       return status;
     }
   }
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void PartRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void PartRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
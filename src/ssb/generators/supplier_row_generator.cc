@@ -42,10 +42,15 @@ arrow::Status SupplierRowGenerator::Init() {
       return status;
     }
   }
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void SupplierRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void SupplierRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
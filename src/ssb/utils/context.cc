@@ -151,6 +151,7 @@ arrow::Status AdvanceSeedsForTable(RandomState* rng, TableId table,
       SkipCustomer(rng, cust_rows);
       return arrow::Status::OK();
     case TableId::kLineorder:
+    case TableId::kLineorderFlat:
       SkipPart(rng, part_rows);
       SkipSupplier(rng, supp_rows);
       SkipCustomer(rng, cust_rows);
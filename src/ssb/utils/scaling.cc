@@ -110,6 +110,7 @@ int64_t RowCount(TableId table, double scale_factor) {
       return scaled < 1.0 ? 1 : static_cast<int64_t>(scaled);
     }
     case TableId::kLineorder:
+    case TableId::kLineorderFlat:
       return LineorderCount(scale_factor);
     case TableId::kTableCount:
       break;
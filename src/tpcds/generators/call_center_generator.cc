@@ -15,13 +15,16 @@
 #include "generators/call_center_generator.h"
 
 #include <algorithm>
+#include <exception>
+#include <optional>
 #include <cstdio>
-#include <stdexcept>
 #include <string>
 
 #include "distribution/scaling.h"
 #include "generators/call_center_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/columns.h"
 #include "utils/date.h"
 #include "utils/null_utils.h"
@@ -34,16 +37,6 @@ int32_t Date32FromJulian(int32_t julian) {
   return internal::Date::DaysSinceEpoch(internal::Date::FromJulianDays(julian));
 }
 
-std::string FormatStreetName(const internal::Address& address) {
-  return address.street_name1 + " " + address.street_name2;
-}
-
-std::string FormatZip(int zip) {
-  char buffer[6] = {};
-  std::snprintf(buffer, sizeof(buffer), "%05d", zip);
-  return std::string(buffer);
-}
-
 std::shared_ptr<arrow::Schema> BuildCallCenterSchema() {
   return arrow::schema({
       arrow::field("cc_call_center_sk", arrow::int64(), false),
@@ -85,35 +78,50 @@ std::shared_ptr<arrow::Schema> BuildCallCenterSchema() {
 struct CallCenterGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildCallCenterSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildCallCenterSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(CALL_CENTER);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -122,7 +130,8 @@ struct CallCenterGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::CallCenterRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::CallCenterRowGenerator> row_generator_;
 };
 
 CallCenterGenerator::CallCenterGenerator(GeneratorOptions options)
@@ -130,6 +139,8 @@ CallCenterGenerator::CallCenterGenerator(GeneratorOptions options)
 
 CallCenterGenerator::~CallCenterGenerator() = default;
 
+arrow::Status CallCenterGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> CallCenterGenerator::schema() const {
   return impl_->schema_;
 }
@@ -140,15 +151,25 @@ std::string_view CallCenterGenerator::name() const {
 
 std::string_view CallCenterGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status CallCenterGenerator::Seek(int64_t start_row, int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CallCenterGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder cc_call_center_sk(pool);
@@ -227,7 +248,8 @@ arrow::Status CallCenterGenerator::Next(
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t row_number = impl_->current_row_ + 1;
     internal::CallCenterRowData row =
-        impl_->row_generator_.GenerateRow(row_number);
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, CALL_CENTER, column_id);
@@ -359,13 +381,14 @@ arrow::Status CallCenterGenerator::Next(
       TPCDS_RETURN_NOT_OK(cc_street_number.AppendNull());
     } else {
       TPCDS_RETURN_NOT_OK(
-          cc_street_number.Append(std::to_string(row.address.street_num)));
+          internal::AppendStreetNumber(row.address, &cc_street_number));
     }
 
     if (is_null(CC_STREET_NAME)) {
       TPCDS_RETURN_NOT_OK(cc_street_name.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(cc_street_name.Append(FormatStreetName(row.address)));
+      TPCDS_RETURN_NOT_OK(
+          internal::AppendStreetName(row.address, &cc_street_name));
     }
 
     if (is_null(CC_STREET_TYPE)) {
@@ -377,7 +400,7 @@ arrow::Status CallCenterGenerator::Next(
     if (is_null(CC_SUITE_NUMBER)) {
       TPCDS_RETURN_NOT_OK(cc_suite_number.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(cc_suite_number.Append(row.address.suite_num));
+      TPCDS_RETURN_NOT_OK(cc_suite_number.Append(row.address.suite_num()));
     }
 
     if (is_null(CC_CITY)) {
@@ -401,7 +424,7 @@ arrow::Status CallCenterGenerator::Next(
     if (is_null(CC_ZIP)) {
       TPCDS_RETURN_NOT_OK(cc_zip.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(cc_zip.Append(FormatZip(row.address.zip)));
+      TPCDS_RETURN_NOT_OK(internal::AppendZip(row.address.zip, &cc_zip));
     }
 
     if (is_null(CC_COUNTRY)) {
@@ -424,7 +447,7 @@ arrow::Status CallCenterGenerator::Next(
       TPCDS_RETURN_NOT_OK(cc_tax_percentage.Append(tax_val));
     }
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
   }
@@ -496,8 +519,10 @@ arrow::Status CallCenterGenerator::Next(
   TPCDS_RETURN_NOT_OK(cc_tax_percentage.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CallCenterGenerator::total_rows() const { return impl_->total_rows_; }
@@ -47,6 +47,7 @@ void CallCenterRowGenerator::SkipRows(int64_t start_row) {
   old_values_initialized_ = false;
   scd_state_ = ScdState();
   if (start_row <= 0) {
+    streams_.SkipRows(0);
     return;
   }
   int64_t regen_start = ScdGroupStartRow(start_row);
@@ -15,11 +15,14 @@
 #include "generators/catalog_page_generator.h"
 
 #include <algorithm>
-#include <stdexcept>
+#include <exception>
+#include <optional>
 
 #include "distribution/scaling.h"
 #include "generators/catalog_page_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/columns.h"
 #include "utils/null_utils.h"
 #include "utils/tables.h"
@@ -46,35 +49,50 @@ std::shared_ptr<arrow::Schema> BuildCatalogPageSchema() {
 struct CatalogPageGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildCatalogPageSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildCatalogPageSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(CATALOG_PAGE);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -83,7 +101,8 @@ struct CatalogPageGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::CatalogPageRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::CatalogPageRowGenerator> row_generator_;
 };
 
 CatalogPageGenerator::CatalogPageGenerator(GeneratorOptions options)
@@ -91,6 +110,8 @@ CatalogPageGenerator::CatalogPageGenerator(GeneratorOptions options)
 
 CatalogPageGenerator::~CatalogPageGenerator() = default;
 
+arrow::Status CatalogPageGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> CatalogPageGenerator::schema() const {
   return impl_->schema_;
 }
@@ -101,15 +122,25 @@ std::string_view CatalogPageGenerator::name() const {
 
 std::string_view CatalogPageGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status CatalogPageGenerator::Seek(int64_t start_row, int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CatalogPageGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder cp_catalog_page_sk(pool);
@@ -143,7 +174,8 @@ arrow::Status CatalogPageGenerator::Next(
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t row_number = impl_->current_row_ + 1;
     internal::CatalogPageRowData row =
-        impl_->row_generator_.GenerateRow(row_number);
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, CATALOG_PAGE, column_id);
@@ -204,7 +236,7 @@ arrow::Status CatalogPageGenerator::Next(
       TPCDS_RETURN_NOT_OK(cp_type.Append(row.type));
     }
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
   }
@@ -232,8 +264,10 @@ arrow::Status CatalogPageGenerator::Next(
   TPCDS_RETURN_NOT_OK(cp_type.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CatalogPageGenerator::total_rows() const { return impl_->total_rows_; }
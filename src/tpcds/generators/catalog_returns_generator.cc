@@ -15,12 +15,15 @@
 #include "generators/catalog_returns_generator.h"
 
 #include <algorithm>
-#include <stdexcept>
+#include <exception>
+#include <optional>
 #include <string>
 
 #include "distribution/scaling.h"
 #include "generators/catalog_returns_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/column_streams.h"
 #include "utils/columns.h"
 #include "utils/constants.h"
@@ -98,33 +101,48 @@ int64_t ComputeCatalogReturnsRows(double scale_factor) {
 struct CatalogReturnsGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildCatalogReturnsSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildCatalogReturnsSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ = ComputeCatalogReturnsRows(options_.scale_factor);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -133,7 +151,8 @@ struct CatalogReturnsGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::CatalogReturnsRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::CatalogReturnsRowGenerator> row_generator_;
 };
 
 CatalogReturnsGenerator::CatalogReturnsGenerator(GeneratorOptions options)
@@ -141,6 +160,8 @@ CatalogReturnsGenerator::CatalogReturnsGenerator(GeneratorOptions options)
 
 CatalogReturnsGenerator::~CatalogReturnsGenerator() = default;
 
+arrow::Status CatalogReturnsGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> CatalogReturnsGenerator::schema() const {
   return impl_->schema_;
 }
@@ -151,15 +172,26 @@ std::string_view CatalogReturnsGenerator::name() const {
 
 std::string_view CatalogReturnsGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status CatalogReturnsGenerator::Seek(int64_t start_row,
+                                            int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CatalogReturnsGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int32Builder cr_returned_date_sk(pool);
@@ -237,7 +269,8 @@ arrow::Status CatalogReturnsGenerator::Next(
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t row_number = impl_->current_row_ + 1;
     internal::CatalogReturnsRowData row =
-        impl_->row_generator_.GenerateRow(row_number);
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, CATALOG_RETURNS, column_id);
@@ -382,7 +415,7 @@ arrow::Status CatalogReturnsGenerator::Next(
     TPCDS_RETURN_NOT_OK(append_decimal(cr_pricing_net_loss, CR_PRICING_NET_LOSS,
                                        row.pricing.net_loss));
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
   }
@@ -446,8 +479,10 @@ arrow::Status CatalogReturnsGenerator::Next(
   TPCDS_RETURN_NOT_OK(cr_pricing_net_loss.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CatalogReturnsGenerator::total_rows() const {
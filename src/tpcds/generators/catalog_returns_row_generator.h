@@ -23,6 +23,7 @@
 #include "generators/catalog_sales_row_generator.h"
 #include "utils/pricing.h"
 #include "utils/row_streams.h"
+#include "utils/ticket_cursor.h"
 
 namespace benchgen::tpcds::internal {
 
@@ -65,9 +66,11 @@ class CatalogReturnsRowGenerator {
   DstDistributionStore distribution_store_;
   RowStreams streams_;
   CatalogSalesRowGenerator sales_generator_;
+  ReturnTicketCursor ticket_cursor_;
   int64_t current_order_ = 0;
   std::vector<CatalogReturnsRowData> pending_returns_;
   size_t pending_index_ = 0;
+  int64_t rows_generated_ = 0;
   PricingState pricing_state_;
 };
 
@@ -15,12 +15,17 @@
 #include "generators/catalog_sales_generator.h"
 
 #include <algorithm>
-#include <stdexcept>
+#include <exception>
+#include <optional>
 #include <string>
 
+#include "distribution/date_scaling.h"
+#include "distribution/dst_distribution_store.h"
 #include "distribution/scaling.h"
 #include "generators/catalog_sales_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/column_streams.h"
 #include "utils/columns.h"
 #include "utils/decimal.h"
@@ -71,6 +76,15 @@ std::shared_ptr<arrow::Schema> BuildCatalogSalesSchema() {
   });
 }
 
+int DrawOrderLineItems(internal::RandomNumberStream* stream) {
+  int items = internal::GenerateUniformRandomInt(4, 14, stream);
+  while (stream->seeds_used() < stream->seeds_per_row()) {
+    internal::GenerateUniformRandomInt(1, 100, stream);
+  }
+  stream->ResetSeedsUsed();
+  return items;
+}
+
 int64_t ComputeCatalogSalesLineItems(double scale_factor) {
   internal::Scaling scaling(scale_factor);
   int64_t orders = scaling.RowCountByTableNumber(CATALOG_SALES);
@@ -78,38 +92,71 @@ int64_t ComputeCatalogSalesLineItems(double scale_factor) {
                                       internal::SeedsPerRow(CS_ORDER_NUMBER));
   int64_t total = 0;
   for (int64_t i = 0; i < orders; ++i) {
-    total += internal::GenerateUniformRandomInt(4, 14, &stream);
-    while (stream.seeds_used() < stream.seeds_per_row()) {
-      internal::GenerateUniformRandomInt(1, 100, &stream);
-    }
-    stream.ResetSeedsUsed();
+    total += DrawOrderLineItems(&stream);
   }
   return total;
 }
 
-int64_t OrderNumberForRow(int64_t row_number, int column_id, int min_items,
-                          int max_items) {
-  if (row_number <= 1) {
-    return 1;
-  }
-  internal::RandomNumberStream stream(column_id,
-                                      internal::SeedsPerRow(column_id));
-  int64_t ticket_start_row = 1;
-  int64_t order_number = 1;
-  while (true) {
-    int items =
-        internal::GenerateUniformRandomInt(min_items, max_items, &stream);
-    while (stream.seeds_used() < stream.seeds_per_row()) {
-      internal::GenerateUniformRandomInt(1, 100, &stream);
+bool HasSoldDateWindow(const GeneratorOptions& options) {
+  return options.sold_date_min_sk >= 0 || options.sold_date_max_sk >= 0;
+}
+
+struct RowRange {
+  int64_t begin = 0;
+  int64_t end = 0;
+};
+
+// Maps the sold date window onto the rows of the orders sold in it. Orders
+// are assigned to consecutive days from DATA_START_DATE, DateScaling() orders
+// per day, exactly as CatalogSalesRowGenerator::BuildOrderInfo walks them.
+RowRange ComputeSoldDateRowRange(const GeneratorOptions& options) {
+  internal::Scaling scaling(options.scale_factor);
+  const int64_t total_orders = scaling.RowCountByTableNumber(CATALOG_SALES);
+  internal::DstDistributionStore distribution_store;
+  const auto& calendar = distribution_store.Get("calendar");
+
+  int64_t last_order_of_day = 0;
+  int64_t julian_date = internal::SkipDays(CATALOG_SALES, &last_order_of_day,
+                                           scaling, calendar);
+  int64_t first_order_of_day = 1;
+  int64_t first_order = 0;
+  int64_t last_order = 0;
+  while (first_order_of_day <= total_orders) {
+    bool in_window = (options.sold_date_min_sk < 0 ||
+                      julian_date >= options.sold_date_min_sk) &&
+                     (options.sold_date_max_sk < 0 ||
+                      julian_date <= options.sold_date_max_sk);
+    if (in_window) {
+      if (first_order == 0) {
+        first_order = first_order_of_day;
+      }
+      last_order = std::min(last_order_of_day, total_orders);
+    }
+    if (options.sold_date_max_sk >= 0 &&
+        julian_date >= options.sold_date_max_sk) {
+      break;
     }
-    stream.ResetSeedsUsed();
-    int64_t ticket_end_row = ticket_start_row + items - 1;
-    if (row_number <= ticket_end_row) {
-      return order_number;
+    first_order_of_day = last_order_of_day + 1;
+    ++julian_date;
+    last_order_of_day +=
+        internal::DateScaling(CATALOG_SALES, julian_date, scaling, calendar);
+  }
+
+  RowRange range;
+  if (first_order == 0 || last_order < first_order) {
+    return range;
+  }
+  internal::RandomNumberStream stream(CS_ORDER_NUMBER,
+                                      internal::SeedsPerRow(CS_ORDER_NUMBER));
+  int64_t row = 0;
+  for (int64_t order = 1; order <= last_order; ++order) {
+    if (order == first_order) {
+      range.begin = row;
     }
-    ticket_start_row = ticket_end_row + 1;
-    ++order_number;
+    row += DrawOrderLineItems(&stream);
   }
+  range.end = row;
+  return range;
 }
 
 }  // namespace
@@ -117,50 +164,73 @@ int64_t OrderNumberForRow(int64_t row_number, int column_id, int min_items,
 struct CatalogSalesGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildCatalogSalesSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildCatalogSalesSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_orders_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(CATALOG_SALES);
-    total_rows_ = ComputeCatalogSalesLineItems(options_.scale_factor);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    if (HasSoldDateWindow(options_)) {
+      RowRange window = ComputeSoldDateRowRange(options_);
+      window_begin_ = window.begin;
+      total_rows_ = window.end - window.begin;
+    } else {
+      total_rows_ = ComputeCatalogSalesLineItems(options_.scale_factor);
     }
-    if (options_.start_row >= total_rows_) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
-    int64_t next_row = options_.start_row + 1;
-    int64_t order_number = OrderNumberForRow(next_row, CS_ORDER_NUMBER, 4, 14);
-    current_order_ = order_number - 1;
+    // Rows of the sold date window are a contiguous slice of the table.
+    int64_t table_row = window_begin_ + start_row;
+    row_generator_->SkipRows(table_row);
+    current_order_ = row_generator_->NextOrderNumber() - 1;
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
   int64_t total_orders_ = 0;
   int64_t total_rows_ = 0;
+  int64_t window_begin_ = 0;
   int64_t remaining_rows_ = 0;
   int64_t current_row_ = 0;
   int64_t current_order_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::CatalogSalesRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::CatalogSalesRowGenerator> row_generator_;
 };
 
 CatalogSalesGenerator::CatalogSalesGenerator(GeneratorOptions options)
@@ -168,6 +238,8 @@ CatalogSalesGenerator::CatalogSalesGenerator(GeneratorOptions options)
 
 CatalogSalesGenerator::~CatalogSalesGenerator() = default;
 
+arrow::Status CatalogSalesGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> CatalogSalesGenerator::schema() const {
   return impl_->schema_;
 }
@@ -178,15 +250,26 @@ std::string_view CatalogSalesGenerator::name() const {
 
 std::string_view CatalogSalesGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status CatalogSalesGenerator::Seek(int64_t start_row,
+                                          int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CatalogSalesGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int32Builder cs_sold_date_sk(pool);
@@ -286,7 +369,8 @@ arrow::Status CatalogSalesGenerator::Next(
     // Order number for this row
     int64_t order_number = impl_->current_order_ + 1;
     internal::CatalogSalesRowData row =
-        impl_->row_generator_.GenerateRow(order_number);
+        impl_->row_generator_->GenerateRow(order_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, CATALOG_SALES, column_id);
@@ -452,12 +536,12 @@ arrow::Status CatalogSalesGenerator::Next(
     TPCDS_RETURN_NOT_OK(append_decimal(
         cs_pricing_net_profit, CS_PRICING_NET_PROFIT, row.pricing.net_profit));
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
 
     // Track order number
-    if (impl_->row_generator_.LastRowInOrder()) {
+    if (impl_->row_generator_->LastRowInOrder()) {
       impl_->current_order_ = order_number;
     }
   }
@@ -535,8 +619,10 @@ arrow::Status CatalogSalesGenerator::Next(
   TPCDS_RETURN_NOT_OK(cs_pricing_net_profit.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CatalogSalesGenerator::total_rows() const { return impl_->total_rows_; }
@@ -549,4 +635,12 @@ int64_t CatalogSalesGenerator::TotalRows(double scale_factor) {
   return ComputeCatalogSalesLineItems(scale_factor);
 }
 
+int64_t CatalogSalesGenerator::TotalRows(const GeneratorOptions& options) {
+  if (!HasSoldDateWindow(options)) {
+    return ComputeCatalogSalesLineItems(options.scale_factor);
+  }
+  RowRange window = ComputeSoldDateRowRange(options);
+  return window.end - window.begin;
+}
+
 }  // namespace benchgen::tpcds
@@ -28,59 +28,17 @@
 #include "utils/random_utils.h"
 #include "utils/scd.h"
 #include "utils/tables.h"
+#include "utils/ticket_cursor.h"
 
 namespace benchgen::tpcds::internal {
-namespace {
-
-struct TicketOffset {
-  int64_t order_number = 1;
-  int64_t ticket_start_row = 1;
-  int64_t rows_into_ticket = 0;
-  int64_t prev_order_number = 0;
-  int64_t prev_ticket_start_row = 1;
-};
-
-TicketOffset FindTicketOffset(int64_t start_row, int column_id, int min_items,
-                              int max_items) {
-  TicketOffset offset;
-  if (start_row <= 0) {
-    return offset;
-  }
-  RandomNumberStream stream(column_id, SeedsPerRow(column_id));
-  int64_t ticket_start_row = 1;
-  int64_t order_number = 1;
-  int64_t prev_ticket_start_row = 1;
-  int64_t prev_order_number = 0;
-  while (true) {
-    int items = GenerateUniformRandomInt(min_items, max_items, &stream);
-    while (stream.seeds_used() < stream.seeds_per_row()) {
-      GenerateUniformRandomInt(1, 100, &stream);
-    }
-    stream.ResetSeedsUsed();
-    int64_t ticket_end_row = ticket_start_row + items - 1;
-    if (start_row <= ticket_end_row) {
-      offset.order_number = order_number;
-      offset.ticket_start_row = ticket_start_row;
-      offset.rows_into_ticket = start_row - ticket_start_row + 1;
-      offset.prev_order_number = prev_order_number;
-      offset.prev_ticket_start_row = prev_ticket_start_row;
-      return offset;
-    }
-    prev_ticket_start_row = ticket_start_row;
-    prev_order_number = order_number;
-    ticket_start_row = ticket_end_row + 1;
-    ++order_number;
-  }
-}
-
-}  // namespace
-
 CatalogSalesRowGenerator::CatalogSalesRowGenerator(
     double scale)
     : scaling_(scale),
       distribution_store_(),
-      streams_(ColumnIds()) {
+      streams_(ColumnIds()),
+      ticket_cursor_(CS_ORDER_NUMBER, 4, 14) {
   item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+  item_permutation_ = SharedPermutation(CS_PERMUTE, item_count_);
   remaining_line_items_ = 0;
   ticket_item_base_ = 0;
   last_row_in_order_ = true;
@@ -95,20 +53,17 @@ void CatalogSalesRowGenerator::SkipRows(int64_t start_row) {
   julian_date_ = 0;
   next_date_index_ = 0;
   last_call_center_sk_ = 0;
-  if (item_permutation_.empty()) {
-    RandomNumberStream perm_stream(CS_PERMUTE, SeedsPerRow(CS_PERMUTE));
-    item_permutation_ = MakePermutation(item_count_, &perm_stream);
-  }
+  next_order_number_ = 1;
   if (start_row <= 0) {
     streams_.SkipRows(0);
     return;
   }
-  TicketOffset offset = FindTicketOffset(start_row, CS_ORDER_NUMBER, 4, 14);
-  int64_t regen_start_row = offset.ticket_start_row;
-  int64_t regen_order_number = offset.order_number;
-  if (offset.prev_order_number > 0) {
-    regen_start_row = offset.prev_ticket_start_row;
-    regen_order_number = offset.prev_order_number;
+  ticket_cursor_.MoveTo(start_row);
+  int64_t regen_start_row = ticket_cursor_.ticket_start_row();
+  int64_t regen_order_number = ticket_cursor_.order_number();
+  if (ticket_cursor_.prev_order_number() > 0) {
+    regen_start_row = ticket_cursor_.prev_ticket_start_row();
+    regen_order_number = ticket_cursor_.prev_order_number();
   }
   streams_.SkipRows(regen_order_number - 1);
   int64_t order_number = regen_order_number;
@@ -120,6 +75,7 @@ void CatalogSalesRowGenerator::SkipRows(int64_t start_row) {
       ++order_number;
     }
   }
+  next_order_number_ = order_number;
 }
 
 CatalogSalesRowData CatalogSalesRowGenerator::GenerateRow(
@@ -130,7 +86,6 @@ CatalogSalesRowData CatalogSalesRowGenerator::GenerateRow(
     order_info_ = BuildOrderInfo(order_number);
     remaining_line_items_ =
         GenerateUniformRandomInt(4, 14, &streams_.Stream(CS_ORDER_NUMBER));
-    EnsurePermutation();
     ticket_item_base_ = GenerateUniformRandomInt(
         1, item_count_, &streams_.Stream(CS_SOLD_ITEM_SK));
     last_row_in_order_ = false;
@@ -177,7 +132,7 @@ CatalogSalesRowData CatalogSalesRowGenerator::GenerateRow(
   if (ticket_item_base_ > item_count_) {
     ticket_item_base_ = 1;
   }
-  int item_key = GetPermutationEntry(item_permutation_, ticket_item_base_);
+  int item_key = GetPermutationEntry(*item_permutation_, ticket_item_base_);
   row.sold_item_sk = MatchSCDSK(item_key, row.sold_date_sk, ITEM, scaling_);
 
   row.promo_sk =
@@ -221,13 +176,6 @@ std::vector<int> CatalogSalesRowGenerator::ColumnIds() {
   return ids;
 }
 
-void CatalogSalesRowGenerator::EnsurePermutation() {
-  if (item_permutation_.empty()) {
-    item_permutation_ =
-        MakePermutation(item_count_, &streams_.Stream(CS_PERMUTE));
-  }
-}
-
 void CatalogSalesRowGenerator::EnsureDateState() {
   if (julian_date_ == 0) {
     const auto& calendar = distribution_store_.Get("calendar");
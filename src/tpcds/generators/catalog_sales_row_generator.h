@@ -15,12 +15,14 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "distribution/dst_distribution_store.h"
 #include "distribution/scaling.h"
 #include "utils/pricing.h"
 #include "utils/row_streams.h"
+#include "utils/ticket_cursor.h"
 
 namespace benchgen::tpcds::internal {
 
@@ -52,10 +54,14 @@ class CatalogSalesRowGenerator {
  public:
   CatalogSalesRowGenerator(double scale);
 
+  // Positions the generator after the first start_row rows. Increasing
+  // start_rows find their ticket from the previous one.
   void SkipRows(int64_t start_row);
   CatalogSalesRowData GenerateRow(int64_t order_number);
   void ConsumeRemainingSeedsForRow();
   bool LastRowInOrder() const { return last_row_in_order_; }
+  // Order number of the row after the last SkipRows.
+  int64_t NextOrderNumber() const { return next_order_number_; }
 
  private:
   struct OrderInfo {
@@ -74,14 +80,15 @@ class CatalogSalesRowGenerator {
   };
 
   static std::vector<int> ColumnIds();
-  void EnsurePermutation();
   void EnsureDateState();
   OrderInfo BuildOrderInfo(int64_t order_number);
 
   Scaling scaling_;
   DstDistributionStore distribution_store_;
   RowStreams streams_;
-  std::vector<int> item_permutation_;
+  TicketCursor ticket_cursor_;
+  int64_t next_order_number_ = 1;
+  std::shared_ptr<const std::vector<int>> item_permutation_;
   int item_count_ = 0;
   int remaining_line_items_ = 0;
   int ticket_item_base_ = 0;
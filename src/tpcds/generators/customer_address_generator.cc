@@ -18,7 +18,9 @@
 
 #include "distribution/scaling.h"
 #include "generators/customer_address_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/columns.h"
 #include "utils/null_utils.h"
 #include "utils/tables.h"
@@ -69,25 +71,33 @@ struct CustomerAddressGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(CUSTOMER_ADDRESS);
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
+      current_row_ = start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_.SkipRows(start_row);
     return arrow::Status::OK();
   }
 
@@ -97,6 +107,7 @@ struct CustomerAddressGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::CustomerAddressRowGenerator row_generator_;
 };
 
@@ -119,6 +130,11 @@ std::string_view CustomerAddressGenerator::suite_name() const {
   return "tpcds";
 }
 
+arrow::Status CustomerAddressGenerator::Seek(int64_t start_row,
+                                             int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CustomerAddressGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -127,7 +143,7 @@ arrow::Status CustomerAddressGenerator::Next(
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder ca_address_sk(pool);
@@ -162,6 +178,7 @@ arrow::Status CustomerAddressGenerator::Next(
     int64_t row_number = impl_->current_row_ + 1;
     internal::CustomerAddressRowData row =
         impl_->row_generator_.GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, CUSTOMER_ADDRESS, column_id);
@@ -182,61 +199,62 @@ arrow::Status CustomerAddressGenerator::Next(
     if (is_null(CA_ADDRESS_STREET_NUM)) {
       TPCDS_RETURN_NOT_OK(ca_street_number.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_street_number.Append(row.street_num));
+      TPCDS_RETURN_NOT_OK(ca_street_number.Append(row.address.street_num));
     }
 
     if (is_null(CA_ADDRESS_STREET_NAME1)) {
       TPCDS_RETURN_NOT_OK(ca_street_name.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_street_name.Append(row.street_name));
+      TPCDS_RETURN_NOT_OK(
+          internal::AppendStreetName(row.address, &ca_street_name));
     }
 
     if (is_null(CA_ADDRESS_STREET_TYPE)) {
       TPCDS_RETURN_NOT_OK(ca_street_type.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_street_type.Append(row.street_type));
+      TPCDS_RETURN_NOT_OK(ca_street_type.Append(row.address.street_type));
     }
 
     if (is_null(CA_ADDRESS_SUITE_NUM)) {
       TPCDS_RETURN_NOT_OK(ca_suite_number.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_suite_number.Append(row.suite_num));
+      TPCDS_RETURN_NOT_OK(ca_suite_number.Append(row.address.suite_num()));
     }
 
     if (is_null(CA_ADDRESS_CITY)) {
       TPCDS_RETURN_NOT_OK(ca_city.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_city.Append(row.city));
+      TPCDS_RETURN_NOT_OK(ca_city.Append(row.address.city));
     }
 
     if (is_null(CA_ADDRESS_COUNTY)) {
       TPCDS_RETURN_NOT_OK(ca_county.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_county.Append(row.county));
+      TPCDS_RETURN_NOT_OK(ca_county.Append(row.address.county));
     }
 
     if (is_null(CA_ADDRESS_STATE)) {
       TPCDS_RETURN_NOT_OK(ca_state.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_state.Append(row.state));
+      TPCDS_RETURN_NOT_OK(ca_state.Append(row.address.state));
     }
 
     if (is_null(CA_ADDRESS_ZIP)) {
       TPCDS_RETURN_NOT_OK(ca_zip.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_zip.Append(row.zip));
+      TPCDS_RETURN_NOT_OK(internal::AppendZip(row.address.zip, &ca_zip));
     }
 
     if (is_null(CA_ADDRESS_COUNTRY)) {
       TPCDS_RETURN_NOT_OK(ca_country.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_country.Append(row.country));
+      TPCDS_RETURN_NOT_OK(ca_country.Append(row.address.country));
     }
 
     if (is_null(CA_ADDRESS_GMT_OFFSET)) {
       TPCDS_RETURN_NOT_OK(ca_gmt_offset.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(ca_gmt_offset.Append(row.gmt_offset));
+      TPCDS_RETURN_NOT_OK(ca_gmt_offset.Append(row.address.gmt_offset));
     }
 
     if (is_null(CA_LOCATION_TYPE)) {
@@ -281,8 +299,10 @@ arrow::Status CustomerAddressGenerator::Next(
   TPCDS_RETURN_NOT_OK(ca_location_type.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CustomerAddressGenerator::total_rows() const {
@@ -14,24 +14,12 @@
 
 #include "generators/customer_address_row_generator.h"
 
-#include <cstdio>
-
 #include "utils/columns.h"
 #include "utils/null_utils.h"
 #include "utils/random_utils.h"
 #include "utils/tables.h"
 
 namespace benchgen::tpcds::internal {
-namespace {
-
-std::string FormatZip(int zip) {
-  char buffer[6] = {};
-  std::snprintf(buffer, sizeof(buffer), "%05d", zip);
-  return std::string(buffer);
-}
-
-}  // namespace
-
 CustomerAddressRowGenerator::CustomerAddressRowGenerator(
     double scale)
     : scaling_(scale),
@@ -53,19 +41,8 @@ CustomerAddressRowData CustomerAddressRowGenerator::GenerateRow(
   row.null_bitmap =
       GenerateNullBitmap(CUSTOMER_ADDRESS, &streams_.Stream(CA_NULLS));
 
-  Address address = GenerateAddress(CUSTOMER_ADDRESS, &distribution_store_,
-                                    &streams_.Stream(CA_ADDRESS), scaling_);
-
-  row.street_num = address.street_num;
-  row.street_name = address.street_name1 + " " + address.street_name2;
-  row.street_type = address.street_type;
-  row.suite_num = address.suite_num;
-  row.city = address.city;
-  row.county = address.county;
-  row.state = address.state;
-  row.zip = FormatZip(address.zip);
-  row.country = address.country;
-  row.gmt_offset = address.gmt_offset;
+  row.address = GenerateAddress(CUSTOMER_ADDRESS, &distribution_store_,
+                                &streams_.Stream(CA_ADDRESS), scaling_);
 
   int location_index =
       location_type_->PickIndex(1, &streams_.Stream(CA_LOCATION_TYPE));
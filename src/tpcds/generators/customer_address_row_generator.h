@@ -16,6 +16,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "distribution/dst_distribution_store.h"
@@ -28,17 +29,8 @@ namespace benchgen::tpcds::internal {
 struct CustomerAddressRowData {
   int64_t address_sk = 0;
   std::string address_id;
-  int32_t street_num = 0;
-  std::string street_name;
-  std::string street_type;
-  std::string suite_num;
-  std::string city;
-  std::string county;
-  std::string state;
-  std::string zip;
-  std::string country;
-  int32_t gmt_offset = 0;
-  std::string location_type;
+  Address address;
+  std::string_view location_type;
   int64_t null_bitmap = 0;
 };
 
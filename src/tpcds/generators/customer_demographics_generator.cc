@@ -19,6 +19,7 @@
 #include "benchgen/table.h"
 #include "distribution/scaling.h"
 #include "generators/customer_demographics_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpcds {
@@ -63,23 +64,31 @@ struct CustomerDemographicsGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCount(TableId::kCustomerDemographics);
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
+      current_row_ = start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
     return arrow::Status::OK();
   }
@@ -90,6 +99,7 @@ struct CustomerDemographicsGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::CustomerDemographicsRowGenerator row_generator_;
 };
 
@@ -113,6 +123,11 @@ std::string_view CustomerDemographicsGenerator::suite_name() const {
   return "tpcds";
 }
 
+arrow::Status CustomerDemographicsGenerator::Seek(int64_t start_row,
+                                                  int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CustomerDemographicsGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -121,7 +136,7 @@ arrow::Status CustomerDemographicsGenerator::Next(
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder cd_demo_sk(pool);
@@ -191,8 +206,10 @@ arrow::Status CustomerDemographicsGenerator::Next(
       cd_dep_count_array,         cd_dep_employed_count_array,
       cd_dep_college_count_array};
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CustomerDemographicsGenerator::total_rows() const {
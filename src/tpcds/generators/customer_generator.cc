@@ -17,7 +17,9 @@
 #include <algorithm>
 
 #include "benchgen/arrow_compat.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/tpcds_internal.h"
 
 namespace benchgen::tpcds {
@@ -71,25 +73,33 @@ struct CustomerGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCount(TableId::kCustomer);
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
+      current_row_ = start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_.SkipRows(start_row);
     return arrow::Status::OK();
   }
 
@@ -99,6 +109,7 @@ struct CustomerGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::CustomerRowGenerator row_generator_;
 };
 
@@ -119,6 +130,10 @@ std::string_view CustomerGenerator::name() const {
 
 std::string_view CustomerGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status CustomerGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CustomerGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -127,7 +142,7 @@ arrow::Status CustomerGenerator::Next(
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder c_customer_sk(pool);
@@ -172,6 +187,7 @@ arrow::Status CustomerGenerator::Next(
     int64_t row_number = impl_->current_row_ + 1;
     internal::CustomerRowData row =
         impl_->row_generator_.GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](internal::CustomerGeneratorColumn column) {
       return internal::CustomerRowGenerator::IsNull(row.null_bitmap, column);
@@ -332,8 +348,10 @@ arrow::Status CustomerGenerator::Next(
   TPCDS_RETURN_NOT_OK(c_last_review_date_sk.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CustomerGenerator::total_rows() const { return impl_->total_rows_; }
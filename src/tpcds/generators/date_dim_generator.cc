@@ -19,6 +19,7 @@
 #include "benchgen/table.h"
 #include "distribution/scaling.h"
 #include "generators/date_dim_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpcds {
@@ -82,23 +83,31 @@ struct DateDimGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCount(TableId::kDateDim);
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
+      current_row_ = start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
     return arrow::Status::OK();
   }
@@ -109,6 +118,7 @@ struct DateDimGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::DateDimRowGenerator row_generator_;
 };
 
@@ -129,6 +139,10 @@ std::string_view DateDimGenerator::name() const {
 
 std::string_view DateDimGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status DateDimGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status DateDimGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
@@ -136,7 +150,7 @@ arrow::Status DateDimGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int32Builder d_date_sk(pool);
@@ -324,8 +338,10 @@ arrow::Status DateDimGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
       d_current_quarter_array,
       d_current_year_array};
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t DateDimGenerator::total_rows() const { return impl_->total_rows_; }
@@ -15,11 +15,14 @@
 #include "generators/item_generator.h"
 
 #include <algorithm>
-#include <stdexcept>
+#include <exception>
+#include <optional>
 
 #include "distribution/scaling.h"
 #include "generators/item_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/columns.h"
 #include "utils/date.h"
 #include "utils/null_utils.h"
@@ -64,35 +67,50 @@ std::shared_ptr<arrow::Schema> BuildItemSchema() {
 struct ItemGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildItemSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildItemSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(ITEM);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -101,7 +119,8 @@ struct ItemGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::ItemRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::ItemRowGenerator> row_generator_;
 };
 
 ItemGenerator::ItemGenerator(GeneratorOptions options)
@@ -109,6 +128,8 @@ ItemGenerator::ItemGenerator(GeneratorOptions options)
 
 ItemGenerator::~ItemGenerator() = default;
 
+arrow::Status ItemGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> ItemGenerator::schema() const {
   return impl_->schema_;
 }
@@ -119,14 +140,24 @@ std::string_view ItemGenerator::name() const {
 
 std::string_view ItemGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status ItemGenerator::Seek(int64_t start_row, int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status ItemGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder i_item_sk(pool);
@@ -185,7 +216,8 @@ arrow::Status ItemGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
 
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t row_number = impl_->current_row_ + 1;
-    internal::ItemRowData row = impl_->row_generator_.GenerateRow(row_number);
+    internal::ItemRowData row = impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, ITEM, column_id);
@@ -327,7 +359,7 @@ arrow::Status ItemGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
       TPCDS_RETURN_NOT_OK(i_product_name.Append(row.product_name));
     }
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
   }
@@ -381,8 +413,10 @@ arrow::Status ItemGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   TPCDS_RETURN_NOT_OK(i_product_name.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t ItemGenerator::total_rows() const { return impl_->total_rows_; }
@@ -40,6 +40,7 @@ void ItemRowGenerator::SkipRows(int64_t start_row) {
   hierarchy_state_ = HierarchyState();
   scd_state_ = ScdState();
   if (start_row <= 0) {
+    streams_.SkipRows(0);
     return;
   }
   int64_t regen_start = ScdGroupStartRow(start_row);
@@ -19,6 +19,7 @@
 #include "benchgen/table.h"
 #include "distribution/scaling.h"
 #include "generators/reason_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpcds {
@@ -57,23 +58,31 @@ struct ReasonGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCount(TableId::kReason);
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
+      current_row_ = start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
     return arrow::Status::OK();
   }
@@ -84,6 +93,7 @@ struct ReasonGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::ReasonRowGenerator row_generator_;
 };
 
@@ -104,6 +114,10 @@ std::string_view ReasonGenerator::name() const {
 
 std::string_view ReasonGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status ReasonGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status ReasonGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
@@ -111,7 +125,7 @@ arrow::Status ReasonGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder r_reason_sk(pool);
@@ -145,8 +159,10 @@ arrow::Status ReasonGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   std::vector<std::shared_ptr<arrow::Array>> arrays = {
       r_reason_sk_array, r_reason_id_array, r_reason_desc_array};
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t ReasonGenerator::total_rows() const { return impl_->total_rows_; }
@@ -0,0 +1,55 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/generator_options.h"
+#include "benchgen/record_batch_iterator.h"
+#include "benchgen/table.h"
+
+namespace benchgen::tpcds {
+
+// The date ranges refresh run options.refresh_stream removes before loading
+// its source tables: "delete" holds the sales windows the DF_SS, DF_CS and
+// DF_WS functions delete, "inventory_delete" the inventory weeks DF_I
+// deletes. One row per window, no random numbers involved.
+class RefreshDeleteGenerator final : public RecordBatchIterator {
+ public:
+  // table must be RefreshTableId::kDelete or kInventoryDelete.
+  RefreshDeleteGenerator(GeneratorOptions options, RefreshTableId table);
+  ~RefreshDeleteGenerator() override;
+
+  arrow::Status Init();
+
+  std::shared_ptr<arrow::Schema> schema() const override;
+  std::string_view name() const override;
+  std::string_view suite_name() const override;
+  arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
+
+  int64_t total_rows() const;
+  int64_t remaining_rows() const;
+
+  static int64_t TotalRows();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace benchgen::tpcds
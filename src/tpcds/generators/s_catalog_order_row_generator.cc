@@ -0,0 +1,178 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_catalog_order_row_generator.h"
+
+#include <algorithm>
+
+#include "utils/column_streams.h"
+#include "utils/columns.h"
+#include "utils/constants.h"
+#include "utils/join.h"
+#include "utils/permute.h"
+#include "utils/random_utils.h"
+#include "utils/refresh.h"
+#include "utils/tables.h"
+#include "utils/text.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+constexpr int kCommentMin = 60;
+constexpr int kCommentMax = 100;
+
+}  // namespace
+
+SCatalogOrderRowGenerator::SCatalogOrderRowGenerator(double scale,
+                                                     int32_t refresh_run)
+    : scaling_(scale),
+      distribution_store_(),
+      streams_(ColumnIds()),
+      refresh_run_(refresh_run) {
+  total_rows_ = RefreshOrderCount(S_CATALOG_ORDER, scaling_);
+  id_base_ = RefreshOrderIdBase(S_CATALOG_ORDER, refresh_run_, scaling_);
+  stream_offset_ = (refresh_run_ - 1) * total_rows_;
+  item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+}
+
+void SCatalogOrderRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+}
+
+SCatalogOrderRowData SCatalogOrderRowGenerator::GenerateRow(
+    int64_t row_number) {
+  SCatalogOrderRowData row;
+  row.order_id = id_base_ + row_number;
+  row.bill_customer_id = RefreshBusinessKey(
+      CUSTOMER, &streams_.Stream(S_CORD_BILL_CUSTOMER_ID), scaling_);
+  auto& ship_stream = streams_.Stream(S_CORD_SHIP_CUSTOMER_ID);
+  if (GenerateUniformRandomInt(0, 99, &ship_stream) < CS_GIFT_PCT) {
+    row.ship_customer_id = RefreshBusinessKey(CUSTOMER, &ship_stream, scaling_);
+  } else {
+    row.ship_customer_id = row.bill_customer_id;
+  }
+  row.order_date =
+      RefreshSalesDate(refresh_run_, &streams_.Stream(S_CORD_ORDER_DATE));
+  row.order_time = GenerateUniformRandomInt(
+      0, 86399, &streams_.Stream(S_CORD_ORDER_TIME));
+  row.ship_mode_id = RefreshBusinessKey(
+      SHIP_MODE, &streams_.Stream(S_CORD_SHIP_MODE_ID), scaling_);
+  row.call_center_id = RefreshBusinessKey(
+      CALL_CENTER, &streams_.Stream(S_CORD_CALL_CENTER_ID), scaling_);
+  row.comment = GenerateText(kCommentMin, kCommentMax, &distribution_store_,
+                             &streams_.Stream(S_CORD_COMMENT));
+  row.item_base = GenerateUniformRandomInt(1, item_count_,
+                                           &streams_.Stream(S_CLIN_ITEM_ID));
+  return row;
+}
+
+void SCatalogOrderRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SCatalogOrderRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(
+      static_cast<size_t>(S_CATALOG_ORDER_END - S_CATALOG_ORDER_START + 1));
+  for (int column = S_CATALOG_ORDER_START; column <= S_CATALOG_ORDER_END;
+       ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+SCatalogOrderLineitemRowGenerator::SCatalogOrderLineitemRowGenerator(
+    double scale, int32_t refresh_run)
+    : order_generator_(scale, refresh_run),
+      scaling_(scale),
+      distribution_store_(),
+      streams_(ColumnIds()) {
+  stream_offset_ = (refresh_run - 1) * total_rows();
+  item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+  item_permutation_ = SharedPermutation(S_CLIN_PERMUTE, item_count_);
+  // Same page layout as CatalogPageRowGenerator.
+  int64_t page_count = scaling_.RowCountByTableNumber(CATALOG_PAGE);
+  pages_per_catalog_ =
+      static_cast<int>(page_count / CP_CATALOGS_PER_YEAR) /
+      (YEAR_MAXIMUM - YEAR_MINIMUM + 2);
+  pages_per_catalog_ = std::max(1, pages_per_catalog_);
+}
+
+int64_t SCatalogOrderLineitemRowGenerator::total_rows() const {
+  return order_generator_.total_rows() * kRefreshLinesPerOrder;
+}
+
+void SCatalogOrderLineitemRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+  current_order_ = start_row / kRefreshLinesPerOrder;
+  order_generator_.SkipRows(current_order_);
+}
+
+SCatalogOrderLineitemRowData SCatalogOrderLineitemRowGenerator::GenerateRow(
+    int64_t row_number) {
+  int64_t order = (row_number - 1) / kRefreshLinesPerOrder + 1;
+  if (order != current_order_) {
+    if (order != current_order_ + 1) {
+      order_generator_.SkipRows(order - 1);
+    }
+    order_ = order_generator_.GenerateRow(order);
+    order_generator_.ConsumeRemainingSeedsForRow();
+    current_order_ = order;
+  }
+
+  SCatalogOrderLineitemRowData row;
+  row.order_id = order_.order_id;
+  row.line_number =
+      static_cast<int32_t>((row_number - 1) % kRefreshLinesPerOrder) + 1;
+  int item_index = (order_.item_base - 1 + row.line_number) % item_count_ + 1;
+  row.item_id = MakeBusinessKey(static_cast<uint64_t>(
+      GetPermutationEntry(*item_permutation_, item_index)));
+  row.promotion_id = RefreshBusinessKey(
+      PROMOTION, &streams_.Stream(S_CLIN_PROMOTION_ID), scaling_);
+  SetPricing(S_CLIN_PRICING, &row.pricing, &streams_.Stream(S_CLIN_PRICING),
+             &pricing_state_);
+  row.warehouse_id = RefreshBusinessKey(
+      WAREHOUSE, &streams_.Stream(S_CLIN_WAREHOUSE_ID), scaling_);
+  row.ship_date =
+      order_.order_date +
+      GenerateUniformRandomInt(CS_MIN_SHIP_DELAY, CS_MAX_SHIP_DELAY,
+                               &streams_.Stream(S_CLIN_SHIP_DATE));
+  int64_t page = MakeJoin(S_CLIN_CATALOG_PAGE_ID, CATALOG_PAGE,
+                          order_.order_date,
+                          &streams_.Stream(S_CLIN_CATALOG_PAGE_ID), scaling_,
+                          &distribution_store_);
+  row.catalog_number =
+      static_cast<int32_t>((page - 1) / pages_per_catalog_) + 1;
+  row.catalog_page_number =
+      static_cast<int32_t>((page - 1) % pages_per_catalog_) + 1;
+  row.catalog_page = page;
+  return row;
+}
+
+void SCatalogOrderLineitemRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SCatalogOrderLineitemRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(static_cast<size_t>(S_CATALOG_ORDER_LINEITEM_END -
+                                  S_CATALOG_ORDER_LINEITEM_START + 1));
+  for (int column = S_CATALOG_ORDER_LINEITEM_START;
+       column <= S_CATALOG_ORDER_LINEITEM_END; ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,107 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "distribution/dst_distribution_store.h"
+#include "distribution/scaling.h"
+#include "utils/pricing.h"
+#include "utils/row_streams.h"
+
+namespace benchgen::tpcds::internal {
+
+struct SCatalogOrderRowData {
+  int64_t order_id = 0;
+  std::string bill_customer_id;
+  std::string ship_customer_id;
+  int32_t order_date = 0;
+  int32_t order_time = 0;
+  std::string ship_mode_id;
+  std::string call_center_id;
+  std::string comment;
+  int item_base = 0;
+};
+
+// The catalog orders of one refresh run.
+class SCatalogOrderRowGenerator {
+ public:
+  SCatalogOrderRowGenerator(double scale, int32_t refresh_run);
+
+  int64_t total_rows() const { return total_rows_; }
+  void SkipRows(int64_t start_row);
+  SCatalogOrderRowData GenerateRow(int64_t row_number);
+  void ConsumeRemainingSeedsForRow();
+
+ private:
+  static std::vector<int> ColumnIds();
+
+  Scaling scaling_;
+  DstDistributionStore distribution_store_;
+  RowStreams streams_;
+  int32_t refresh_run_ = 1;
+  int64_t total_rows_ = 0;
+  int64_t id_base_ = 0;
+  int64_t stream_offset_ = 0;
+  int item_count_ = 0;
+};
+
+struct SCatalogOrderLineitemRowData {
+  int64_t order_id = 0;
+  int32_t line_number = 0;
+  std::string item_id;
+  std::string promotion_id;
+  Pricing pricing;
+  std::string warehouse_id;
+  int32_t ship_date = 0;
+  int32_t catalog_number = 0;
+  int32_t catalog_page_number = 0;
+  // The catalog_page row of catalog_number and catalog_page_number.
+  int64_t catalog_page = 0;
+};
+
+// The kRefreshLinesPerOrder lines of every order of
+// SCatalogOrderRowGenerator.
+class SCatalogOrderLineitemRowGenerator {
+ public:
+  SCatalogOrderLineitemRowGenerator(double scale, int32_t refresh_run);
+
+  int64_t total_rows() const;
+  void SkipRows(int64_t start_row);
+  SCatalogOrderLineitemRowData GenerateRow(int64_t row_number);
+  void ConsumeRemainingSeedsForRow();
+  // The order of the last generated line.
+  const SCatalogOrderRowData& order() const { return order_; }
+
+ private:
+  static std::vector<int> ColumnIds();
+
+  SCatalogOrderRowGenerator order_generator_;
+  Scaling scaling_;
+  DstDistributionStore distribution_store_;
+  RowStreams streams_;
+  int64_t stream_offset_ = 0;
+  std::shared_ptr<const std::vector<int>> item_permutation_;
+  int item_count_ = 0;
+  int pages_per_catalog_ = 1;
+  int64_t current_order_ = 0;
+  SCatalogOrderRowData order_;
+  PricingState pricing_state_;
+};
+
+}  // namespace benchgen::tpcds::internal
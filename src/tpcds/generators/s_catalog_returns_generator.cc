@@ -0,0 +1,318 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_catalog_returns_generator.h"
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+#include "generators/s_catalog_returns_row_generator.h"
+#include "util/batch_sizer.h"
+#include "util/column_selection.h"
+#include "utils/column_profiler.h"
+#include "utils/refresh.h"
+
+namespace benchgen::tpcds {
+namespace {
+
+std::shared_ptr<arrow::Schema> BuildSCatalogReturnsSchema() {
+  return arrow::schema({
+      arrow::field("cret_call_center_id", arrow::utf8(), false),
+      arrow::field("cret_order_id", arrow::int64(), false),
+      arrow::field("cret_line_number", arrow::int32(), false),
+      arrow::field("cret_item_id", arrow::utf8(), false),
+      arrow::field("cret_return_customer_id", arrow::utf8(), false),
+      arrow::field("cret_refund_customer_id", arrow::utf8(), false),
+      arrow::field("cret_return_date", arrow::date32(), false),
+      arrow::field("cret_return_time", arrow::int32(), false),
+      arrow::field("cret_return_qty", arrow::int32(), false),
+      arrow::field("cret_return_amt", arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_return_tax", arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_return_fee", arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_return_ship_cost",
+                   arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_refunded_cash", arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_reversed_charge",
+                   arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_merchant_credit",
+                   arrow::smallest_decimal(7, 2), false),
+      arrow::field("cret_reason_id", arrow::utf8(), false),
+      arrow::field("cret_shipmode_id", arrow::utf8(), false),
+      arrow::field("cret_warehouse_id", arrow::utf8(), false),
+      arrow::field("cret_catalog_page_id", arrow::utf8(), false),
+  });
+}
+
+}  // namespace
+
+struct SCatalogReturnsGenerator::Impl {
+  explicit Impl(GeneratorOptions options)
+      : options_(std::move(options)),
+        schema_(BuildSCatalogReturnsSchema()) {}
+
+  arrow::Status Init() {
+    if (options_.chunk_size <= 0) {
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    if (options_.refresh_stream <= 0) {
+      return arrow::Status::Invalid("refresh_stream must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor, options_.refresh_stream);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
+    }
+    auto status = column_selection_.Init(schema_, options_.column_names);
+    if (!status.ok()) {
+      return status;
+    }
+    schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+    total_rows_ = row_generator_->total_rows();
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    if (start_row >= total_rows_) {
+      remaining_rows_ = 0;
+      current_row_ = start_row;
+      return arrow::Status::OK();
+    }
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
+    } else {
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
+    }
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
+  }
+
+  GeneratorOptions options_;
+  int64_t total_rows_ = 0;
+  int64_t remaining_rows_ = 0;
+  int64_t current_row_ = 0;
+  std::shared_ptr<arrow::Schema> schema_;
+  ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::SCatalogReturnsRowGenerator> row_generator_;
+};
+
+SCatalogReturnsGenerator::SCatalogReturnsGenerator(GeneratorOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {}
+
+SCatalogReturnsGenerator::~SCatalogReturnsGenerator() = default;
+
+arrow::Status SCatalogReturnsGenerator::Init() { return impl_->Init(); }
+
+std::shared_ptr<arrow::Schema> SCatalogReturnsGenerator::schema() const {
+  return impl_->schema_;
+}
+
+std::string_view SCatalogReturnsGenerator::name() const {
+  return RefreshTableIdToString(RefreshTableId::kSCatalogReturns);
+}
+
+std::string_view SCatalogReturnsGenerator::suite_name() const {
+  return "tpcds";
+}
+
+arrow::Status SCatalogReturnsGenerator::Seek(int64_t start_row,
+                                             int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
+arrow::Status SCatalogReturnsGenerator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  if (impl_->remaining_rows_ == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+
+  const int64_t batch_rows =
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
+
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  arrow::StringBuilder cret_call_center_id(pool);
+  arrow::Int64Builder cret_order_id(pool);
+  arrow::Int32Builder cret_line_number(pool);
+  arrow::StringBuilder cret_item_id(pool);
+  arrow::StringBuilder cret_return_customer_id(pool);
+  arrow::StringBuilder cret_refund_customer_id(pool);
+  arrow::Date32Builder cret_return_date(pool);
+  arrow::Int32Builder cret_return_time(pool);
+  arrow::Int32Builder cret_return_qty(pool);
+  arrow::Decimal32Builder cret_return_amt(arrow::smallest_decimal(7, 2), pool);
+  arrow::Decimal32Builder cret_return_tax(arrow::smallest_decimal(7, 2), pool);
+  arrow::Decimal32Builder cret_return_fee(arrow::smallest_decimal(7, 2), pool);
+  arrow::Decimal32Builder cret_return_ship_cost(arrow::smallest_decimal(7, 2),
+                                                pool);
+  arrow::Decimal32Builder cret_refunded_cash(arrow::smallest_decimal(7, 2),
+                                             pool);
+  arrow::Decimal32Builder cret_reversed_charge(arrow::smallest_decimal(7, 2),
+                                               pool);
+  arrow::Decimal32Builder cret_merchant_credit(arrow::smallest_decimal(7, 2),
+                                               pool);
+  arrow::StringBuilder cret_reason_id(pool);
+  arrow::StringBuilder cret_shipmode_id(pool);
+  arrow::StringBuilder cret_warehouse_id(pool);
+  arrow::StringBuilder cret_catalog_page_id(pool);
+
+#define TPCDS_RETURN_NOT_OK(status)   \
+  do {                                \
+    arrow::Status _status = (status); \
+    if (!_status.ok()) {              \
+      return _status;                 \
+    }                                 \
+  } while (false)
+
+  TPCDS_RETURN_NOT_OK(cret_call_center_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_order_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_line_number.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_item_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_customer_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_refund_customer_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_date.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_time.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_qty.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_amt.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_tax.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_fee.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_return_ship_cost.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_refunded_cash.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_reversed_charge.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_merchant_credit.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_reason_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_shipmode_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_warehouse_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(cret_catalog_page_id.Reserve(batch_rows));
+
+  for (int64_t i = 0; i < batch_rows; ++i) {
+    int64_t row_number = impl_->current_row_ + 1;
+    internal::SCatalogReturnsRowData row =
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
+
+    TPCDS_RETURN_NOT_OK(cret_call_center_id.Append(row.call_center_id));
+    TPCDS_RETURN_NOT_OK(cret_order_id.Append(row.order_id));
+    TPCDS_RETURN_NOT_OK(cret_line_number.Append(row.line_number));
+    TPCDS_RETURN_NOT_OK(cret_item_id.Append(row.item_id));
+    TPCDS_RETURN_NOT_OK(cret_return_customer_id.Append(row.return_customer_id));
+    TPCDS_RETURN_NOT_OK(cret_refund_customer_id.Append(row.refund_customer_id));
+    TPCDS_RETURN_NOT_OK(cret_return_date.Append(
+        internal::RefreshDate32(row.return_date)));
+    TPCDS_RETURN_NOT_OK(cret_return_time.Append(row.return_time));
+    TPCDS_RETURN_NOT_OK(cret_return_qty.Append(row.pricing.quantity));
+    TPCDS_RETURN_NOT_OK(cret_return_amt.Append(
+        arrow::Decimal32(row.pricing.net_paid.number)));
+    TPCDS_RETURN_NOT_OK(cret_return_tax.Append(
+        arrow::Decimal32(row.pricing.ext_tax.number)));
+    TPCDS_RETURN_NOT_OK(cret_return_fee.Append(
+        arrow::Decimal32(row.pricing.fee.number)));
+    TPCDS_RETURN_NOT_OK(cret_return_ship_cost.Append(
+        arrow::Decimal32(row.pricing.ext_ship_cost.number)));
+    TPCDS_RETURN_NOT_OK(cret_refunded_cash.Append(
+        arrow::Decimal32(row.pricing.refunded_cash.number)));
+    TPCDS_RETURN_NOT_OK(cret_reversed_charge.Append(
+        arrow::Decimal32(row.pricing.reversed_charge.number)));
+    TPCDS_RETURN_NOT_OK(cret_merchant_credit.Append(
+        arrow::Decimal32(row.pricing.store_credit.number)));
+    TPCDS_RETURN_NOT_OK(cret_reason_id.Append(row.reason_id));
+    TPCDS_RETURN_NOT_OK(cret_shipmode_id.Append(row.ship_mode_id));
+    TPCDS_RETURN_NOT_OK(cret_warehouse_id.Append(row.warehouse_id));
+    TPCDS_RETURN_NOT_OK(cret_catalog_page_id.Append(row.catalog_page_id));
+
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
+    ++impl_->current_row_;
+    --impl_->remaining_rows_;
+  }
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  arrays.reserve(20);
+  std::shared_ptr<arrow::Array> array;
+
+  TPCDS_RETURN_NOT_OK(cret_call_center_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_order_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_line_number.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_item_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_customer_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_refund_customer_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_date.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_time.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_qty.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_amt.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_tax.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_fee.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_return_ship_cost.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_refunded_cash.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_reversed_charge.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_merchant_credit.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_reason_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_shipmode_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_warehouse_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(cret_catalog_page_id.Finish(&array));
+  arrays.push_back(array);
+
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
+}
+
+int64_t SCatalogReturnsGenerator::total_rows() const {
+  return impl_->total_rows_;
+}
+
+int64_t SCatalogReturnsGenerator::remaining_rows() const {
+  return impl_->remaining_rows_;
+}
+
+int64_t SCatalogReturnsGenerator::TotalRows(double scale_factor) {
+  return internal::SCatalogReturnsRowGenerator(scale_factor, 1).total_rows();
+}
+
+}  // namespace benchgen::tpcds
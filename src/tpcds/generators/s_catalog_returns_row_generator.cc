@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_catalog_returns_row_generator.h"
+
+#include <utility>
+
+#include "utils/columns.h"
+#include "utils/constants.h"
+#include "utils/random_utils.h"
+#include "utils/refresh.h"
+#include "utils/tables.h"
+
+namespace benchgen::tpcds::internal {
+
+SCatalogReturnsRowGenerator::SCatalogReturnsRowGenerator(double scale,
+                                                         int32_t refresh_run)
+    : lineitem_generator_(scale, refresh_run),
+      scaling_(scale),
+      streams_(ColumnIds()) {
+  total_rows_ = RefreshReturnCount(lineitem_generator_.total_rows());
+  stream_offset_ = (refresh_run - 1) * total_rows_;
+}
+
+void SCatalogReturnsRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+}
+
+SCatalogReturnsRowData SCatalogReturnsRowGenerator::GenerateRow(
+    int64_t row_number) {
+  // The pricing stream picks the line and how much of it comes back.
+  auto& pricing_stream = streams_.Stream(S_CRET_PRICING);
+  int64_t line_row = RefreshReturnedLine(row_number, &pricing_stream);
+  lineitem_generator_.SkipRows(line_row - 1);
+  SCatalogOrderLineitemRowData line =
+      lineitem_generator_.GenerateRow(line_row);
+  lineitem_generator_.ConsumeRemainingSeedsForRow();
+  const SCatalogOrderRowData& order = lineitem_generator_.order();
+
+  SCatalogReturnsRowData row;
+  row.call_center_id = order.call_center_id;
+  row.order_id = line.order_id;
+  row.line_number = line.line_number;
+  row.item_id = std::move(line.item_id);
+  row.return_customer_id = order.ship_customer_id;
+  row.refund_customer_id = order.bill_customer_id;
+  row.return_date =
+      line.ship_date +
+      GenerateUniformRandomInt(CS_MIN_SHIP_DELAY, CS_MAX_SHIP_DELAY,
+                               &streams_.Stream(S_CRET_DATE));
+  row.return_time =
+      GenerateUniformRandomInt(0, 86399, &streams_.Stream(S_CRET_TIME));
+  row.pricing = line.pricing;
+  row.pricing.quantity =
+      GenerateUniformRandomInt(1, line.pricing.quantity, &pricing_stream);
+  SetPricing(S_CRET_PRICING, &row.pricing, &pricing_stream, &pricing_state_);
+  row.reason_id = RefreshBusinessKey(
+      REASON, &streams_.Stream(S_CRET_REASON_ID), scaling_);
+  row.ship_mode_id = order.ship_mode_id;
+  row.warehouse_id = std::move(line.warehouse_id);
+  row.catalog_page_id =
+      MakeBusinessKey(static_cast<uint64_t>(line.catalog_page));
+  return row;
+}
+
+void SCatalogReturnsRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SCatalogReturnsRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(static_cast<size_t>(S_CATALOG_RETURNS_END -
+                                  S_CATALOG_RETURNS_START + 1));
+  for (int column = S_CATALOG_RETURNS_START; column <= S_CATALOG_RETURNS_END;
+       ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+}  // namespace benchgen::tpcds::internal
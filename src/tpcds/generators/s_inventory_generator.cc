@@ -0,0 +1,202 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_inventory_generator.h"
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+#include "generators/s_inventory_row_generator.h"
+#include "util/batch_sizer.h"
+#include "util/column_selection.h"
+#include "utils/column_profiler.h"
+#include "utils/refresh.h"
+
+namespace benchgen::tpcds {
+namespace {
+
+std::shared_ptr<arrow::Schema> BuildSInventorySchema() {
+  return arrow::schema({
+      arrow::field("invn_warehouse_id", arrow::utf8(), false),
+      arrow::field("invn_item_id", arrow::utf8(), false),
+      arrow::field("invn_date", arrow::date32(), false),
+      arrow::field("invn_qty_on_hand", arrow::int32(), false),
+  });
+}
+
+}  // namespace
+
+struct SInventoryGenerator::Impl {
+  explicit Impl(GeneratorOptions options)
+      : options_(std::move(options)),
+        schema_(BuildSInventorySchema()) {}
+
+  arrow::Status Init() {
+    if (options_.chunk_size <= 0) {
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    if (options_.refresh_stream <= 0) {
+      return arrow::Status::Invalid("refresh_stream must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor, options_.refresh_stream);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
+    }
+    auto status = column_selection_.Init(schema_, options_.column_names);
+    if (!status.ok()) {
+      return status;
+    }
+    schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+    total_rows_ = row_generator_->total_rows();
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    if (start_row >= total_rows_) {
+      remaining_rows_ = 0;
+      current_row_ = start_row;
+      return arrow::Status::OK();
+    }
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
+    } else {
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
+    }
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
+  }
+
+  GeneratorOptions options_;
+  int64_t total_rows_ = 0;
+  int64_t remaining_rows_ = 0;
+  int64_t current_row_ = 0;
+  std::shared_ptr<arrow::Schema> schema_;
+  ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::SInventoryRowGenerator> row_generator_;
+};
+
+SInventoryGenerator::SInventoryGenerator(GeneratorOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {}
+
+SInventoryGenerator::~SInventoryGenerator() = default;
+
+arrow::Status SInventoryGenerator::Init() { return impl_->Init(); }
+
+std::shared_ptr<arrow::Schema> SInventoryGenerator::schema() const {
+  return impl_->schema_;
+}
+
+std::string_view SInventoryGenerator::name() const {
+  return RefreshTableIdToString(RefreshTableId::kSInventory);
+}
+
+std::string_view SInventoryGenerator::suite_name() const { return "tpcds"; }
+
+arrow::Status SInventoryGenerator::Seek(int64_t start_row, int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
+arrow::Status SInventoryGenerator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  if (impl_->remaining_rows_ == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+
+  const int64_t batch_rows =
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
+
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  arrow::StringBuilder invn_warehouse_id(pool);
+  arrow::StringBuilder invn_item_id(pool);
+  arrow::Date32Builder invn_date(pool);
+  arrow::Int32Builder invn_qty_on_hand(pool);
+
+#define TPCDS_RETURN_NOT_OK(status)   \
+  do {                                \
+    arrow::Status _status = (status); \
+    if (!_status.ok()) {              \
+      return _status;                 \
+    }                                 \
+  } while (false)
+
+  TPCDS_RETURN_NOT_OK(invn_warehouse_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(invn_item_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(invn_date.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(invn_qty_on_hand.Reserve(batch_rows));
+
+  for (int64_t i = 0; i < batch_rows; ++i) {
+    int64_t row_number = impl_->current_row_ + 1;
+    internal::SInventoryRowData row =
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
+
+    TPCDS_RETURN_NOT_OK(invn_warehouse_id.Append(row.warehouse_id));
+    TPCDS_RETURN_NOT_OK(invn_item_id.Append(row.item_id));
+    TPCDS_RETURN_NOT_OK(invn_date.Append(internal::RefreshDate32(row.date)));
+    TPCDS_RETURN_NOT_OK(invn_qty_on_hand.Append(row.quantity_on_hand));
+
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
+    ++impl_->current_row_;
+    --impl_->remaining_rows_;
+  }
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  arrays.reserve(4);
+  std::shared_ptr<arrow::Array> array;
+
+  TPCDS_RETURN_NOT_OK(invn_warehouse_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(invn_item_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(invn_date.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(invn_qty_on_hand.Finish(&array));
+  arrays.push_back(array);
+
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
+}
+
+int64_t SInventoryGenerator::total_rows() const { return impl_->total_rows_; }
+
+int64_t SInventoryGenerator::remaining_rows() const {
+  return impl_->remaining_rows_;
+}
+
+int64_t SInventoryGenerator::TotalRows(double scale_factor) {
+  return internal::SInventoryRowGenerator(scale_factor, 1).total_rows();
+}
+
+}  // namespace benchgen::tpcds
@@ -0,0 +1,70 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_inventory_row_generator.h"
+
+#include "utils/columns.h"
+#include "utils/constants.h"
+#include "utils/random_utils.h"
+#include "utils/refresh.h"
+#include "utils/tables.h"
+
+namespace benchgen::tpcds::internal {
+
+SInventoryRowGenerator::SInventoryRowGenerator(double scale,
+                                               int32_t refresh_run)
+    : scaling_(scale), streams_(ColumnIds()), refresh_run_(refresh_run) {
+  item_count_ = scaling_.IdCount(ITEM);
+  warehouse_count_ = scaling_.RowCountByTableNumber(WAREHOUSE);
+  stream_offset_ = (refresh_run_ - 1) * total_rows();
+}
+
+int64_t SInventoryRowGenerator::total_rows() const {
+  return item_count_ * warehouse_count_ * kRefreshWindowCount;
+}
+
+void SInventoryRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+}
+
+SInventoryRowData SInventoryRowGenerator::GenerateRow(int64_t row_number) {
+  SInventoryRowData row;
+  int64_t offset = row_number - 1;
+  int64_t item = (offset % item_count_) + 1;
+  offset /= item_count_;
+  int64_t warehouse = (offset % warehouse_count_) + 1;
+  offset /= warehouse_count_;
+  row.item_id = MakeBusinessKey(static_cast<uint64_t>(item));
+  row.warehouse_id = MakeBusinessKey(static_cast<uint64_t>(warehouse));
+  row.date = InventoryRefreshWindow(refresh_run_, static_cast<int>(offset))
+                 .first_julian;
+  row.quantity_on_hand = GenerateUniformRandomInt(
+      INV_QUANTITY_MIN, INV_QUANTITY_MAX, &streams_.Stream(S_INVN_QUANTITY));
+  return row;
+}
+
+void SInventoryRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SInventoryRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(static_cast<size_t>(S_INVENTORY_END - S_INVENTORY_START + 1));
+  for (int column = S_INVENTORY_START; column <= S_INVENTORY_END; ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,55 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "distribution/scaling.h"
+#include "utils/row_streams.h"
+
+namespace benchgen::tpcds::internal {
+
+struct SInventoryRowData {
+  std::string warehouse_id;
+  std::string item_id;
+  int32_t date = 0;
+  int32_t quantity_on_hand = 0;
+};
+
+// The inventory counts of one refresh run: every item in every warehouse
+// for each of its inventory weeks, in the order InventoryRowGenerator uses.
+class SInventoryRowGenerator {
+ public:
+  SInventoryRowGenerator(double scale, int32_t refresh_run);
+
+  int64_t total_rows() const;
+  void SkipRows(int64_t start_row);
+  SInventoryRowData GenerateRow(int64_t row_number);
+  void ConsumeRemainingSeedsForRow();
+
+ private:
+  static std::vector<int> ColumnIds();
+
+  Scaling scaling_;
+  RowStreams streams_;
+  int32_t refresh_run_ = 1;
+  int64_t item_count_ = 0;
+  int64_t warehouse_count_ = 0;
+  int64_t stream_offset_ = 0;
+};
+
+}  // namespace benchgen::tpcds::internal
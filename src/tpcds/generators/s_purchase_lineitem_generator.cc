@@ -0,0 +1,233 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_purchase_lineitem_generator.h"
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+#include "generators/s_purchase_row_generator.h"
+#include "util/batch_sizer.h"
+#include "util/column_selection.h"
+#include "utils/column_profiler.h"
+#include "utils/refresh.h"
+
+namespace benchgen::tpcds {
+namespace {
+
+std::shared_ptr<arrow::Schema> BuildSPurchaseLineitemSchema() {
+  return arrow::schema({
+      arrow::field("plin_purchase_id", arrow::int64(), false),
+      arrow::field("plin_line_number", arrow::int32(), false),
+      arrow::field("plin_item_id", arrow::utf8(), false),
+      arrow::field("plin_promotion_id", arrow::utf8(), false),
+      arrow::field("plin_quantity", arrow::int32(), false),
+      arrow::field("plin_sale_price", arrow::smallest_decimal(7, 2), false),
+      arrow::field("plin_coupon_amt", arrow::smallest_decimal(7, 2), false),
+      arrow::field("plin_comment", arrow::utf8(), false),
+  });
+}
+
+}  // namespace
+
+struct SPurchaseLineitemGenerator::Impl {
+  explicit Impl(GeneratorOptions options)
+      : options_(std::move(options)),
+        schema_(BuildSPurchaseLineitemSchema()) {}
+
+  arrow::Status Init() {
+    if (options_.chunk_size <= 0) {
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    if (options_.refresh_stream <= 0) {
+      return arrow::Status::Invalid("refresh_stream must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor, options_.refresh_stream);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
+    }
+    auto status = column_selection_.Init(schema_, options_.column_names);
+    if (!status.ok()) {
+      return status;
+    }
+    schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+    total_rows_ = row_generator_->total_rows();
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    if (start_row >= total_rows_) {
+      remaining_rows_ = 0;
+      current_row_ = start_row;
+      return arrow::Status::OK();
+    }
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
+    } else {
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
+    }
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
+  }
+
+  GeneratorOptions options_;
+  int64_t total_rows_ = 0;
+  int64_t remaining_rows_ = 0;
+  int64_t current_row_ = 0;
+  std::shared_ptr<arrow::Schema> schema_;
+  ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::SPurchaseLineitemRowGenerator> row_generator_;
+};
+
+SPurchaseLineitemGenerator::SPurchaseLineitemGenerator(GeneratorOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {}
+
+SPurchaseLineitemGenerator::~SPurchaseLineitemGenerator() = default;
+
+arrow::Status SPurchaseLineitemGenerator::Init() { return impl_->Init(); }
+
+std::shared_ptr<arrow::Schema> SPurchaseLineitemGenerator::schema() const {
+  return impl_->schema_;
+}
+
+std::string_view SPurchaseLineitemGenerator::name() const {
+  return RefreshTableIdToString(RefreshTableId::kSPurchaseLineitem);
+}
+
+std::string_view SPurchaseLineitemGenerator::suite_name() const {
+  return "tpcds";
+}
+
+arrow::Status SPurchaseLineitemGenerator::Seek(int64_t start_row,
+                                               int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
+arrow::Status SPurchaseLineitemGenerator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  if (impl_->remaining_rows_ == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+
+  const int64_t batch_rows =
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
+
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  arrow::Int64Builder plin_purchase_id(pool);
+  arrow::Int32Builder plin_line_number(pool);
+  arrow::StringBuilder plin_item_id(pool);
+  arrow::StringBuilder plin_promotion_id(pool);
+  arrow::Int32Builder plin_quantity(pool);
+  arrow::Decimal32Builder plin_sale_price(arrow::smallest_decimal(7, 2), pool);
+  arrow::Decimal32Builder plin_coupon_amt(arrow::smallest_decimal(7, 2), pool);
+  arrow::StringBuilder plin_comment(pool);
+
+#define TPCDS_RETURN_NOT_OK(status)   \
+  do {                                \
+    arrow::Status _status = (status); \
+    if (!_status.ok()) {              \
+      return _status;                 \
+    }                                 \
+  } while (false)
+
+  TPCDS_RETURN_NOT_OK(plin_purchase_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_line_number.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_item_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_promotion_id.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_quantity.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_sale_price.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_coupon_amt.Reserve(batch_rows));
+  TPCDS_RETURN_NOT_OK(plin_comment.Reserve(batch_rows));
+
+  for (int64_t i = 0; i < batch_rows; ++i) {
+    int64_t row_number = impl_->current_row_ + 1;
+    internal::SPurchaseLineitemRowData row =
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
+
+    TPCDS_RETURN_NOT_OK(plin_purchase_id.Append(row.purchase_id));
+    TPCDS_RETURN_NOT_OK(plin_line_number.Append(row.line_number));
+    TPCDS_RETURN_NOT_OK(plin_item_id.Append(row.item_id));
+    TPCDS_RETURN_NOT_OK(plin_promotion_id.Append(row.promotion_id));
+    TPCDS_RETURN_NOT_OK(plin_quantity.Append(row.pricing.quantity));
+    TPCDS_RETURN_NOT_OK(plin_sale_price.Append(
+        arrow::Decimal32(row.pricing.sales_price.number)));
+    TPCDS_RETURN_NOT_OK(plin_coupon_amt.Append(
+        arrow::Decimal32(row.pricing.coupon_amt.number)));
+    TPCDS_RETURN_NOT_OK(plin_comment.Append(row.comment));
+
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
+    ++impl_->current_row_;
+    --impl_->remaining_rows_;
+  }
+
+  std::vector<std::shared_ptr<arrow::Array>> arrays;
+  arrays.reserve(8);
+  std::shared_ptr<arrow::Array> array;
+
+  TPCDS_RETURN_NOT_OK(plin_purchase_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_line_number.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_item_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_promotion_id.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_quantity.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_sale_price.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_coupon_amt.Finish(&array));
+  arrays.push_back(array);
+  TPCDS_RETURN_NOT_OK(plin_comment.Finish(&array));
+  arrays.push_back(array);
+
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
+}
+
+int64_t SPurchaseLineitemGenerator::total_rows() const {
+  return impl_->total_rows_;
+}
+
+int64_t SPurchaseLineitemGenerator::remaining_rows() const {
+  return impl_->remaining_rows_;
+}
+
+int64_t SPurchaseLineitemGenerator::TotalRows(double scale_factor) {
+  return internal::SPurchaseLineitemRowGenerator(scale_factor, 1).total_rows();
+}
+
+}  // namespace benchgen::tpcds
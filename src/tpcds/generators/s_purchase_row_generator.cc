@@ -0,0 +1,152 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_purchase_row_generator.h"
+
+#include "utils/column_streams.h"
+#include "utils/columns.h"
+#include "utils/permute.h"
+#include "utils/random_utils.h"
+#include "utils/refresh.h"
+#include "utils/tables.h"
+#include "utils/text.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+constexpr int kCommentMin = 60;
+constexpr int kCommentMax = 100;
+constexpr int kRegisterMax = 17;
+constexpr int kClerkMin = 101;
+constexpr int kClerkMax = 300;
+
+}  // namespace
+
+SPurchaseRowGenerator::SPurchaseRowGenerator(double scale,
+                                             int32_t refresh_run)
+    : scaling_(scale),
+      distribution_store_(),
+      streams_(ColumnIds()),
+      refresh_run_(refresh_run) {
+  total_rows_ = RefreshOrderCount(S_PURCHASE, scaling_);
+  id_base_ = RefreshOrderIdBase(S_PURCHASE, refresh_run_, scaling_);
+  stream_offset_ = (refresh_run_ - 1) * total_rows_;
+  item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+}
+
+void SPurchaseRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+}
+
+SPurchaseRowData SPurchaseRowGenerator::GenerateRow(int64_t row_number) {
+  SPurchaseRowData row;
+  row.purchase_id = id_base_ + row_number;
+  row.store_id = RefreshBusinessKey(
+      STORE, &streams_.Stream(S_PURCHASE_STORE_ID), scaling_);
+  row.customer_id = RefreshBusinessKey(
+      CUSTOMER, &streams_.Stream(S_PURCHASE_CUSTOMER_ID), scaling_);
+  row.purchase_date =
+      RefreshSalesDate(refresh_run_, &streams_.Stream(S_PURCHASE_DATE));
+  row.purchase_time = GenerateUniformRandomInt(
+      0, 86399, &streams_.Stream(S_PURCHASE_TIME));
+  row.register_id = GenerateUniformRandomInt(
+      1, kRegisterMax, &streams_.Stream(S_PURCHASE_REGISTER));
+  row.clerk_id = GenerateUniformRandomInt(kClerkMin, kClerkMax,
+                                          &streams_.Stream(S_PURCHASE_CLERK));
+  row.comment = GenerateText(kCommentMin, kCommentMax, &distribution_store_,
+                             &streams_.Stream(S_PURCHASE_COMMENT));
+  row.item_base = GenerateUniformRandomInt(1, item_count_,
+                                           &streams_.Stream(S_PLINE_ITEM_ID));
+  return row;
+}
+
+void SPurchaseRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SPurchaseRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(static_cast<size_t>(S_PURCHASE_END - S_PURCHASE_START + 1));
+  for (int column = S_PURCHASE_START; column <= S_PURCHASE_END; ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+SPurchaseLineitemRowGenerator::SPurchaseLineitemRowGenerator(
+    double scale, int32_t refresh_run)
+    : purchase_generator_(scale, refresh_run),
+      scaling_(scale),
+      distribution_store_(),
+      streams_(ColumnIds()) {
+  stream_offset_ = (refresh_run - 1) * total_rows();
+  item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+  item_permutation_ = SharedPermutation(S_PLINE_PERMUTE, item_count_);
+}
+
+int64_t SPurchaseLineitemRowGenerator::total_rows() const {
+  return purchase_generator_.total_rows() * kRefreshLinesPerOrder;
+}
+
+void SPurchaseLineitemRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+  current_purchase_ = start_row / kRefreshLinesPerOrder;
+  purchase_generator_.SkipRows(current_purchase_);
+}
+
+SPurchaseLineitemRowData SPurchaseLineitemRowGenerator::GenerateRow(
+    int64_t row_number) {
+  int64_t purchase = (row_number - 1) / kRefreshLinesPerOrder + 1;
+  if (purchase != current_purchase_) {
+    if (purchase != current_purchase_ + 1) {
+      purchase_generator_.SkipRows(purchase - 1);
+    }
+    purchase_ = purchase_generator_.GenerateRow(purchase);
+    purchase_generator_.ConsumeRemainingSeedsForRow();
+    current_purchase_ = purchase;
+  }
+
+  SPurchaseLineitemRowData row;
+  row.purchase_id = purchase_.purchase_id;
+  row.line_number =
+      static_cast<int32_t>((row_number - 1) % kRefreshLinesPerOrder) + 1;
+  int item_index =
+      (purchase_.item_base - 1 + row.line_number) % item_count_ + 1;
+  row.item_id = MakeBusinessKey(static_cast<uint64_t>(
+      GetPermutationEntry(*item_permutation_, item_index)));
+  row.promotion_id = RefreshBusinessKey(
+      PROMOTION, &streams_.Stream(S_PLINE_PROMOTION_ID), scaling_);
+  SetPricing(S_PLINE_PRICING, &row.pricing,
+             &streams_.Stream(S_PLINE_PRICING), &pricing_state_);
+  row.comment = GenerateText(kCommentMin, kCommentMax, &distribution_store_,
+                             &streams_.Stream(S_PLINE_COMMENT));
+  return row;
+}
+
+void SPurchaseLineitemRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SPurchaseLineitemRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(static_cast<size_t>(S_PURCHASE_LINEITEM_END -
+                                  S_PURCHASE_LINEITEM_START + 1));
+  for (int column = S_PURCHASE_LINEITEM_START;
+       column <= S_PURCHASE_LINEITEM_END; ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+}  // namespace benchgen::tpcds::internal
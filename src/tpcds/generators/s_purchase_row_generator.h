@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "distribution/dst_distribution_store.h"
+#include "distribution/scaling.h"
+#include "utils/pricing.h"
+#include "utils/row_streams.h"
+
+namespace benchgen::tpcds::internal {
+
+struct SPurchaseRowData {
+  int64_t purchase_id = 0;
+  std::string store_id;
+  std::string customer_id;
+  int32_t purchase_date = 0;
+  int32_t purchase_time = 0;
+  int32_t register_id = 0;
+  int32_t clerk_id = 0;
+  std::string comment;
+  int item_base = 0;
+};
+
+// The store purchases (tickets) of one refresh run.
+class SPurchaseRowGenerator {
+ public:
+  SPurchaseRowGenerator(double scale, int32_t refresh_run);
+
+  int64_t total_rows() const { return total_rows_; }
+  void SkipRows(int64_t start_row);
+  SPurchaseRowData GenerateRow(int64_t row_number);
+  void ConsumeRemainingSeedsForRow();
+
+ private:
+  static std::vector<int> ColumnIds();
+
+  Scaling scaling_;
+  DstDistributionStore distribution_store_;
+  RowStreams streams_;
+  int32_t refresh_run_ = 1;
+  int64_t total_rows_ = 0;
+  int64_t id_base_ = 0;
+  int64_t stream_offset_ = 0;
+  int item_count_ = 0;
+};
+
+struct SPurchaseLineitemRowData {
+  int64_t purchase_id = 0;
+  int32_t line_number = 0;
+  std::string item_id;
+  std::string promotion_id;
+  Pricing pricing;
+  std::string comment;
+};
+
+// The kRefreshLinesPerOrder lines of every purchase of SPurchaseRowGenerator.
+class SPurchaseLineitemRowGenerator {
+ public:
+  SPurchaseLineitemRowGenerator(double scale, int32_t refresh_run);
+
+  int64_t total_rows() const;
+  void SkipRows(int64_t start_row);
+  SPurchaseLineitemRowData GenerateRow(int64_t row_number);
+  void ConsumeRemainingSeedsForRow();
+  // The purchase of the last generated line.
+  const SPurchaseRowData& purchase() const { return purchase_; }
+
+ private:
+  static std::vector<int> ColumnIds();
+
+  SPurchaseRowGenerator purchase_generator_;
+  Scaling scaling_;
+  DstDistributionStore distribution_store_;
+  RowStreams streams_;
+  int64_t stream_offset_ = 0;
+  std::shared_ptr<const std::vector<int>> item_permutation_;
+  int item_count_ = 0;
+  int64_t current_purchase_ = 0;
+  SPurchaseRowData purchase_;
+  PricingState pricing_state_;
+};
+
+}  // namespace benchgen::tpcds::internal
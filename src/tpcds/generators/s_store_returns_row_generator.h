@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "distribution/scaling.h"
+#include "generators/s_purchase_row_generator.h"
+#include "utils/pricing.h"
+#include "utils/row_streams.h"
+
+namespace benchgen::tpcds::internal {
+
+struct SStoreReturnsRowData {
+  std::string store_id;
+  int64_t purchase_id = 0;
+  int32_t line_number = 0;
+  std::string item_id;
+  std::string customer_id;
+  int32_t return_date = 0;
+  int32_t return_time = 0;
+  std::string reason_id;
+  Pricing pricing;
+};
+
+// The returned s_purchase_lineitem lines of one refresh run, one in every
+// kRefreshReturnInterval lines.
+class SStoreReturnsRowGenerator {
+ public:
+  SStoreReturnsRowGenerator(double scale, int32_t refresh_run);
+
+  int64_t total_rows() const { return total_rows_; }
+  void SkipRows(int64_t start_row);
+  SStoreReturnsRowData GenerateRow(int64_t row_number);
+  void ConsumeRemainingSeedsForRow();
+
+ private:
+  static std::vector<int> ColumnIds();
+
+  SPurchaseLineitemRowGenerator lineitem_generator_;
+  Scaling scaling_;
+  RowStreams streams_;
+  int64_t total_rows_ = 0;
+  int64_t stream_offset_ = 0;
+  PricingState pricing_state_;
+};
+
+}  // namespace benchgen::tpcds::internal
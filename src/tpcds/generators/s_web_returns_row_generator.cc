@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/s_web_returns_row_generator.h"
+
+#include <utility>
+
+#include "utils/columns.h"
+#include "utils/constants.h"
+#include "utils/random_utils.h"
+#include "utils/refresh.h"
+#include "utils/tables.h"
+
+namespace benchgen::tpcds::internal {
+
+SWebReturnsRowGenerator::SWebReturnsRowGenerator(double scale,
+                                                 int32_t refresh_run)
+    : lineitem_generator_(scale, refresh_run),
+      scaling_(scale),
+      streams_(ColumnIds()) {
+  total_rows_ = RefreshReturnCount(lineitem_generator_.total_rows());
+  stream_offset_ = (refresh_run - 1) * total_rows_;
+}
+
+void SWebReturnsRowGenerator::SkipRows(int64_t start_row) {
+  streams_.SkipRows(stream_offset_ + start_row);
+}
+
+SWebReturnsRowData SWebReturnsRowGenerator::GenerateRow(int64_t row_number) {
+  // The pricing stream picks the line and how much of it comes back.
+  auto& pricing_stream = streams_.Stream(S_WRET_PRICING);
+  int64_t line_row = RefreshReturnedLine(row_number, &pricing_stream);
+  lineitem_generator_.SkipRows(line_row - 1);
+  SWebOrderLineitemRowData line = lineitem_generator_.GenerateRow(line_row);
+  lineitem_generator_.ConsumeRemainingSeedsForRow();
+  const SWebOrderRowData& order = lineitem_generator_.order();
+
+  SWebReturnsRowData row;
+  row.web_site_id = order.web_site_id;
+  row.order_id = line.order_id;
+  row.line_number = line.line_number;
+  row.item_id = std::move(line.item_id);
+  row.return_customer_id = order.ship_customer_id;
+  row.refund_customer_id = order.bill_customer_id;
+  row.return_date =
+      line.ship_date +
+      GenerateUniformRandomInt(WS_MIN_SHIP_DELAY, WS_MAX_SHIP_DELAY,
+                               &streams_.Stream(S_WRET_RETURN_DATE));
+  row.return_time = GenerateUniformRandomInt(
+      0, 86399, &streams_.Stream(S_WRET_RETURN_TIME));
+  row.pricing = line.pricing;
+  row.pricing.quantity =
+      GenerateUniformRandomInt(1, line.pricing.quantity, &pricing_stream);
+  SetPricing(S_WRET_PRICING, &row.pricing, &pricing_stream, &pricing_state_);
+  row.reason_id = RefreshBusinessKey(
+      REASON, &streams_.Stream(S_WRET_REASON_ID), scaling_);
+  return row;
+}
+
+void SWebReturnsRowGenerator::ConsumeRemainingSeedsForRow() {
+  streams_.ConsumeRemainingSeedsForRow();
+}
+
+std::vector<int> SWebReturnsRowGenerator::ColumnIds() {
+  std::vector<int> ids;
+  ids.reserve(
+      static_cast<size_t>(S_WEB_RETURNS_END - S_WEB_RETURNS_START + 1));
+  for (int column = S_WEB_RETURNS_START; column <= S_WEB_RETURNS_END;
+       ++column) {
+    ids.push_back(column);
+  }
+  return ids;
+}
+
+}  // namespace benchgen::tpcds::internal
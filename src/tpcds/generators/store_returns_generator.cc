@@ -15,12 +15,15 @@
 #include "generators/store_returns_generator.h"
 
 #include <algorithm>
-#include <stdexcept>
+#include <exception>
+#include <optional>
 #include <string>
 
 #include "distribution/scaling.h"
 #include "generators/store_returns_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/column_streams.h"
 #include "utils/columns.h"
 #include "utils/constants.h"
@@ -91,33 +94,48 @@ int64_t ComputeStoreReturnsRows(double scale_factor) {
 struct StoreReturnsGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildStoreReturnsSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildStoreReturnsSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ = ComputeStoreReturnsRows(options_.scale_factor);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -126,7 +144,8 @@ struct StoreReturnsGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::StoreReturnsRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::StoreReturnsRowGenerator> row_generator_;
 };
 
 StoreReturnsGenerator::StoreReturnsGenerator(GeneratorOptions options)
@@ -134,6 +153,8 @@ StoreReturnsGenerator::StoreReturnsGenerator(GeneratorOptions options)
 
 StoreReturnsGenerator::~StoreReturnsGenerator() = default;
 
+arrow::Status StoreReturnsGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> StoreReturnsGenerator::schema() const {
   return impl_->schema_;
 }
@@ -144,15 +165,26 @@ std::string_view StoreReturnsGenerator::name() const {
 
 std::string_view StoreReturnsGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status StoreReturnsGenerator::Seek(int64_t start_row,
+                                          int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status StoreReturnsGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int32Builder sr_returned_date_sk(pool);
@@ -216,7 +248,8 @@ arrow::Status StoreReturnsGenerator::Next(
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t row_number = impl_->current_row_ + 1;
     internal::StoreReturnsRowData row =
-        impl_->row_generator_.GenerateRow(row_number);
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, STORE_RETURNS, column_id);
@@ -317,7 +350,7 @@ arrow::Status StoreReturnsGenerator::Next(
     TPCDS_RETURN_NOT_OK(append_decimal(sr_pricing_net_loss, SR_PRICING_NET_LOSS,
                                        row.pricing.net_loss));
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
   }
@@ -367,8 +400,10 @@ arrow::Status StoreReturnsGenerator::Next(
   TPCDS_RETURN_NOT_OK(sr_pricing_net_loss.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t StoreReturnsGenerator::total_rows() const { return impl_->total_rows_; }
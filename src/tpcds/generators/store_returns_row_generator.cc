@@ -30,12 +30,46 @@ StoreReturnsRowGenerator::StoreReturnsRowGenerator(
     : scaling_(scale),
       distribution_store_(),
       streams_(ColumnIds()),
-      sales_generator_(scale) {}
+      sales_generator_(scale),
+      ticket_cursor_(SS_TICKET_NUMBER, 8, 16, SR_IS_RETURNED, SR_RETURN_PCT) {}
 
 void StoreReturnsRowGenerator::SkipRows(int64_t start_row) {
-  pricing_state_ = PricingState();
-  for (int64_t i = 0; i < start_row; ++i) {
-    GenerateRow(i + 1);
+  // Returns are derived from a replay of the sales stream, so only forward
+  // skips can continue from the current position.
+  if (start_row < rows_generated_) {
+    sales_generator_.SkipRows(0);
+    streams_.SkipRows(0);
+    current_order_ = 0;
+    pending_returns_.clear();
+    pending_index_ = 0;
+    pricing_state_ = PricingState();
+    rows_generated_ = 0;
+  }
+  while (rows_generated_ < start_row &&
+         pending_index_ < pending_returns_.size()) {
+    ++pending_index_;
+    ++rows_generated_;
+  }
+  // Tickets whose returns all precede start_row are counted from the ticket
+  // size and is-returned streams without generating their sales.
+  ticket_cursor_.MoveTo(current_order_);
+  int64_t rows = rows_generated_;
+  while (rows < start_row &&
+         rows + ticket_cursor_.next_returns() <= start_row) {
+    rows += ticket_cursor_.next_returns();
+    ticket_cursor_.Advance();
+  }
+  if (ticket_cursor_.order_count() > current_order_) {
+    current_order_ = ticket_cursor_.order_count();
+    sales_generator_.SkipRows(ticket_cursor_.sales_rows());
+    streams_.SkipRows(current_order_);
+    pending_returns_.clear();
+    pending_index_ = 0;
+    pricing_state_ = PricingState();
+    rows_generated_ = rows;
+  }
+  while (rows_generated_ < start_row) {
+    GenerateRow(rows_generated_ + 1);
   }
 }
 
@@ -46,6 +80,7 @@ StoreReturnsRowData StoreReturnsRowGenerator::GenerateRow(int64_t row_number) {
     pending_index_ = 0;
     LoadNextReturns();
   }
+  ++rows_generated_;
   return pending_returns_[pending_index_++];
 }
 
@@ -15,12 +15,15 @@
 #include "generators/store_sales_generator.h"
 
 #include <algorithm>
-#include <stdexcept>
+#include <exception>
+#include <optional>
 #include <string>
 
 #include "distribution/scaling.h"
 #include "generators/store_sales_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/column_streams.h"
 #include "utils/columns.h"
 #include "utils/decimal.h"
@@ -76,69 +79,57 @@ int64_t ComputeStoreSalesLineItems(double scale_factor) {
   return total;
 }
 
-int64_t OrderNumberForRow(int64_t row_number, int column_id, int min_items,
-                          int max_items) {
-  if (row_number <= 1) {
-    return 1;
-  }
-  internal::RandomNumberStream stream(column_id,
-                                      internal::SeedsPerRow(column_id));
-  int64_t ticket_start_row = 1;
-  int64_t order_number = 1;
-  while (true) {
-    int items =
-        internal::GenerateUniformRandomInt(min_items, max_items, &stream);
-    while (stream.seeds_used() < stream.seeds_per_row()) {
-      internal::GenerateUniformRandomInt(1, 100, &stream);
-    }
-    stream.ResetSeedsUsed();
-    int64_t ticket_end_row = ticket_start_row + items - 1;
-    if (row_number <= ticket_end_row) {
-      return order_number;
-    }
-    ticket_start_row = ticket_end_row + 1;
-    ++order_number;
-  }
-}
-
 }  // namespace
 
 struct StoreSalesGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildStoreSalesSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildStoreSalesSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_orders_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(STORE_SALES);
     total_rows_ = ComputeStoreSalesLineItems(options_.scale_factor);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
-    int64_t next_row = options_.start_row + 1;
-    int64_t order_number = OrderNumberForRow(next_row, SS_TICKET_NUMBER, 8, 16);
-    current_order_ = order_number - 1;
+    row_generator_->SkipRows(start_row);
+    current_order_ = row_generator_->NextOrderNumber() - 1;
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -149,7 +140,8 @@ struct StoreSalesGenerator::Impl {
   int64_t current_order_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::StoreSalesRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::StoreSalesRowGenerator> row_generator_;
 };
 
 StoreSalesGenerator::StoreSalesGenerator(GeneratorOptions options)
@@ -157,6 +149,8 @@ StoreSalesGenerator::StoreSalesGenerator(GeneratorOptions options)
 
 StoreSalesGenerator::~StoreSalesGenerator() = default;
 
+arrow::Status StoreSalesGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> StoreSalesGenerator::schema() const {
   return impl_->schema_;
 }
@@ -167,15 +161,25 @@ std::string_view StoreSalesGenerator::name() const {
 
 std::string_view StoreSalesGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status StoreSalesGenerator::Seek(int64_t start_row, int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status StoreSalesGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int32Builder ss_sold_date_sk(pool);
@@ -249,7 +253,8 @@ arrow::Status StoreSalesGenerator::Next(
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t order_number = impl_->current_order_ + 1;
     internal::StoreSalesRowData row =
-        impl_->row_generator_.GenerateRow(order_number);
+        impl_->row_generator_->GenerateRow(order_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, STORE_SALES, column_id);
@@ -358,11 +363,11 @@ arrow::Status StoreSalesGenerator::Next(
     TPCDS_RETURN_NOT_OK(append_decimal(
         ss_pricing_net_profit, SS_PRICING_NET_PROFIT, row.pricing.net_profit));
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
 
-    if (impl_->row_generator_.LastRowInTicket()) {
+    if (impl_->row_generator_->LastRowInTicket()) {
       impl_->current_order_ = order_number;
     }
   }
@@ -418,8 +423,10 @@ arrow::Status StoreSalesGenerator::Next(
   TPCDS_RETURN_NOT_OK(ss_pricing_net_profit.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t StoreSalesGenerator::total_rows() const { return impl_->total_rows_; }
@@ -27,59 +27,17 @@
 #include "utils/random_utils.h"
 #include "utils/scd.h"
 #include "utils/tables.h"
+#include "utils/ticket_cursor.h"
 
 namespace benchgen::tpcds::internal {
-namespace {
-
-struct TicketOffset {
-  int64_t order_number = 1;
-  int64_t ticket_start_row = 1;
-  int64_t rows_into_ticket = 0;
-  int64_t prev_order_number = 0;
-  int64_t prev_ticket_start_row = 1;
-};
-
-TicketOffset FindTicketOffset(int64_t start_row, int column_id, int min_items,
-                              int max_items) {
-  TicketOffset offset;
-  if (start_row <= 0) {
-    return offset;
-  }
-  RandomNumberStream stream(column_id, SeedsPerRow(column_id));
-  int64_t ticket_start_row = 1;
-  int64_t order_number = 1;
-  int64_t prev_ticket_start_row = 1;
-  int64_t prev_order_number = 0;
-  while (true) {
-    int items = GenerateUniformRandomInt(min_items, max_items, &stream);
-    while (stream.seeds_used() < stream.seeds_per_row()) {
-      GenerateUniformRandomInt(1, 100, &stream);
-    }
-    stream.ResetSeedsUsed();
-    int64_t ticket_end_row = ticket_start_row + items - 1;
-    if (start_row <= ticket_end_row) {
-      offset.order_number = order_number;
-      offset.ticket_start_row = ticket_start_row;
-      offset.rows_into_ticket = start_row - ticket_start_row + 1;
-      offset.prev_order_number = prev_order_number;
-      offset.prev_ticket_start_row = prev_ticket_start_row;
-      return offset;
-    }
-    prev_ticket_start_row = ticket_start_row;
-    prev_order_number = order_number;
-    ticket_start_row = ticket_end_row + 1;
-    ++order_number;
-  }
-}
-
-}  // namespace
-
 StoreSalesRowGenerator::StoreSalesRowGenerator(
     double scale)
     : scaling_(scale),
       distribution_store_(),
-      streams_(ColumnIds()) {
+      streams_(ColumnIds()),
+      ticket_cursor_(SS_TICKET_NUMBER, 8, 16) {
   item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+  item_permutation_ = SharedPermutation(SS_PERMUTATION, item_count_);
   remaining_items_ = 0;
   last_row_in_ticket_ = true;
 }
@@ -92,24 +50,23 @@ void StoreSalesRowGenerator::SkipRows(int64_t start_row) {
   pricing_state_ = PricingState();
   julian_date_ = 0;
   next_date_index_ = 0;
-  if (item_permutation_.empty()) {
-    RandomNumberStream perm_stream(SS_PERMUTATION, SeedsPerRow(SS_PERMUTATION));
-    item_permutation_ = MakePermutation(item_count_, &perm_stream);
-  }
+  next_order_number_ = 1;
   if (start_row <= 0) {
     streams_.SkipRows(0);
     return;
   }
-  TicketOffset offset = FindTicketOffset(start_row, SS_TICKET_NUMBER, 8, 16);
-  streams_.SkipRows(offset.order_number - 1);
-  int64_t order_number = offset.order_number;
-  for (int64_t i = 0; i < offset.rows_into_ticket; ++i) {
+  ticket_cursor_.MoveTo(start_row);
+  streams_.SkipRows(ticket_cursor_.order_number() - 1);
+  int64_t order_number = ticket_cursor_.order_number();
+  int64_t rows_into_ticket = start_row - ticket_cursor_.ticket_start_row() + 1;
+  for (int64_t i = 0; i < rows_into_ticket; ++i) {
     GenerateRow(order_number);
     ConsumeRemainingSeedsForRow();
     if (LastRowInTicket()) {
       ++order_number;
     }
   }
+  next_order_number_ = order_number;
 }
 
 StoreSalesRowData StoreSalesRowGenerator::GenerateRow(int64_t row_number) {
@@ -120,7 +77,6 @@ StoreSalesRowData StoreSalesRowGenerator::GenerateRow(int64_t row_number) {
     ticket_info_ = BuildTicketInfo(row_number);
     remaining_items_ =
         GenerateUniformRandomInt(8, 16, &streams_.Stream(SS_TICKET_NUMBER));
-    EnsurePermutation();
     ticket_item_base_ = GenerateUniformRandomInt(
         1, item_count_, &streams_.Stream(SS_SOLD_ITEM_SK));
     last_row_in_ticket_ = false;
@@ -139,7 +95,7 @@ StoreSalesRowData StoreSalesRowGenerator::GenerateRow(int64_t row_number) {
   if (ticket_item_base_ > item_count_) {
     ticket_item_base_ = 1;
   }
-  int item_key = GetPermutationEntry(item_permutation_, ticket_item_base_);
+  int item_key = GetPermutationEntry(*item_permutation_, ticket_item_base_);
   row.sold_item_sk = MatchSCDSK(item_key, row.sold_date_sk, ITEM, scaling_);
 
   row.sold_promo_sk = MakeJoin(SS_SOLD_PROMO_SK, PROMOTION, 1,
@@ -181,13 +137,6 @@ std::vector<int> StoreSalesRowGenerator::ColumnIds() {
   return ids;
 }
 
-void StoreSalesRowGenerator::EnsurePermutation() {
-  if (item_permutation_.empty()) {
-    item_permutation_ =
-        MakePermutation(item_count_, &streams_.Stream(SS_PERMUTATION));
-  }
-}
-
 void StoreSalesRowGenerator::EnsureDateState() {
   if (julian_date_ == 0) {
     const auto& calendar = distribution_store_.Get("calendar");
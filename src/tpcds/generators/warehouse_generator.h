@@ -28,10 +28,13 @@ class WarehouseGenerator final : public RecordBatchIterator {
   explicit WarehouseGenerator(GeneratorOptions options);
   ~WarehouseGenerator() override;
 
+  arrow::Status Init();
+
   std::shared_ptr<arrow::Schema> schema() const override;
   std::string_view name() const override;
   std::string_view suite_name() const override;
   arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
 
   int64_t total_rows() const;
   int64_t remaining_rows() const;
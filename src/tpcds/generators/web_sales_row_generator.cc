@@ -26,58 +26,16 @@
 #include "utils/random_utils.h"
 #include "utils/scd.h"
 #include "utils/tables.h"
+#include "utils/ticket_cursor.h"
 
 namespace benchgen::tpcds::internal {
-namespace {
-
-struct TicketOffset {
-  int64_t order_number = 1;
-  int64_t ticket_start_row = 1;
-  int64_t rows_into_ticket = 0;
-  int64_t prev_order_number = 0;
-  int64_t prev_ticket_start_row = 1;
-};
-
-TicketOffset FindTicketOffset(int64_t start_row, int column_id, int min_items,
-                              int max_items) {
-  TicketOffset offset;
-  if (start_row <= 0) {
-    return offset;
-  }
-  RandomNumberStream stream(column_id, SeedsPerRow(column_id));
-  int64_t ticket_start_row = 1;
-  int64_t order_number = 1;
-  int64_t prev_ticket_start_row = 1;
-  int64_t prev_order_number = 0;
-  while (true) {
-    int items = GenerateUniformRandomInt(min_items, max_items, &stream);
-    while (stream.seeds_used() < stream.seeds_per_row()) {
-      GenerateUniformRandomInt(1, 100, &stream);
-    }
-    stream.ResetSeedsUsed();
-    int64_t ticket_end_row = ticket_start_row + items - 1;
-    if (start_row <= ticket_end_row) {
-      offset.order_number = order_number;
-      offset.ticket_start_row = ticket_start_row;
-      offset.rows_into_ticket = start_row - ticket_start_row + 1;
-      offset.prev_order_number = prev_order_number;
-      offset.prev_ticket_start_row = prev_ticket_start_row;
-      return offset;
-    }
-    prev_ticket_start_row = ticket_start_row;
-    prev_order_number = order_number;
-    ticket_start_row = ticket_end_row + 1;
-    ++order_number;
-  }
-}
-
-}  // namespace
-
 WebSalesRowGenerator::WebSalesRowGenerator(double scale)
     : scaling_(scale),
       distribution_store_(),
-      streams_(ColumnIds()) {
+      streams_(ColumnIds()),
+      ticket_cursor_(WS_ORDER_NUMBER, 8, 16) {
   item_count_ = static_cast<int>(scaling_.IdCount(ITEM));
+  item_permutation_ = SharedPermutation(WS_PERMUTATION, item_count_);
   remaining_items_ = 0;
   last_row_in_order_ = true;
 }
@@ -90,24 +48,23 @@ void WebSalesRowGenerator::SkipRows(int64_t start_row) {
   pricing_state_ = PricingState();
   julian_date_ = 0;
   next_date_index_ = 0;
-  if (item_permutation_.empty()) {
-    RandomNumberStream perm_stream(WS_PERMUTATION, SeedsPerRow(WS_PERMUTATION));
-    item_permutation_ = MakePermutation(item_count_, &perm_stream);
-  }
+  next_order_number_ = 1;
   if (start_row <= 0) {
     streams_.SkipRows(0);
     return;
   }
-  TicketOffset offset = FindTicketOffset(start_row, WS_ORDER_NUMBER, 8, 16);
-  streams_.SkipRows(offset.order_number - 1);
-  int64_t order_number = offset.order_number;
-  for (int64_t i = 0; i < offset.rows_into_ticket; ++i) {
+  ticket_cursor_.MoveTo(start_row);
+  streams_.SkipRows(ticket_cursor_.order_number() - 1);
+  int64_t order_number = ticket_cursor_.order_number();
+  int64_t rows_into_ticket = start_row - ticket_cursor_.ticket_start_row() + 1;
+  for (int64_t i = 0; i < rows_into_ticket; ++i) {
     GenerateRow(order_number);
     ConsumeRemainingSeedsForRow();
     if (LastRowInOrder()) {
       ++order_number;
     }
   }
+  next_order_number_ = order_number;
 }
 
 WebSalesRowData WebSalesRowGenerator::GenerateRow(int64_t order_number) {
@@ -117,7 +74,6 @@ WebSalesRowData WebSalesRowGenerator::GenerateRow(int64_t order_number) {
     order_info_ = BuildOrderInfo(order_number);
     remaining_items_ =
         GenerateUniformRandomInt(8, 16, &streams_.Stream(WS_ORDER_NUMBER));
-    EnsurePermutation();
     order_item_base_ =
         GenerateUniformRandomInt(1, item_count_, &streams_.Stream(WS_ITEM_SK));
     last_row_in_order_ = false;
@@ -144,7 +100,7 @@ WebSalesRowData WebSalesRowGenerator::GenerateRow(int64_t order_number) {
   if (order_item_base_ > item_count_) {
     order_item_base_ = 1;
   }
-  int item_key = GetPermutationEntry(item_permutation_, order_item_base_);
+  int item_key = GetPermutationEntry(*item_permutation_, order_item_base_);
   row.item_sk = MatchSCDSK(item_key, row.sold_date_sk, ITEM, scaling_);
 
   row.web_page_sk = MakeJoin(WS_WEB_PAGE_SK, WEB_PAGE, row.sold_date_sk,
@@ -199,13 +155,6 @@ std::vector<int> WebSalesRowGenerator::ColumnIds() {
   return ids;
 }
 
-void WebSalesRowGenerator::EnsurePermutation() {
-  if (item_permutation_.empty()) {
-    item_permutation_ =
-        MakePermutation(item_count_, &streams_.Stream(WS_PERMUTATION));
-  }
-}
-
 void WebSalesRowGenerator::EnsureDateState() {
   if (julian_date_ == 0) {
     const auto& calendar = distribution_store_.Get("calendar");
@@ -15,13 +15,16 @@
 #include "generators/web_site_generator.h"
 
 #include <algorithm>
+#include <exception>
+#include <optional>
 #include <cstdio>
-#include <stdexcept>
 #include <string>
 
 #include "distribution/scaling.h"
 #include "generators/web_site_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
+#include "utils/column_profiler.h"
 #include "utils/columns.h"
 #include "utils/date.h"
 #include "utils/null_utils.h"
@@ -34,16 +37,6 @@ int32_t Date32FromJulian(int32_t julian) {
   return internal::Date::DaysSinceEpoch(internal::Date::FromJulianDays(julian));
 }
 
-std::string FormatStreetName(const internal::Address& address) {
-  return address.street_name1 + " " + address.street_name2;
-}
-
-std::string FormatZip(int zip) {
-  char buffer[6] = {};
-  std::snprintf(buffer, sizeof(buffer), "%05d", zip);
-  return std::string(buffer);
-}
-
 std::shared_ptr<arrow::Schema> BuildWebSiteSchema() {
   return arrow::schema({
       arrow::field("web_site_sk", arrow::int64(), false),
@@ -80,35 +73,50 @@ std::shared_ptr<arrow::Schema> BuildWebSiteSchema() {
 struct WebSiteGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
-        schema_(BuildWebSiteSchema()),
-        row_generator_(options_.scale_factor) {
+        schema_(BuildWebSiteSchema()) {}
+
+  arrow::Status Init() {
     if (options_.chunk_size <= 0) {
-      throw std::invalid_argument("chunk_size must be positive");
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    try {
+      row_generator_.emplace(options_.scale_factor);
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid(e.what());
     }
     auto status = column_selection_.Init(schema_, options_.column_names);
     if (!status.ok()) {
-      throw std::invalid_argument(status.ToString());
+      return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
     total_rows_ =
         internal::Scaling(options_.scale_factor)
             .RowCountByTableNumber(WEB_SITE);
-    if (options_.start_row < 0) {
-      throw std::invalid_argument("start_row must be non-negative");
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
-      return;
+      current_row_ = start_row;
+      return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-    row_generator_.SkipRows(options_.start_row);
+    row_generator_->SkipRows(start_row);
+    return arrow::Status::OK();
   }
 
   GeneratorOptions options_;
@@ -117,7 +125,8 @@ struct WebSiteGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
-  internal::WebSiteRowGenerator row_generator_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  std::optional<internal::WebSiteRowGenerator> row_generator_;
 };
 
 WebSiteGenerator::WebSiteGenerator(GeneratorOptions options)
@@ -125,6 +134,8 @@ WebSiteGenerator::WebSiteGenerator(GeneratorOptions options)
 
 WebSiteGenerator::~WebSiteGenerator() = default;
 
+arrow::Status WebSiteGenerator::Init() { return impl_->Init(); }
+
 std::shared_ptr<arrow::Schema> WebSiteGenerator::schema() const {
   return impl_->schema_;
 }
@@ -135,14 +146,24 @@ std::string_view WebSiteGenerator::name() const {
 
 std::string_view WebSiteGenerator::suite_name() const { return "tpcds"; }
 
+arrow::Status WebSiteGenerator::Seek(int64_t start_row, int64_t row_count) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
+  if (!impl_->row_generator_) {
+    return arrow::Status::Invalid("Init must be called first");
+  }
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   arrow::Int64Builder web_site_sk(pool);
@@ -211,7 +232,8 @@ arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   for (int64_t i = 0; i < batch_rows; ++i) {
     int64_t row_number = impl_->current_row_ + 1;
     internal::WebSiteRowData row =
-        impl_->row_generator_.GenerateRow(row_number);
+        impl_->row_generator_->GenerateRow(row_number);
+    TPCDS_PROFILE_ROW_ASSEMBLY();
 
     auto is_null = [&](int column_id) {
       return internal::IsNull(row.null_bitmap, WEB_SITE, column_id);
@@ -313,14 +335,14 @@ arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
       TPCDS_RETURN_NOT_OK(web_street_number.AppendNull());
     } else {
       TPCDS_RETURN_NOT_OK(
-          web_street_number.Append(std::to_string(row.address.street_num)));
+          internal::AppendStreetNumber(row.address, &web_street_number));
     }
 
     if (is_null(WEB_ADDRESS_STREET_NAME1)) {
       TPCDS_RETURN_NOT_OK(web_street_name.AppendNull());
     } else {
       TPCDS_RETURN_NOT_OK(
-          web_street_name.Append(FormatStreetName(row.address)));
+          internal::AppendStreetName(row.address, &web_street_name));
     }
 
     if (is_null(WEB_ADDRESS_STREET_TYPE)) {
@@ -332,7 +354,7 @@ arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
     if (is_null(WEB_ADDRESS_SUITE_NUM)) {
       TPCDS_RETURN_NOT_OK(web_suite_number.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(web_suite_number.Append(row.address.suite_num));
+      TPCDS_RETURN_NOT_OK(web_suite_number.Append(row.address.suite_num()));
     }
 
     if (is_null(WEB_ADDRESS_CITY)) {
@@ -356,7 +378,7 @@ arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
     if (is_null(WEB_ADDRESS_ZIP)) {
       TPCDS_RETURN_NOT_OK(web_zip.AppendNull());
     } else {
-      TPCDS_RETURN_NOT_OK(web_zip.Append(FormatZip(row.address.zip)));
+      TPCDS_RETURN_NOT_OK(internal::AppendZip(row.address.zip, &web_zip));
     }
 
     if (is_null(WEB_ADDRESS_COUNTRY)) {
@@ -379,7 +401,7 @@ arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
       TPCDS_RETURN_NOT_OK(web_tax_percentage.Append(tax_val));
     }
 
-    impl_->row_generator_.ConsumeRemainingSeedsForRow();
+    impl_->row_generator_->ConsumeRemainingSeedsForRow();
     ++impl_->current_row_;
     --impl_->remaining_rows_;
   }
@@ -441,8 +463,10 @@ arrow::Status WebSiteGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   TPCDS_RETURN_NOT_OK(web_tax_percentage.Finish(&array));
   arrays.push_back(array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows, std::move(arrays),
-                                                  out);
+  TPCDS_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(arrays), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t WebSiteGenerator::total_rows() const { return impl_->total_rows_; }
@@ -23,6 +23,17 @@
 #include "distribution/scaling.h"
 #include "generators/catalog_returns_generator.h"
 #include "generators/catalog_sales_generator.h"
+#include "generators/refresh_delete_generator.h"
+#include "generators/s_catalog_order_generator.h"
+#include "generators/s_catalog_order_lineitem_generator.h"
+#include "generators/s_catalog_returns_generator.h"
+#include "generators/s_inventory_generator.h"
+#include "generators/s_purchase_generator.h"
+#include "generators/s_purchase_lineitem_generator.h"
+#include "generators/s_store_returns_generator.h"
+#include "generators/s_web_order_generator.h"
+#include "generators/s_web_order_lineitem_generator.h"
+#include "generators/s_web_returns_generator.h"
 #include "generators/store_returns_generator.h"
 #include "generators/store_sales_generator.h"
 #include "generators/web_returns_generator.h"
@@ -64,6 +75,13 @@ class TpcdsSuite final : public BenchmarkSuite {
     }
     *is_known = false;
 
+    tpcds::RefreshTableId refresh_table;
+    if (options.refresh_stream > 0 &&
+        tpcds::RefreshTableIdFromString(table_name, &refresh_table)) {
+      return ResolveRefreshTableRowCount(refresh_table, options, out,
+                                         is_known);
+    }
+
     tpcds::TableId table_id;
     if (!tpcds::TableIdFromString(table_name, &table_id)) {
       return arrow::Status::Invalid("Unknown TPC-DS table: ",
@@ -73,8 +91,7 @@ class TpcdsSuite final : public BenchmarkSuite {
     try {
       switch (table_id) {
         case tpcds::TableId::kCatalogSales:
-          *out =
-              tpcds::CatalogSalesGenerator::TotalRows(options.scale_factor);
+          *out = tpcds::CatalogSalesGenerator::TotalRows(options);
           *is_known = true;
           return arrow::Status::OK();
         case tpcds::TableId::kCatalogReturns:
@@ -128,6 +145,59 @@ class TpcdsSuite final : public BenchmarkSuite {
                                     e.what());
     }
   }
+
+ private:
+  // Every refresh run has the same row counts.
+  static arrow::Status ResolveRefreshTableRowCount(
+      tpcds::RefreshTableId table, const GeneratorOptions& options,
+      int64_t* out, bool* is_known) {
+    try {
+      const double scale = options.scale_factor;
+      switch (table) {
+        case tpcds::RefreshTableId::kSPurchase:
+          *out = tpcds::SPurchaseGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSPurchaseLineitem:
+          *out = tpcds::SPurchaseLineitemGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSCatalogOrder:
+          *out = tpcds::SCatalogOrderGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSCatalogOrderLineitem:
+          *out = tpcds::SCatalogOrderLineitemGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSWebOrder:
+          *out = tpcds::SWebOrderGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSWebOrderLineitem:
+          *out = tpcds::SWebOrderLineitemGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSStoreReturns:
+          *out = tpcds::SStoreReturnsGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSCatalogReturns:
+          *out = tpcds::SCatalogReturnsGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSWebReturns:
+          *out = tpcds::SWebReturnsGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kSInventory:
+          *out = tpcds::SInventoryGenerator::TotalRows(scale);
+          break;
+        case tpcds::RefreshTableId::kDelete:
+        case tpcds::RefreshTableId::kInventoryDelete:
+          *out = tpcds::RefreshDeleteGenerator::TotalRows();
+          break;
+        case tpcds::RefreshTableId::kTableCount:
+          return arrow::Status::Invalid("unknown refresh table id");
+      }
+      *is_known = true;
+      return arrow::Status::OK();
+    } catch (const std::exception& e) {
+      return arrow::Status::Invalid("Failed to resolve TPC-DS row counts: ",
+                                    e.what());
+    }
+  }
 };
 
 }  // namespace
@@ -15,6 +15,8 @@
 #include "utils/address.h"
 
 #include <algorithm>
+#include <charconv>
+#include <cstdio>
 
 #include "utils/random_utils.h"
 #include "utils/table_metadata.h"
@@ -22,8 +24,8 @@
 namespace benchgen::tpcds::internal {
 namespace {
 
-std::string PickString(const DstDistribution& dist, int value_set,
-                       int weight_set, RandomNumberStream* stream) {
+std::string_view PickString(const DstDistribution& dist, int value_set,
+                            int weight_set, RandomNumberStream* stream) {
   int index = dist.PickIndex(weight_set, stream);
   return dist.GetString(index, value_set);
 }
@@ -32,14 +34,51 @@ int PickIndexUniform(int max_value, RandomNumberStream* stream) {
   return GenerateUniformRandomInt(1, max_value, stream);
 }
 
-std::string FormatSuiteNumber(int seed) {
+void FormatSuiteNumber(int seed, Address* address) {
+  int length = 0;
   if (seed & 0x01) {
-    return "Suite " + std::to_string((seed >> 1) * 10);
+    length = std::snprintf(address->suite_num_buffer.data(),
+                           address->suite_num_buffer.size(), "Suite %d",
+                           (seed >> 1) * 10);
+  } else {
+    char letter = static_cast<char>('A' + ((seed >> 1) % 25));
+    length = std::snprintf(address->suite_num_buffer.data(),
+                           address->suite_num_buffer.size(), "Suite %c",
+                           letter);
+  }
+  address->suite_num_length = static_cast<uint8_t>(length);
+}
+
+// CityHash over a value fed in pieces, so callers can hash a formatted
+// address line without concatenating it first.
+class CityHasher {
+ public:
+  void Update(std::string_view text) {
+    for (char c : text) {
+      hash_value_ *= 26;
+      hash_value_ -= 'A';
+      hash_value_ += static_cast<unsigned char>(c);
+      if (hash_value_ > 1000000) {
+        hash_value_ %= 10000;
+        result_ += hash_value_;
+        hash_value_ = 0;
+      }
+    }
   }
-  char letter = static_cast<char>('A' + ((seed >> 1) % 25));
-  std::string out = "Suite ";
-  out.push_back(letter);
-  return out;
+
+  int Finish() const {
+    int result = result_ + hash_value_ % 1000;
+    return result % 10000;
+  }
+
+ private:
+  int hash_value_ = 0;
+  int result_ = 0;
+};
+
+std::string_view FormatInt(int value, char* buffer, size_t size) {
+  auto result = std::to_chars(buffer, buffer + size, value);
+  return std::string_view(buffer, static_cast<size_t>(result.ptr - buffer));
 }
 
 }  // namespace
@@ -57,7 +96,7 @@ Address GenerateAddress(int table_number, DstDistributionStore* store,
   address.street_type = PickString(street_type, 1, 1, stream);
 
   int suite_seed = GenerateUniformRandomInt(1, 100, stream);
-  address.suite_num = FormatSuiteNumber(suite_seed);
+  FormatSuiteNumber(suite_seed, &address);
 
   const auto& cities = store->Get("cities");
   if (IsSmallTable(table_number)) {
@@ -89,7 +128,7 @@ Address GenerateAddress(int table_number, DstDistributionStore* store,
 
   address.state = fips.GetString(region_index, 3);
 
-  std::string zip_prefix = fips.GetString(region_index, 5);
+  std::string_view zip_prefix = fips.GetString(region_index, 5);
   int zip = CityHash(address.city);
   if (!zip_prefix.empty() && zip_prefix.front() == '0' && zip < 9400) {
     zip += 600;
@@ -99,10 +138,16 @@ Address GenerateAddress(int table_number, DstDistributionStore* store,
   }
   address.zip = zip;
 
-  std::string address_line = std::to_string(address.street_num) + " " +
-                             address.street_name1 + " " + address.street_name2 +
-                             " " + address.street_type;
-  address.plus4 = CityHash(address_line);
+  char number[16];
+  CityHasher line_hash;
+  line_hash.Update(FormatInt(address.street_num, number, sizeof(number)));
+  line_hash.Update(" ");
+  line_hash.Update(address.street_name1);
+  line_hash.Update(" ");
+  line_hash.Update(address.street_name2);
+  line_hash.Update(" ");
+  line_hash.Update(address.street_type);
+  address.plus4 = line_hash.Finish();
 
   address.gmt_offset = fips.GetInt(region_index, 6);
   address.country = "United States";
@@ -110,23 +155,29 @@ Address GenerateAddress(int table_number, DstDistributionStore* store,
   return address;
 }
 
-int CityHash(const std::string& name) {
-  int hash_value = 0;
-  int result = 0;
-  for (char c : name) {
-    hash_value *= 26;
-    hash_value -= 'A';
-    hash_value += static_cast<unsigned char>(c);
-    if (hash_value > 1000000) {
-      hash_value %= 10000;
-      result += hash_value;
-      hash_value = 0;
-    }
-  }
-  hash_value %= 1000;
-  result += hash_value;
-  result %= 10000;
-  return result;
+int CityHash(std::string_view name) {
+  CityHasher hasher;
+  hasher.Update(name);
+  return hasher.Finish();
+}
+
+arrow::Status AppendStreetNumber(const Address& address,
+                                 arrow::StringBuilder* builder) {
+  char number[16];
+  return builder->Append(FormatInt(address.street_num, number, sizeof(number)));
+}
+
+arrow::Status AppendStreetName(const Address& address,
+                               arrow::StringBuilder* builder) {
+  ARROW_RETURN_NOT_OK(builder->Append(address.street_name1));
+  ARROW_RETURN_NOT_OK(builder->ExtendCurrent(" "));
+  return builder->ExtendCurrent(address.street_name2);
+}
+
+arrow::Status AppendZip(int zip, arrow::StringBuilder* builder) {
+  char buffer[6] = {};
+  int length = std::snprintf(buffer, sizeof(buffer), "%05d", zip);
+  return builder->Append(buffer, std::min(length, 5));
 }
 
 }  // namespace benchgen::tpcds::internal
@@ -14,31 +14,54 @@
 
 #pragma once
 
-#include <string>
+#include <array>
+#include <cstdint>
+#include <string_view>
 
+#include "benchgen/arrow_compat.h"
 #include "distribution/dst_distribution_store.h"
 #include "distribution/scaling.h"
 #include "utils/random_number_stream.h"
 
 namespace benchgen::tpcds::internal {
 
+// The text fields view strings owned by the distribution store passed to
+// GenerateAddress and stay valid for as long as that store does. The suite
+// number is formatted into an inline buffer, so an Address never allocates
+// and is cheap to copy.
 struct Address {
   int street_num = 0;
-  std::string street_name1;
-  std::string street_name2;
-  std::string street_type;
-  std::string suite_num;
-  std::string city;
-  std::string county;
-  std::string state;
-  std::string country;
+  std::string_view street_name1;
+  std::string_view street_name2;
+  std::string_view street_type;
+  std::string_view city;
+  std::string_view county;
+  std::string_view state;
+  std::string_view country;
   int zip = 0;
   int plus4 = 0;
   int gmt_offset = 0;
+
+  std::string_view suite_num() const {
+    return std::string_view(suite_num_buffer.data(), suite_num_length);
+  }
+
+  std::array<char, 12> suite_num_buffer = {};
+  uint8_t suite_num_length = 0;
 };
 
 Address GenerateAddress(int table_number, DstDistributionStore* store,
                         RandomNumberStream* stream, const Scaling& scaling);
-int CityHash(const std::string& name);
+int CityHash(std::string_view name);
+
+// Column writers for the derived address columns. They append straight into
+// the builder without building an intermediate std::string.
+arrow::Status AppendStreetNumber(const Address& address,
+                                 arrow::StringBuilder* builder);
+// "<street_name1> <street_name2>"
+arrow::Status AppendStreetName(const Address& address,
+                               arrow::StringBuilder* builder);
+// Zero-padded to five digits.
+arrow::Status AppendZip(int zip, arrow::StringBuilder* builder);
 
 }  // namespace benchgen::tpcds::internal
@@ -0,0 +1,173 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "utils/column_profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include "utils/columns.h"
+
+namespace benchgen::tpcds::internal {
+
+thread_local ColumnProfiler* ColumnProfiler::active_ = nullptr;
+
+ColumnProfiler::ColumnProfiler()
+    : costs_(static_cast<size_t>(MAX_COLUMN) + 2) {
+  for (size_t i = 0; i < costs_.size(); ++i) {
+    costs_[i].column_id = static_cast<int>(i);
+  }
+  costs_.back().column_id = kSetup;
+}
+
+ColumnProfiler::Scope::Scope(ColumnProfiler* profiler, int start_column)
+    : previous_(active_) {
+  if (previous_ != nullptr) {
+    previous_->Charge(Clock::now());
+  }
+  profiler->current_ = start_column;
+  profiler->last_ = Clock::now();
+  active_ = profiler;
+}
+
+ColumnProfiler::Scope::~Scope() {
+  const auto now = Clock::now();
+  active_->Charge(now);
+  active_ = previous_;
+  if (previous_ != nullptr) {
+    previous_->last_ = now;
+  }
+}
+
+void ColumnProfiler::Charge(Clock::time_point now) {
+  costs_[Slot(current_)].nanos +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_)
+          .count();
+  last_ = now;
+}
+
+void ColumnProfiler::Enter(int column_id) {
+  Charge(Clock::now());
+  current_ = column_id;
+}
+
+std::vector<ColumnCost> ColumnProfiler::Costs() const {
+  std::vector<ColumnCost> costs;
+  for (const ColumnCost& cost : costs_) {
+    if (cost.nanos > 0 || cost.draws > 0) {
+      costs.push_back(cost);
+    }
+  }
+  std::stable_sort(costs.begin(), costs.end(),
+                   [](const ColumnCost& a, const ColumnCost& b) {
+                     if (a.nanos != b.nanos) {
+                       return a.nanos > b.nanos;
+                     }
+                     return a.draws > b.draws;
+                   });
+  return costs;
+}
+
+std::string ColumnProfiler::FormatReport(std::string_view table,
+                                         int64_t rows) const {
+  const std::vector<ColumnCost> costs = Costs();
+  int64_t total_nanos = 0;
+  int64_t total_draws = 0;
+  for (const ColumnCost& cost : costs) {
+    total_nanos += cost.nanos;
+    total_draws += cost.draws;
+  }
+  char line[160];
+  std::snprintf(line, sizeof(line),
+                "column profile for %.*s: %lld rows, %.3f ms, %lld draws\n",
+                static_cast<int>(table.size()), table.data(),
+                static_cast<long long>(rows), total_nanos / 1e6,
+                static_cast<long long>(total_draws));
+  std::string report = line;
+  std::snprintf(line, sizeof(line), "  %-28s %4s %12s %7s %12s %10s\n",
+                "column", "id", "time_ms", "time%", "draws", "draws/row");
+  report += line;
+  for (const ColumnCost& cost : costs) {
+    const char* name = cost.column_id == kRowAssembly ? "<row assembly>"
+                       : cost.column_id == kSetup ? "<setup>"
+                                                  : ColumnName(cost.column_id);
+    std::snprintf(
+        line, sizeof(line), "  %-28s %4d %12.3f %6.1f%% %12lld %10.2f\n",
+        name, cost.column_id, cost.nanos / 1e6,
+        total_nanos > 0 ? 100.0 * cost.nanos / total_nanos : 0.0,
+        static_cast<long long>(cost.draws),
+        rows > 0 ? static_cast<double>(cost.draws) / rows : 0.0);
+    report += line;
+  }
+  return report;
+}
+
+ColumnProfilingIterator::ColumnProfilingIterator(
+    std::unique_ptr<ColumnProfiler> profiler,
+    std::unique_ptr<RecordBatchIterator> inner)
+    : profiler_(std::move(profiler)), inner_(std::move(inner)) {}
+
+ColumnProfilingIterator::~ColumnProfilingIterator() { Report(); }
+
+arrow::Status ColumnProfilingIterator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  arrow::Status status;
+  {
+    ColumnProfiler::Scope scope(profiler_.get());
+    status = inner_->Next(out);
+  }
+  if (status.ok() && out != nullptr) {
+    if (*out) {
+      rows_ += (*out)->num_rows();
+    } else {
+      Report();
+    }
+  }
+  return status;
+}
+
+arrow::Status ColumnProfilingIterator::Seek(int64_t start_row,
+                                            int64_t row_count) {
+  ColumnProfiler::Scope scope(profiler_.get());
+  reported_ = false;
+  return inner_->Seek(start_row, row_count);
+}
+
+void ColumnProfilingIterator::Report() {
+  if (reported_) {
+    return;
+  }
+  reported_ = true;
+  const std::string report = profiler_->FormatReport(inner_->name(), rows_);
+  std::fprintf(stderr, "%s", report.c_str());
+}
+
+arrow::Status MakeColumnProfilingIterator(
+    const std::function<arrow::Status(std::unique_ptr<RecordBatchIterator>*)>&
+        make,
+    std::unique_ptr<RecordBatchIterator>* out) {
+  auto profiler = std::make_unique<ColumnProfiler>();
+  std::unique_ptr<RecordBatchIterator> inner;
+  {
+    ColumnProfiler::Scope scope(profiler.get(), ColumnProfiler::kSetup);
+    ARROW_RETURN_NOT_OK(make(&inner));
+  }
+  *out = std::make_unique<ColumnProfilingIterator>(std::move(profiler),
+                                                   std::move(inner));
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,173 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator.h"
+
+namespace benchgen::tpcds::internal {
+
+// Name of a global column id from columns.h ("" if unknown). Generated at
+// build time from columns.h.
+const char* ColumnName(int column_id);
+
+struct ColumnCost {
+  int column_id = 0;
+  int64_t nanos = 0;
+  int64_t draws = 0;
+};
+
+// Attributes generator CPU time and RNG draws to TPC-DS global column ids.
+//
+// Draws are counted exactly. Time is attributed by transitions: whenever
+// a stream of a different column draws, the time since the previous
+// transition is charged to the previous column. Work done between a
+// column's draws and the next column's first draw (e.g. an SCD lookup
+// after a join) is therefore charged to the former. Generators mark the
+// end of a row's column work with TPCDS_PROFILE_ROW_ASSEMBLY(), so the
+// Arrow appends that follow go to kRowAssembly instead.
+//
+// Only active in builds with BENCHGEN_TPCDS_COLUMN_PROFILE; the hooks
+// compile to nothing otherwise.
+class ColumnProfiler {
+ public:
+  // Pseudo column for batch assembly and anything else outside column
+  // generation; global column ids start at 1.
+  static constexpr int kRowAssembly = 0;
+  // Pseudo column for iterator construction (distribution loading,
+  // permutations, the initial skip) outside any column's draws.
+  static constexpr int kSetup = -1;
+
+  ColumnProfiler();
+
+  // Makes a profiler the calling thread's active one and starts its clock
+  // at start_column; the destructor charges the open interval and restores
+  // the previous profiler.
+  class Scope {
+   public:
+    explicit Scope(ColumnProfiler* profiler, int start_column = kRowAssembly);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    ColumnProfiler* previous_;
+  };
+
+  static ColumnProfiler* Active() { return active_; }
+
+  static void OnDraw(int column_id) {
+    if (active_ != nullptr) {
+      active_->Draw(column_id);
+    }
+  }
+  static void OnEnter(int column_id) {
+    if (active_ != nullptr) {
+      active_->Enter(column_id);
+    }
+  }
+
+  void Draw(int column_id) {
+    ++costs_[Slot(column_id)].draws;
+    if (column_id != current_) {
+      Enter(column_id);
+    }
+  }
+  void Enter(int column_id);
+
+  // Columns with any time or draws, most expensive first.
+  std::vector<ColumnCost> Costs() const;
+
+  // Table of Costs() with shares of the total time and draws per row.
+  std::string FormatReport(std::string_view table, int64_t rows) const;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // Slots 0..MAX_COLUMN are column ids; the last one is kSetup.
+  size_t Slot(int column_id) const {
+    const auto slot = static_cast<size_t>(column_id);
+    if (slot < costs_.size() - 1) {
+      return slot;
+    }
+    return column_id == kSetup ? costs_.size() - 1 : kRowAssembly;
+  }
+  void Charge(Clock::time_point now);
+
+  static thread_local ColumnProfiler* active_;
+
+  std::vector<ColumnCost> costs_;
+  int current_ = kRowAssembly;
+  Clock::time_point last_;
+};
+
+// Wraps a TPC-DS iterator so that its Next() and Seek() run under a
+// ColumnProfiler, and prints the per-column report to stderr when the
+// iterator is exhausted or destroyed.
+class ColumnProfilingIterator final : public RecordBatchIterator {
+ public:
+  ColumnProfilingIterator(std::unique_ptr<ColumnProfiler> profiler,
+                          std::unique_ptr<RecordBatchIterator> inner);
+  ~ColumnProfilingIterator() override;
+
+  std::string_view name() const override { return inner_->name(); }
+  std::string_view suite_name() const override {
+    return inner_->suite_name();
+  }
+  std::shared_ptr<arrow::Schema> schema() const override {
+    return inner_->schema();
+  }
+  arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
+
+ private:
+  void Report();
+
+  std::unique_ptr<ColumnProfiler> profiler_;
+  std::unique_ptr<RecordBatchIterator> inner_;
+  int64_t rows_ = 0;
+  bool reported_ = false;
+};
+
+// Calls make with a new profiler active, so generator construction
+// (distribution loading, permutations, the initial skip) is profiled too,
+// and wraps the iterator it produces.
+arrow::Status MakeColumnProfilingIterator(
+    const std::function<arrow::Status(std::unique_ptr<RecordBatchIterator>*)>&
+        make,
+    std::unique_ptr<RecordBatchIterator>* out);
+
+}  // namespace benchgen::tpcds::internal
+
+#ifdef BENCHGEN_TPCDS_COLUMN_PROFILE
+#define TPCDS_PROFILE_DRAW(column_id) \
+  ::benchgen::tpcds::internal::ColumnProfiler::OnDraw(column_id)
+#define TPCDS_PROFILE_ROW_ASSEMBLY()                       \
+  ::benchgen::tpcds::internal::ColumnProfiler::OnEnter( \
+      ::benchgen::tpcds::internal::ColumnProfiler::kRowAssembly)
+#else
+#define TPCDS_PROFILE_DRAW(column_id) ((void)0)
+#define TPCDS_PROFILE_ROW_ASSEMBLY() ((void)0)
+#endif
@@ -14,8 +14,13 @@
 
 #include "utils/permute.h"
 
+#include <map>
+#include <mutex>
 #include <stdexcept>
+#include <utility>
 
+#include "util/trace.h"
+#include "utils/column_streams.h"
 #include "utils/random_utils.h"
 
 namespace benchgen::tpcds::internal {
@@ -43,6 +48,26 @@ std::vector<int> MakePermutation(int size, RandomNumberStream* stream) {
   return values;
 }
 
+std::shared_ptr<const std::vector<int>> SharedPermutation(int column_id,
+                                                          int size) {
+  using Key = std::pair<int, int>;
+  static std::mutex mutex;
+  static std::map<Key, std::shared_ptr<const std::vector<int>>> cache;
+  Key key(column_id, size);
+
+  auto lock = benchgen::internal::TracedLock(mutex, "wait tpcds permutation");
+  auto it = cache.find(key);
+  if (it != cache.end()) {
+    return it->second;
+  }
+  benchgen::internal::TraceSpan span("build tpcds permutation", "init");
+  RandomNumberStream stream(column_id, SeedsPerRow(column_id));
+  auto permutation =
+      std::make_shared<const std::vector<int>>(MakePermutation(size, &stream));
+  cache.emplace(key, permutation);
+  return permutation;
+}
+
 int GetPermutationEntry(const std::vector<int>& permutation, int index) {
   if (index <= 0 || static_cast<size_t>(index) > permutation.size()) {
     throw std::out_of_range("permutation index out of range");
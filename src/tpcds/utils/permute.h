@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "utils/random_number_stream.h"
@@ -21,6 +22,12 @@
 namespace benchgen::tpcds::internal {
 
 std::vector<int> MakePermutation(int size, RandomNumberStream* stream);
+
+// Returns the permutation MakePermutation draws from a fresh stream for
+// column_id. Permutations are built once per (column_id, size) and shared
+// read-only by every generator in the process.
+std::shared_ptr<const std::vector<int>> SharedPermutation(int column_id,
+                                                          int size);
 int GetPermutationEntry(const std::vector<int>& permutation, int index);
 
 }  // namespace benchgen::tpcds::internal
@@ -46,6 +46,18 @@ constexpr PricingLimitSpec kPricingLimits[] = {
      SS_WHOLESALE_MAX, SS_COUPON_MAX},
     {WR_PRICING, WS_QUANTITY_MAX, WS_MARKUP_MAX, WS_DISCOUNT_MAX,
      WS_WHOLESALE_MAX, WS_COUPON_MAX},
+    {S_PLINE_PRICING, SS_QUANTITY_MAX, SS_MARKUP_MAX, SS_DISCOUNT_MAX,
+     SS_WHOLESALE_MAX, SS_COUPON_MAX},
+    {S_CLIN_PRICING, CS_QUANTITY_MAX, CS_MARKUP_MAX, CS_DISCOUNT_MAX,
+     CS_WHOLESALE_MAX, CS_COUPON_MAX},
+    {S_WLIN_PRICING, WS_QUANTITY_MAX, WS_MARKUP_MAX, WS_DISCOUNT_MAX,
+     WS_WHOLESALE_MAX, WS_COUPON_MAX},
+    {S_SRET_PRICING, SS_QUANTITY_MAX, SS_MARKUP_MAX, SS_DISCOUNT_MAX,
+     SS_WHOLESALE_MAX, SS_COUPON_MAX},
+    {S_CRET_PRICING, CS_QUANTITY_MAX, CS_MARKUP_MAX, CS_DISCOUNT_MAX,
+     CS_WHOLESALE_MAX, CS_COUPON_MAX},
+    {S_WRET_PRICING, WS_QUANTITY_MAX, WS_MARKUP_MAX, WS_DISCOUNT_MAX,
+     WS_WHOLESALE_MAX, WS_COUPON_MAX},
 };
 
 PricingLimits ResolveLimits(int pricing_id, PricingState* state) {
@@ -113,7 +125,10 @@ void SetPricing(int pricing_id, Pricing* pricing, RandomNumberStream* stream,
   switch (pricing_id) {
     case SS_PRICING:
     case CS_PRICING:
-    case WS_PRICING: {
+    case WS_PRICING:
+    case S_PLINE_PRICING:
+    case S_CLIN_PRICING:
+    case S_WLIN_PRICING: {
       pricing->quantity = GenerateRandomInt(RandomDistribution::kUniform, 1,
                                             limits.quantity_max, 0, stream);
       Decimal d_quantity;
@@ -191,7 +206,10 @@ void SetPricing(int pricing_id, Pricing* pricing, RandomNumberStream* stream,
     }
     case CR_PRICING:
     case SR_PRICING:
-    case WR_PRICING: {
+    case WR_PRICING:
+    case S_SRET_PRICING:
+    case S_CRET_PRICING:
+    case S_WRET_PRICING: {
       Decimal d_quantity;
       IntToDecimal(&d_quantity, pricing->quantity);
       ApplyDecimalOp(&pricing->ext_wholesale_cost, DecimalOp::kMultiply,
@@ -14,6 +14,8 @@
 
 #include "utils/random_number_stream.h"
 
+#include "utils/column_profiler.h"
+
 namespace benchgen::tpcds::internal {
 namespace {
 
@@ -25,13 +27,14 @@ constexpr int64_t kRemainder = 2836;
 
 RandomNumberStream::RandomNumberStream(int global_column_number,
                                        int seeds_per_row)
-    : seeds_per_row_(seeds_per_row) {
+    : seeds_per_row_(seeds_per_row), column_id_(global_column_number) {
   const int64_t skip = kMaxInt / kMaxColumn;
   initial_seed_ = static_cast<int64_t>(kSeedBase) + skip * global_column_number;
   seed_ = initial_seed_;
 }
 
 int64_t RandomNumberStream::NextRandom() {
+  TPCDS_PROFILE_DRAW(column_id_);
   int64_t div_res = seed_ / kQuotient;
   int64_t mod_res = seed_ - kQuotient * div_res;
   int64_t next = kMultiplier * mod_res - div_res * kRemainder;
@@ -35,12 +35,14 @@ class RandomNumberStream {
   int seeds_used() const { return seeds_used_; }
   void ResetSeedsUsed() { seeds_used_ = 0; }
   int seeds_per_row() const { return seeds_per_row_; }
+  int column_id() const { return column_id_; }
 
  private:
   int64_t seed_ = 3;
   int64_t initial_seed_ = 3;
   int seeds_used_ = 0;
   int seeds_per_row_ = 0;
+  int column_id_ = 0;
 };
 
 }  // namespace benchgen::tpcds::internal
@@ -0,0 +1,133 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/refresh.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "utils/constants.h"
+#include "utils/date.h"
+#include "utils/random_utils.h"
+#include "utils/tables.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+static_assert(SR_RETURN_PCT * kRefreshReturnInterval == 100 &&
+                  CR_RETURN_PCT * kRefreshReturnInterval == 100 &&
+                  WR_RETURN_PCT * kRefreshReturnInterval == 100,
+              "kRefreshReturnInterval must match the return percentages");
+
+int32_t DataStartJulian() {
+  static const int32_t kJulian =
+      Date::ToJulianDays(Date::FromString(DATE_MINIMUM));
+  return kJulian;
+}
+
+int32_t DataDays() {
+  static const int32_t kDays =
+      Date::ToJulianDays(Date::FromString(DATE_MAXIMUM)) - DataStartJulian() +
+      1;
+  return kDays;
+}
+
+int SalesTable(int table_number) {
+  switch (table_number) {
+    case S_PURCHASE:
+      return STORE_SALES;
+    case S_CATALOG_ORDER:
+      return CATALOG_SALES;
+    case S_WEB_ORDER:
+      return WEB_SALES;
+    default:
+      throw std::invalid_argument("not a maintenance order table");
+  }
+}
+
+}  // namespace
+
+RefreshWindow SalesRefreshWindow(int32_t refresh_run, int window) {
+  // Successive windows step UPDATE_INTERVAL days through the data range and
+  // wrap around once the runs outnumber it.
+  int64_t slot = static_cast<int64_t>(refresh_run - 1) * kRefreshWindowCount +
+                 window;
+  int64_t span = DataDays() - DAYS_PER_UPDATE + 1;
+  RefreshWindow result;
+  result.first_julian = DataStartJulian() +
+                        static_cast<int32_t>((slot * UPDATE_INTERVAL) % span);
+  result.last_julian = result.first_julian + DAYS_PER_UPDATE - 1;
+  return result;
+}
+
+RefreshWindow InventoryRefreshWindow(int32_t refresh_run, int window) {
+  // Inventory is taken weekly from DATE_MINIMUM on (see
+  // InventoryRowGenerator), so the window is the whole week.
+  RefreshWindow sales = SalesRefreshWindow(refresh_run, window);
+  int32_t week = (sales.first_julian - DataStartJulian()) / 7;
+  RefreshWindow result;
+  result.first_julian = DataStartJulian() + week * 7;
+  result.last_julian = result.first_julian + 6;
+  return result;
+}
+
+int32_t RefreshSalesDate(int32_t refresh_run, RandomNumberStream* stream) {
+  int day = GenerateUniformRandomInt(
+      0, kRefreshWindowCount * DAYS_PER_UPDATE - 1, stream);
+  RefreshWindow window =
+      SalesRefreshWindow(refresh_run, day / DAYS_PER_UPDATE);
+  return window.first_julian + day % DAYS_PER_UPDATE;
+}
+
+int64_t RefreshOrderCount(int table_number, const Scaling& scaling) {
+  if (table_number == S_CATALOG_ORDER) {
+    // scaling.dst leaves s_catalog_order unscaled; catalog orders get the
+    // share of their base table that purchases get of store_sales.
+    int64_t orders = scaling.RowCountByTableNumber(CATALOG_SALES) *
+                     scaling.RowCountByTableNumber(S_PURCHASE) /
+                     std::max<int64_t>(
+                         1, scaling.RowCountByTableNumber(STORE_SALES));
+    return std::max<int64_t>(1, orders);
+  }
+  SalesTable(table_number);
+  return scaling.RowCountByTableNumber(table_number);
+}
+
+int64_t RefreshReturnCount(int64_t line_count) {
+  return line_count / kRefreshReturnInterval;
+}
+
+int64_t RefreshReturnedLine(int64_t return_row, RandomNumberStream* stream) {
+  return (return_row - 1) * kRefreshReturnInterval +
+         GenerateUniformRandomInt(1, kRefreshReturnInterval, stream);
+}
+
+int64_t RefreshOrderIdBase(int table_number, int32_t refresh_run,
+                           const Scaling& scaling) {
+  return scaling.RowCountByTableNumber(SalesTable(table_number)) +
+         static_cast<int64_t>(refresh_run - 1) *
+             RefreshOrderCount(table_number, scaling);
+}
+
+std::string RefreshBusinessKey(int to_table, RandomNumberStream* stream,
+                               const Scaling& scaling) {
+  int64_t id = GenerateUniformRandomKey(1, scaling.IdCount(to_table), stream);
+  return MakeBusinessKey(static_cast<uint64_t>(id));
+}
+
+int32_t RefreshDate32(int32_t julian) {
+  return Date::DaysSinceEpoch(Date::FromJulianDays(julian));
+}
+
+}  // namespace benchgen::tpcds::internal
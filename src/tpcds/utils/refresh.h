@@ -0,0 +1,79 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "distribution/scaling.h"
+#include "utils/random_number_stream.h"
+
+namespace benchgen::tpcds::internal {
+
+// Layout shared by the approximate fact table source generators; it is
+// this tree's own, not the one `dsdgen -update` uses. Run n replaces
+// kRefreshWindowCount windows of DAYS_PER_UPDATE days of sales,
+// UPDATE_INTERVAL days apart, and the inventory weeks those windows start
+// in; its purchases and orders are dated inside the sales windows. The
+// column streams of run n continue where run n - 1 stopped, so runs draw
+// different rows.
+constexpr int kRefreshWindowCount = 3;
+
+// Every order has this many lines, as the per-order seed budgets of the
+// S_PLINE_* and S_WLIN_* columns assume.
+constexpr int kRefreshLinesPerOrder = 12;
+
+// One line in every kRefreshReturnInterval lines of a run's lineitem table
+// is returned, a fixed stand-in for the *_RETURN_PCT constants. Return row
+// r takes its line from lines (r - 1) * kRefreshReturnInterval + 1 ..
+// r * kRefreshReturnInterval, so return row ranges seek in O(1) like the
+// lineitems do.
+constexpr int kRefreshReturnInterval = 10;
+
+struct RefreshWindow {
+  int32_t first_julian = 0;
+  int32_t last_julian = 0;
+};
+
+RefreshWindow SalesRefreshWindow(int32_t refresh_run, int window);
+RefreshWindow InventoryRefreshWindow(int32_t refresh_run, int window);
+
+// A day drawn uniformly from the sales windows of refresh_run.
+int32_t RefreshSalesDate(int32_t refresh_run, RandomNumberStream* stream);
+
+// Orders per run of S_PURCHASE, S_CATALOG_ORDER or S_WEB_ORDER.
+int64_t RefreshOrderCount(int table_number, const Scaling& scaling);
+
+// Returns per run of a lineitem table with line_count lines.
+int64_t RefreshReturnCount(int64_t line_count);
+
+// The lineitem row (1-based) that return row return_row returns.
+int64_t RefreshReturnedLine(int64_t return_row, RandomNumberStream* stream);
+
+// The ids of run n continue after the tickets/orders of the base sales
+// table and those of runs 1..n-1; this returns the id before the first.
+int64_t RefreshOrderIdBase(int table_number, int32_t refresh_run,
+                           const Scaling& scaling);
+
+// The business key of a uniformly chosen id of to_table. Source rows
+// reference dimensions by id rather than surrogate key, so type 2 tables
+// draw over their unique ids.
+std::string RefreshBusinessKey(int to_table, RandomNumberStream* stream,
+                               const Scaling& scaling);
+
+// Days since the Unix epoch, for date32 columns.
+int32_t RefreshDate32(int32_t julian);
+
+}  // namespace benchgen::tpcds::internal
@@ -58,6 +58,52 @@ static const TableMetadata kTableMetadata[] = {
     {WEB_SITE, WEB_SITE_START, WEB_SITE_END, kFlagType2 | kFlagSmall, 100, 0x0B,
      -1},
     {DBGEN_VERSION, DBGEN_VERSION_START, DBGEN_VERSION_END, 0, 0, 0, -1},
+    // Source schema tables; only the data maintenance generators use them.
+    {S_BRAND, S_BRAND_START, S_BRAND_END, 0, 0, 0, -1},
+    {S_CUSTOMER_ADDRESS, S_CUSTOMER_ADDRESS_START,
+     S_CUSTOMER_ADDRESS_END, 0, 0, 0, -1},
+    {S_CALL_CENTER, S_CALL_CENTER_START, S_CALL_CENTER_END, 0, 0, 0, -1},
+    {S_CATALOG, S_CATALOG_START, S_CATALOG_END, 0, 0, 0, -1},
+    {S_CATALOG_ORDER, S_CATALOG_ORDER_START, S_CATALOG_ORDER_END, 0, 0, 0, -1},
+    {S_CATALOG_ORDER_LINEITEM, S_CATALOG_ORDER_LINEITEM_START,
+     S_CATALOG_ORDER_LINEITEM_END, 0, 0, 0, -1},
+    {S_CATALOG_PAGE, S_CATALOG_PAGE_START, S_CATALOG_PAGE_END, 0, 0, 0, -1},
+    {S_CATALOG_PROMOTIONAL_ITEM, S_CATALOG_PROMOTIONAL_ITEM_START,
+     S_CATALOG_PROMOTIONAL_ITEM_END, 0, 0, 0, -1},
+    {S_CATALOG_RETURNS, S_CATALOG_RETURNS_START,
+     S_CATALOG_RETURNS_END, 0, 0, 0, -1},
+    {S_CATEGORY, S_CATEGORY_START, S_CATEGORY_END, 0, 0, 0, -1},
+    {S_CLASS, S_CLASS_START, S_CLASS_END, 0, 0, 0, -1},
+    {S_COMPANY, S_COMPANY_START, S_COMPANY_END, 0, 0, 0, -1},
+    {S_CUSTOMER, S_CUSTOMER_START, S_CUSTOMER_END, 0, 0, 0, -1},
+    {S_DIVISION, S_DIVISION_START, S_DIVISION_END, 0, 0, 0, -1},
+    {S_INVENTORY, S_INVENTORY_START, S_INVENTORY_END, 0, 0, 0, -1},
+    {S_ITEM, S_ITEM_START, S_ITEM_END, 0, 0, 0, -1},
+    {S_MANAGER, S_MANAGER_START, S_MANAGER_END, 0, 0, 0, -1},
+    {S_MANUFACTURER, S_MANUFACTURER_START, S_MANUFACTURER_END, 0, 0, 0, -1},
+    {S_MARKET, S_MARKET_START, S_MARKET_END, 0, 0, 0, -1},
+    {S_PRODUCT, S_PRODUCT_START, S_PRODUCT_END, 0, 0, 0, -1},
+    {S_PROMOTION, S_PROMOTION_START, S_PROMOTION_END, 0, 0, 0, -1},
+    {S_PURCHASE, S_PURCHASE_START, S_PURCHASE_END, 0, 0, 0, -1},
+    {S_PURCHASE_LINEITEM, S_PURCHASE_LINEITEM_START,
+     S_PURCHASE_LINEITEM_END, 0, 0, 0, -1},
+    {S_REASON, S_REASON_START, S_REASON_END, 0, 0, 0, -1},
+    {S_STORE, S_STORE_START, S_STORE_END, 0, 0, 0, -1},
+    {S_STORE_PROMOTIONAL_ITEM, S_STORE_PROMOTIONAL_ITEM_START,
+     S_STORE_PROMOTIONAL_ITEM_END, 0, 0, 0, -1},
+    {S_STORE_RETURNS, S_STORE_RETURNS_START, S_STORE_RETURNS_END, 0, 0, 0, -1},
+    {S_SUBCATEGORY, S_SUBCATEGORY_START, S_SUBCATEGORY_END, 0, 0, 0, -1},
+    {S_SUBCLASS, S_SUBCLASS_START, S_SUBCLASS_END, 0, 0, 0, -1},
+    {S_WAREHOUSE, S_WAREHOUSE_START, S_WAREHOUSE_END, 0, 0, 0, -1},
+    {S_WEB_ORDER, S_WEB_ORDER_START, S_WEB_ORDER_END, 0, 0, 0, -1},
+    {S_WEB_ORDER_LINEITEM, S_WEB_ORDER_LINEITEM_START,
+     S_WEB_ORDER_LINEITEM_END, 0, 0, 0, -1},
+    {S_WEB_PAGE, S_WEB_PAGE_START, S_WEB_PAGE_END, 0, 0, 0, -1},
+    {S_WEB_PROMOTIONAL_ITEM, S_WEB_PROMOTIONAL_ITEM_START,
+     S_WEB_PROMOTIONAL_ITEM_END, 0, 0, 0, -1},
+    {S_WEB_RETURNS, S_WEB_RETURNS_START, S_WEB_RETURNS_END, 0, 0, 0, -1},
+    {S_WEB_SITE, S_WEB_SITE_START, S_WEB_SITE_END, 0, 0, 0, -1},
+    {S_ZIPG, S_ZIPG_START, S_ZIPG_END, 0, 0, 0, -1},
 };
 
 constexpr int kTableMetadataCount =
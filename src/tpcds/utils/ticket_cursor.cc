@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/ticket_cursor.h"
+
+#include "utils/column_streams.h"
+#include "utils/random_utils.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+void ConsumeRemainingSeeds(RandomNumberStream* stream) {
+  while (stream->seeds_used() < stream->seeds_per_row()) {
+    GenerateUniformRandomInt(1, 100, stream);
+  }
+  stream->ResetSeedsUsed();
+}
+
+}  // namespace
+
+TicketCursor::TicketCursor(int column_id, int min_items, int max_items)
+    : stream_(column_id, SeedsPerRow(column_id)),
+      min_items_(min_items),
+      max_items_(max_items) {}
+
+void TicketCursor::MoveTo(int64_t row) {
+  if (row < ticket_start_row_) {
+    Reset();
+  }
+  while (ticket_end_row_ < row) {
+    DrawTicket();
+  }
+}
+
+void TicketCursor::Reset() {
+  stream_.ResetSeed();
+  order_number_ = 0;
+  ticket_start_row_ = 1;
+  ticket_end_row_ = 0;
+  prev_ticket_start_row_ = 1;
+}
+
+void TicketCursor::DrawTicket() {
+  int items = GenerateUniformRandomInt(min_items_, max_items_, &stream_);
+  ConsumeRemainingSeeds(&stream_);
+  if (order_number_ > 0) {
+    prev_ticket_start_row_ = ticket_start_row_;
+    ticket_start_row_ = ticket_end_row_ + 1;
+  }
+  ticket_end_row_ = ticket_start_row_ + items - 1;
+  ++order_number_;
+  ++tickets_drawn_;
+}
+
+ReturnTicketCursor::ReturnTicketCursor(int ticket_column_id, int min_items,
+                                       int max_items, int returned_column_id,
+                                       int return_pct)
+    : ticket_stream_(ticket_column_id, SeedsPerRow(ticket_column_id)),
+      returned_stream_(returned_column_id, SeedsPerRow(returned_column_id)),
+      min_items_(min_items),
+      max_items_(max_items),
+      return_pct_(return_pct) {}
+
+void ReturnTicketCursor::MoveTo(int64_t order_count) {
+  if (order_count < order_count_) {
+    Reset();
+  }
+  while (order_count_ < order_count) {
+    Advance();
+  }
+}
+
+void ReturnTicketCursor::Advance() {
+  DrawNext();
+  ++order_count_;
+  sales_rows_ += next_items_;
+  next_drawn_ = false;
+}
+
+int ReturnTicketCursor::next_returns() {
+  DrawNext();
+  return next_returns_;
+}
+
+void ReturnTicketCursor::Reset() {
+  ticket_stream_.ResetSeed();
+  returned_stream_.ResetSeed();
+  order_count_ = 0;
+  sales_rows_ = 0;
+  next_drawn_ = false;
+}
+
+void ReturnTicketCursor::DrawNext() {
+  if (next_drawn_) {
+    return;
+  }
+  next_items_ = GenerateUniformRandomInt(min_items_, max_items_,
+                                         &ticket_stream_);
+  next_returns_ = 0;
+  for (int item = 0; item < next_items_; ++item) {
+    if (GenerateUniformRandomInt(0, 99, &returned_stream_) < return_pct_) {
+      ++next_returns_;
+    }
+  }
+  ConsumeRemainingSeeds(&ticket_stream_);
+  ConsumeRemainingSeeds(&returned_stream_);
+  next_drawn_ = true;
+}
+
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "utils/random_number_stream.h"
+
+namespace benchgen::tpcds::internal {
+
+// Maps 1-based line item rows of a sales table to their ticket (order), by
+// drawing ticket sizes from the column's stream. Moving forward continues
+// from the current ticket, so a series of increasing lookups costs one pass
+// over the tickets in total; moving backward restarts from the first ticket.
+class TicketCursor {
+ public:
+  TicketCursor(int column_id, int min_items, int max_items);
+
+  // Positions the cursor on the ticket containing row (row >= 1).
+  void MoveTo(int64_t row);
+
+  int64_t order_number() const { return order_number_; }
+  int64_t ticket_start_row() const { return ticket_start_row_; }
+  int64_t ticket_end_row() const { return ticket_end_row_; }
+  int64_t prev_order_number() const { return order_number_ - 1; }
+  int64_t prev_ticket_start_row() const { return prev_ticket_start_row_; }
+  // Ticket sizes drawn since construction.
+  int64_t tickets_drawn() const { return tickets_drawn_; }
+
+ private:
+  void Reset();
+  void DrawTicket();
+
+  RandomNumberStream stream_;
+  int min_items_;
+  int max_items_;
+  int64_t order_number_ = 0;
+  int64_t ticket_start_row_ = 1;
+  int64_t ticket_end_row_ = 0;
+  int64_t prev_ticket_start_row_ = 1;
+  int64_t tickets_drawn_ = 0;
+};
+
+// Walks the tickets of a sales table drawing only their sizes and
+// is-returned flags, as the returns row counts do, so a returns table can
+// skip whole tickets without generating their sales. Like TicketCursor it
+// moves forward from the current ticket and restarts when moved backward.
+class ReturnTicketCursor {
+ public:
+  ReturnTicketCursor(int ticket_column_id, int min_items, int max_items,
+                     int returned_column_id, int return_pct);
+
+  // Positions the cursor after the first order_count tickets.
+  void MoveTo(int64_t order_count);
+  // Moves past the next ticket.
+  void Advance();
+
+  // Tickets and line items before the cursor.
+  int64_t order_count() const { return order_count_; }
+  int64_t sales_rows() const { return sales_rows_; }
+  // Returned line items of the next ticket.
+  int next_returns();
+
+ private:
+  void Reset();
+  void DrawNext();
+
+  RandomNumberStream ticket_stream_;
+  RandomNumberStream returned_stream_;
+  int min_items_;
+  int max_items_;
+  int return_pct_;
+  int64_t order_count_ = 0;
+  int64_t sales_rows_ = 0;
+  bool next_drawn_ = false;
+  int next_items_ = 0;
+  int next_returns_ = 0;
+};
+
+}  // namespace benchgen::tpcds::internal
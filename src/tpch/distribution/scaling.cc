@@ -23,6 +23,8 @@ constexpr int64_t kPartBase = 200000;
 constexpr int64_t kSupplierBase = 10000;
 constexpr int64_t kCustomerBase = 150000;
 constexpr int64_t kOrdersBase = 150000;
+// Refresh sets hold kUpdatePercent / 10000 of the orders (dbgen UPD_PCT).
+constexpr int64_t kUpdatePercent = 10;
 // dbgen lineitem row counts at scale 1/5/10 (used for interpolation).
 constexpr int64_t kLineItemScale1 = 6001215;
 constexpr int64_t kLineItemScale5 = 29999795;
@@ -72,6 +74,11 @@ int64_t OrderCount(double scale_factor) {
   return ScaleLinear(base, scale_factor);
 }
 
+int64_t RefreshOrderCount(double scale_factor) {
+  int64_t scale = scale_factor < 1.0 ? 1 : static_cast<int64_t>(scale_factor);
+  return kOrdersBase * kOrdersPerCustomer / 10000 * kUpdatePercent * scale;
+}
+
 int64_t RowCount(TableId table, double scale_factor) {
   switch (table) {
     case TableId::kPart:
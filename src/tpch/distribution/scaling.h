@@ -22,5 +22,9 @@ namespace benchgen::tpch::internal {
 
 int64_t OrderCount(double scale_factor);
 int64_t RowCount(TableId table, double scale_factor);
+// Orders in each set of a refresh (update) stream: dbgen's UPD_PCT of the
+// scale-1 orders, times the integer scale. Fractional scales count as 1,
+// as they do for `dbgen -U`.
+int64_t RefreshOrderCount(double scale_factor);
 
 }  // namespace benchgen::tpch::internal
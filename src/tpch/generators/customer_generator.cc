@@ -19,6 +19,7 @@
 #include "benchgen/arrow_compat.h"
 #include "benchgen/table.h"
 #include "generators/customer_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpch {
@@ -69,25 +70,35 @@ struct CustomerGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
 
     total_rows_ = row_generator_.total_rows();
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-
-    row_generator_.SkipRows(options_.start_row);
     return arrow::Status::OK();
   }
 
@@ -97,6 +108,7 @@ struct CustomerGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::CustomerRowGenerator row_generator_;
 };
 
@@ -117,6 +129,10 @@ std::string_view CustomerGenerator::name() const {
 
 std::string_view CustomerGenerator::suite_name() const { return "tpch"; }
 
+arrow::Status CustomerGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status CustomerGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -125,7 +141,7 @@ arrow::Status CustomerGenerator::Next(
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   auto money_type = arrow::decimal128(15, 2);
@@ -194,8 +210,10 @@ arrow::Status CustomerGenerator::Next(
   columns.push_back(c_mktsegment_array);
   columns.push_back(c_comment_array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows,
-                                                  std::move(columns), out);
+  TPCH_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t CustomerGenerator::total_rows() const { return impl_->total_rows_; }
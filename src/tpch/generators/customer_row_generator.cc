@@ -42,10 +42,15 @@ arrow::Status CustomerRowGenerator::Init() {
     }
   }
   total_rows_ = RowCount(TableId::kCustomer, scale_factor_);
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void CustomerRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void CustomerRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -66,7 +71,7 @@ void CustomerRowGenerator::GenerateRow(int64_t row_number, CustomerRow* out) {
   random_state_.RowStart();
 
   out->custkey = row_number;
-  out->name = FormatTagNumber(kCNameTag, 9, row_number);
+  FormatTagNumber(kCNameTag, 9, row_number, &out->name);
 
   VariableString(kCAddressLen, kCAddrSd, &random_state_, &out->address);
 
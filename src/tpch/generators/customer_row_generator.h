@@ -42,6 +42,8 @@ class CustomerRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   void GenerateRow(int64_t row_number, CustomerRow* out);
   int64_t total_rows() const { return total_rows_; }
 
@@ -52,6 +54,7 @@ class CustomerRowGenerator {
   int64_t total_rows_ = 0;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
@@ -20,6 +20,7 @@
 #include "benchgen/arrow_compat.h"
 #include "benchgen/table.h"
 #include "generators/lineitem_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpch {
@@ -62,7 +63,8 @@ struct LineItemGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
         schema_(BuildLineItemSchema()),
-        row_generator_(options_.scale_factor, options_.seed_mode) {}
+        row_generator_(options_.scale_factor, options_.seed_mode,
+                       options_.refresh_stream) {}
 
   arrow::Status Init() {
     if (options_.chunk_size <= 0) {
@@ -79,19 +81,33 @@ struct LineItemGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
 
     total_rows_ = -1;
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
 
-    if (options_.row_count < 0) {
+    if (row_count < 0) {
       remaining_rows_ = -1;
     } else {
-      remaining_rows_ = options_.row_count;
+      remaining_rows_ = row_count;
     }
 
-    row_generator_.SkipRows(options_.start_row);
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
 
     return arrow::Status::OK();
   }
@@ -99,8 +115,10 @@ struct LineItemGenerator::Impl {
   GeneratorOptions options_;
   int64_t total_rows_ = -1;
   int64_t remaining_rows_ = -1;
+  int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::LineItemRowGenerator row_generator_;
 };
 
@@ -121,13 +139,17 @@ std::string_view LineItemGenerator::name() const {
 
 std::string_view LineItemGenerator::suite_name() const { return "tpch"; }
 
+arrow::Status LineItemGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status LineItemGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
     return arrow::Status::OK();
   }
-  int64_t batch_rows = impl_->options_.chunk_size;
+  int64_t batch_rows = impl_->batch_sizer_.batch_rows();
   if (impl_->remaining_rows_ > 0) {
     batch_rows = std::min(batch_rows, impl_->remaining_rows_);
   }
@@ -198,6 +220,7 @@ arrow::Status LineItemGenerator::Next(
     TPCH_RETURN_NOT_OK(l_comment.Append(row.comment));
 
     ++produced;
+    ++impl_->current_row_;
     if (impl_->remaining_rows_ > 0) {
       --impl_->remaining_rows_;
     }
@@ -261,8 +284,10 @@ arrow::Status LineItemGenerator::Next(
   columns.push_back(l_shipmode_array);
   columns.push_back(l_comment_array);
 
-  return impl_->column_selection_.MakeRecordBatch(produced, std::move(columns),
-                                                  out);
+  TPCH_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      produced, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t LineItemGenerator::total_rows() const { return impl_->total_rows_; }
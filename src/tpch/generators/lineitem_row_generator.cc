@@ -19,6 +19,7 @@
 #include <mutex>
 #include <vector>
 
+#include "util/trace.h"
 #include "utils/constants.h"
 
 namespace benchgen::tpch::internal {
@@ -79,11 +80,12 @@ const LineItemIndex& GetLineItemIndex(double scale_factor,
   static std::map<int64_t, LineItemIndex> cache;
   int64_t key = ScaleKey(scale_factor);
 
-  std::lock_guard<std::mutex> lock(mutex);
+  auto lock = benchgen::internal::TracedLock(mutex, "wait lineitem index");
   auto it = cache.find(key);
   if (it != cache.end()) {
     return it->second;
   }
+  benchgen::internal::TraceSpan span("build lineitem index", "init");
   auto result = cache.emplace(key, BuildLineItemIndex(total_orders));
   return result.first->second;
 }
@@ -159,9 +161,11 @@ int64_t CurrentOffset(const LineItemIndex& index, int64_t order_index,
 }  // namespace
 
 LineItemRowGenerator::LineItemRowGenerator(double scale_factor,
-                                           DbgenSeedMode seed_mode)
+                                           DbgenSeedMode seed_mode,
+                                           int32_t refresh_stream)
     : scale_factor_(scale_factor),
-      order_generator_(scale_factor, seed_mode) {}
+      use_index_(refresh_stream <= 0),
+      order_generator_(scale_factor, seed_mode, refresh_stream) {}
 
 arrow::Status LineItemRowGenerator::Init() {
   auto status = order_generator_.Init();
@@ -175,6 +179,13 @@ arrow::Status LineItemRowGenerator::Init() {
   return arrow::Status::OK();
 }
 
+void LineItemRowGenerator::Rewind() {
+  order_generator_.Rewind();
+  current_order_index_ = 1;
+  current_line_index_ = 0;
+  has_order_ = false;
+}
+
 void LineItemRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -183,8 +194,9 @@ void LineItemRowGenerator::SkipRows(int64_t rows) {
     return;
   }
 
+  static const LineItemIndex kNoIndex;
   const LineItemIndex& index =
-      GetLineItemIndex(scale_factor_, total_orders_);
+      use_index_ ? GetLineItemIndex(scale_factor_, total_orders_) : kNoIndex;
   if (index.total_orders <= 0 || index.block_prefix.empty() ||
       rows < kLineItemIndexBlockSize) {
     while (rows > 0 && current_order_index_ <= total_orders_) {
@@ -25,15 +25,21 @@ namespace benchgen::tpch::internal {
 
 class LineItemRowGenerator {
  public:
-  LineItemRowGenerator(double scale_factor, DbgenSeedMode seed_mode);
+  LineItemRowGenerator(double scale_factor, DbgenSeedMode seed_mode,
+                       int32_t refresh_stream = 0);
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   bool NextRow(LineItemRow* out);
  int64_t total_orders() const { return total_orders_; }
 
  private:
   double scale_factor_ = 1.0;
+  // The shared lineitem index covers the base table only, so refresh
+  // streams (a few thousand orders per scale unit) skip order by order.
+  bool use_index_ = true;
   OrdersRowGenerator order_generator_;
   OrderRow current_order_{};
   int64_t total_orders_ = 0;
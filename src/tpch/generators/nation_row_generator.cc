@@ -46,10 +46,15 @@ arrow::Status NationRowGenerator::Init() {
         static_cast<int64_t>(context_.distributions().nations->list.size());
   }
 
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void NationRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void NationRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -38,6 +38,8 @@ class NationRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   void GenerateRow(int64_t row_number, NationRow* out);
   int64_t total_rows() const { return total_rows_; }
 
@@ -48,6 +50,7 @@ class NationRowGenerator {
   int64_t total_rows_ = 0;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
@@ -20,6 +20,7 @@
 #include "benchgen/arrow_compat.h"
 #include "benchgen/table.h"
 #include "generators/orders_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpch {
@@ -54,7 +55,8 @@ struct OrdersGenerator::Impl {
   explicit Impl(GeneratorOptions options)
       : options_(std::move(options)),
         schema_(BuildOrdersSchema()),
-        row_generator_(options_.scale_factor, options_.seed_mode) {}
+        row_generator_(options_.scale_factor, options_.seed_mode,
+                       options_.refresh_stream) {}
 
   arrow::Status Init() {
     if (options_.chunk_size <= 0) {
@@ -71,25 +73,35 @@ struct OrdersGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
 
     total_rows_ = row_generator_.total_rows();
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-
-    row_generator_.SkipRows(options_.start_row);
     return arrow::Status::OK();
   }
 
@@ -99,6 +111,7 @@ struct OrdersGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::OrdersRowGenerator row_generator_;
 };
 
@@ -119,6 +132,10 @@ std::string_view OrdersGenerator::name() const {
 
 std::string_view OrdersGenerator::suite_name() const { return "tpch"; }
 
+arrow::Status OrdersGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status OrdersGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
     *out = nullptr;
@@ -126,7 +143,7 @@ arrow::Status OrdersGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   auto money_type = arrow::decimal128(15, 2);
@@ -201,8 +218,10 @@ arrow::Status OrdersGenerator::Next(std::shared_ptr<arrow::RecordBatch>* out) {
   columns.push_back(o_shippriority_array);
   columns.push_back(o_comment_array);
 
-  return impl_->column_selection_.MakeRecordBatch(batch_rows,
-                                                  std::move(columns), out);
+  TPCH_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t OrdersGenerator::total_rows() const { return impl_->total_rows_; }
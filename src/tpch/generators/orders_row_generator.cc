@@ -24,8 +24,11 @@
 namespace benchgen::tpch::internal {
 
 OrdersRowGenerator::OrdersRowGenerator(double scale_factor,
-                                       DbgenSeedMode seed_mode)
-    : scale_factor_(scale_factor), seed_mode_(seed_mode) {}
+                                       DbgenSeedMode seed_mode,
+                                       int32_t refresh_stream)
+    : scale_factor_(scale_factor),
+      seed_mode_(seed_mode),
+      refresh_stream_(refresh_stream) {}
 
 arrow::Status OrdersRowGenerator::Init() {
   if (initialized_) {
@@ -49,10 +52,25 @@ arrow::Status OrdersRowGenerator::Init() {
   customer_count_ = RowCount(TableId::kCustomer, scale_factor_);
   int64_t scale = scale_factor_ < 1.0 ? 1 : static_cast<int64_t>(scale_factor_);
   max_clerk_ = std::max(scale * kOClerkScale, kOClerkScale);
+  if (refresh_stream_ > 0) {
+    // dbgen -U generates stream n's orders as rows (n - 1) * count + 1 ..
+    // n * count, continuing the base random streams, with keys in sparse
+    // key sequence 1 + n / 1000.
+    int64_t count = RefreshOrderCount(scale_factor_);
+    row_offset_ = static_cast<int64_t>(refresh_stream_ - 1) * count;
+    key_sequence_ = 1 + (refresh_stream_ % 10000) / 1000;
+    total_rows_ = count;
+    SkipRows(row_offset_);
+  }
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void OrdersRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void OrdersRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -77,7 +95,7 @@ void OrdersRowGenerator::GenerateRow(int64_t row_number, OrderRow* out) {
 
   random_state_.RowStart();
 
-  out->orderkey = MakeSparseKey(row_number, 0);
+  out->orderkey = MakeSparseKey(row_offset_ + row_number, key_sequence_);
   out->totalprice = 0;
   out->shippriority = 0;
   out->orderstatus = 'O';
@@ -101,7 +119,7 @@ void OrdersRowGenerator::GenerateRow(int64_t row_number, OrderRow* out) {
              &out->orderpriority);
 
   int64_t clerk_num = random_state_.RandomInt(1, max_clerk_, kOClrkSd);
-  out->clerk = FormatTagNumber(kOClerkTag, 9, clerk_num);
+  FormatTagNumber(kOClerkTag, 9, clerk_num, &out->clerk);
 
   GenerateText(kOCommentLen, kOCmntSd, &random_state_, context_.distributions(),
                &out->comment);
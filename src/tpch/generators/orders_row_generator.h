@@ -61,10 +61,15 @@ struct OrderRow {
 
 class OrdersRowGenerator {
  public:
-  OrdersRowGenerator(double scale_factor, DbgenSeedMode seed_mode);
+  // refresh_stream > 0 generates that update stream's RF1 insert orders
+  // instead of the base table (see GeneratorOptions::refresh_stream).
+  OrdersRowGenerator(double scale_factor, DbgenSeedMode seed_mode,
+                     int32_t refresh_stream = 0);
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   int32_t PeekLineCount() const;
   void GenerateRow(int64_t row_number, OrderRow* out);
   int64_t total_rows() const { return total_rows_; }
@@ -72,14 +77,20 @@ class OrdersRowGenerator {
  private:
   double scale_factor_;
   DbgenSeedMode seed_mode_;
+  int32_t refresh_stream_;
   bool initialized_ = false;
   int64_t total_rows_ = 0;
+  // Refresh streams reuse the random state of the base rows at
+  // row_offset_ and fill the sparse key gaps selected by key_sequence_.
+  int64_t row_offset_ = 0;
+  int64_t key_sequence_ = 0;
   int64_t part_count_ = 0;
   int64_t supplier_count_ = 0;
   int64_t customer_count_ = 0;
   int64_t max_clerk_ = 0;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
@@ -0,0 +1,243 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/part_partsupp_generator.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/table.h"
+#include "generators/part_generator.h"
+#include "generators/part_row_generator.h"
+#include "generators/partsupp_generator.h"
+#include "generators/partsupp_row_generator.h"
+#include "util/batch_sizer.h"
+#include "utils/constants.h"
+
+namespace benchgen::tpch {
+namespace {
+
+#define TPCH_RETURN_NOT_OK(status)      \
+  do {                                  \
+    ::arrow::Status _status = (status); \
+    if (!_status.ok()) {                \
+      return _status;                   \
+    }                                   \
+  } while (false)
+
+}  // namespace
+
+struct PartPartSuppGenerator::Impl {
+  Impl(GeneratorOptions options, bool part_first)
+      : options_(std::move(options)),
+        part_index_(part_first ? 0 : 1),
+        part_schema_(PartGenerator::TableSchema()),
+        partsupp_schema_(PartSuppGenerator::TableSchema()),
+        row_generator_(options_.scale_factor, options_.seed_mode) {}
+
+  arrow::Status Init() {
+    if (options_.chunk_size <= 0) {
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    if (!options_.column_names.empty()) {
+      return arrow::Status::Invalid(
+          "column_names is not supported when co-generating part and "
+          "partsupp");
+    }
+
+    auto status = row_generator_.Init();
+    if (!status.ok()) {
+      return status;
+    }
+    // Sized on parts; every batch also carries kSuppPerPart times as many
+    // partsupp rows.
+    status = batch_sizer_.Init(part_schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+
+    total_rows_ = row_generator_.total_rows();
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    if (start_row >= total_rows_) {
+      remaining_rows_ = 0;
+      return arrow::Status::OK();
+    }
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
+    } else {
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
+    }
+    return arrow::Status::OK();
+  }
+
+  GeneratorOptions options_;
+  int part_index_ = 0;
+  int64_t total_rows_ = 0;
+  int64_t remaining_rows_ = 0;
+  int64_t current_row_ = 0;
+  std::shared_ptr<arrow::Schema> part_schema_;
+  std::shared_ptr<arrow::Schema> partsupp_schema_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+  internal::PartRowGenerator row_generator_;
+};
+
+PartPartSuppGenerator::PartPartSuppGenerator(GeneratorOptions options,
+                                             bool part_first)
+    : impl_(std::make_unique<Impl>(std::move(options), part_first)) {}
+
+PartPartSuppGenerator::~PartPartSuppGenerator() = default;
+
+arrow::Status PartPartSuppGenerator::Init() { return impl_->Init(); }
+
+std::string_view PartPartSuppGenerator::suite_name() const { return "tpch"; }
+
+int PartPartSuppGenerator::table_count() const { return 2; }
+
+std::string_view PartPartSuppGenerator::name(int table) const {
+  return TableIdToString(table == impl_->part_index_ ? TableId::kPart
+                                                     : TableId::kPartSupp);
+}
+
+std::shared_ptr<arrow::Schema> PartPartSuppGenerator::schema(
+    int table) const {
+  return table == impl_->part_index_ ? impl_->part_schema_
+                                     : impl_->partsupp_schema_;
+}
+
+int PartPartSuppGenerator::driving_table() const { return impl_->part_index_; }
+
+arrow::Status PartPartSuppGenerator::Seek(int64_t start_row,
+                                          int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
+arrow::Status PartPartSuppGenerator::Next(
+    std::vector<std::shared_ptr<arrow::RecordBatch>>* out) {
+  if (impl_->remaining_rows_ == 0) {
+    out->clear();
+    return arrow::Status::OK();
+  }
+
+  const int64_t batch_rows =
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
+  const int64_t partsupp_rows = batch_rows * internal::kSuppPerPart;
+
+  arrow::MemoryPool* pool = arrow::default_memory_pool();
+  auto money_type = arrow::decimal128(15, 2);
+  arrow::Int64Builder p_partkey(pool);
+  arrow::StringBuilder p_name(pool);
+  arrow::StringBuilder p_mfgr(pool);
+  arrow::StringBuilder p_brand(pool);
+  arrow::StringBuilder p_type(pool);
+  arrow::Int32Builder p_size(pool);
+  arrow::StringBuilder p_container(pool);
+  arrow::Decimal128Builder p_retailprice(money_type, pool);
+  arrow::StringBuilder p_comment(pool);
+  arrow::Int64Builder ps_partkey(pool);
+  arrow::Int64Builder ps_suppkey(pool);
+  arrow::Int32Builder ps_availqty(pool);
+  arrow::Decimal128Builder ps_supplycost(money_type, pool);
+  arrow::StringBuilder ps_comment(pool);
+
+  TPCH_RETURN_NOT_OK(p_partkey.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_name.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_mfgr.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_brand.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_type.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_size.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_container.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_retailprice.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(p_comment.Reserve(batch_rows));
+  TPCH_RETURN_NOT_OK(ps_partkey.Reserve(partsupp_rows));
+  TPCH_RETURN_NOT_OK(ps_suppkey.Reserve(partsupp_rows));
+  TPCH_RETURN_NOT_OK(ps_availqty.Reserve(partsupp_rows));
+  TPCH_RETURN_NOT_OK(ps_supplycost.Reserve(partsupp_rows));
+  TPCH_RETURN_NOT_OK(ps_comment.Reserve(partsupp_rows));
+
+  internal::PartRow row;
+  std::array<internal::PartSuppRow, internal::kSuppPerPart> supp_rows;
+  for (int64_t i = 0; i < batch_rows; ++i) {
+    int64_t row_number = impl_->current_row_ + 1;
+    impl_->row_generator_.GenerateRowWithPartSupp(row_number, &row,
+                                                  &supp_rows);
+
+    TPCH_RETURN_NOT_OK(p_partkey.Append(row.partkey));
+    TPCH_RETURN_NOT_OK(p_name.Append(row.name));
+    TPCH_RETURN_NOT_OK(p_mfgr.Append(row.mfgr));
+    TPCH_RETURN_NOT_OK(p_brand.Append(row.brand));
+    TPCH_RETURN_NOT_OK(p_type.Append(row.type));
+    TPCH_RETURN_NOT_OK(p_size.Append(row.size));
+    TPCH_RETURN_NOT_OK(p_container.Append(row.container));
+    TPCH_RETURN_NOT_OK(
+        p_retailprice.Append(arrow::Decimal128(row.retailprice)));
+    TPCH_RETURN_NOT_OK(p_comment.Append(row.comment));
+
+    for (const auto& supp : supp_rows) {
+      TPCH_RETURN_NOT_OK(ps_partkey.Append(supp.partkey));
+      TPCH_RETURN_NOT_OK(ps_suppkey.Append(supp.suppkey));
+      TPCH_RETURN_NOT_OK(ps_availqty.Append(supp.availqty));
+      TPCH_RETURN_NOT_OK(
+          ps_supplycost.Append(arrow::Decimal128(supp.supplycost)));
+      TPCH_RETURN_NOT_OK(ps_comment.Append(supp.comment));
+    }
+
+    ++impl_->current_row_;
+    --impl_->remaining_rows_;
+  }
+
+  std::vector<std::shared_ptr<arrow::Array>> part_columns(9);
+  TPCH_RETURN_NOT_OK(p_partkey.Finish(&part_columns[0]));
+  TPCH_RETURN_NOT_OK(p_name.Finish(&part_columns[1]));
+  TPCH_RETURN_NOT_OK(p_mfgr.Finish(&part_columns[2]));
+  TPCH_RETURN_NOT_OK(p_brand.Finish(&part_columns[3]));
+  TPCH_RETURN_NOT_OK(p_type.Finish(&part_columns[4]));
+  TPCH_RETURN_NOT_OK(p_size.Finish(&part_columns[5]));
+  TPCH_RETURN_NOT_OK(p_container.Finish(&part_columns[6]));
+  TPCH_RETURN_NOT_OK(p_retailprice.Finish(&part_columns[7]));
+  TPCH_RETURN_NOT_OK(p_comment.Finish(&part_columns[8]));
+
+  std::vector<std::shared_ptr<arrow::Array>> partsupp_columns(5);
+  TPCH_RETURN_NOT_OK(ps_partkey.Finish(&partsupp_columns[0]));
+  TPCH_RETURN_NOT_OK(ps_suppkey.Finish(&partsupp_columns[1]));
+  TPCH_RETURN_NOT_OK(ps_availqty.Finish(&partsupp_columns[2]));
+  TPCH_RETURN_NOT_OK(ps_supplycost.Finish(&partsupp_columns[3]));
+  TPCH_RETURN_NOT_OK(ps_comment.Finish(&partsupp_columns[4]));
+
+  auto part = arrow::RecordBatch::Make(impl_->part_schema_, batch_rows,
+                                       std::move(part_columns));
+  auto partsupp = arrow::RecordBatch::Make(
+      impl_->partsupp_schema_, partsupp_rows, std::move(partsupp_columns));
+  impl_->batch_sizer_.Observe(*part);
+  out->resize(2);
+  (*out)[impl_->part_index_] = std::move(part);
+  (*out)[1 - impl_->part_index_] = std::move(partsupp);
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::tpch
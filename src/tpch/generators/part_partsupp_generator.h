@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/generator_options.h"
+#include "benchgen/record_batch_iterator.h"
+
+namespace benchgen::tpch {
+
+// part and partsupp from one pass over the parts: each batch of parts comes
+// with the kSuppPerPart partsupp rows of every part in it. Both tables match
+// PartGenerator and PartSuppGenerator row for row.
+class PartPartSuppGenerator final : public MultiRecordBatchIterator {
+ public:
+  // part_first orders the tables {part, partsupp}; otherwise the order is
+  // {partsupp, part}. Row ranges always count parts.
+  PartPartSuppGenerator(GeneratorOptions options, bool part_first);
+  ~PartPartSuppGenerator() override;
+
+  arrow::Status Init();
+  std::string_view suite_name() const override;
+  int table_count() const override;
+  std::string_view name(int table) const override;
+  std::shared_ptr<arrow::Schema> schema(int table) const override;
+  int driving_table() const override;
+  arrow::Status Next(
+      std::vector<std::shared_ptr<arrow::RecordBatch>>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace benchgen::tpch
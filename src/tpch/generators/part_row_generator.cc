@@ -41,10 +41,16 @@ arrow::Status PartRowGenerator::Init() {
     }
   }
   total_rows_ = RowCount(TableId::kPart, scale_factor_);
+  supplier_count_ = RowCount(TableId::kSupplier, scale_factor_);
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void PartRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void PartRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -57,6 +63,30 @@ void PartRowGenerator::GenerateRow(int64_t row_number, PartRow* out) {
   if (!out) {
     return;
   }
+  random_state_.RowStart();
+  GeneratePart(row_number, out);
+  random_state_.RowStop(DbgenTable::kPart);
+}
+
+void PartRowGenerator::GenerateRowWithPartSupp(
+    int64_t row_number, PartRow* part,
+    std::array<PartSuppRow, kSuppPerPart>* partsupp) {
+  if (!part || !partsupp) {
+    return;
+  }
+  random_state_.RowStart();
+  GeneratePart(row_number, part);
+  for (int i = 0; i < kSuppPerPart; ++i) {
+    GeneratePartSuppRow(row_number, i, supplier_count_,
+                        context_.distributions(), &random_state_,
+                        &(*partsupp)[static_cast<size_t>(i)]);
+  }
+  // Advances the partsupp streams too, as PartSuppRowGenerator's RowStop
+  // does for them.
+  random_state_.RowStop(DbgenTable::kPart);
+}
+
+void PartRowGenerator::GeneratePart(int64_t row_number, PartRow* out) {
   out->name.clear();
   out->mfgr.clear();
   out->brand.clear();
@@ -64,17 +94,15 @@ void PartRowGenerator::GenerateRow(int64_t row_number, PartRow* out) {
   out->container.clear();
   out->comment.clear();
 
-  random_state_.RowStart();
-
   out->partkey = row_number;
   AggString(*context_.distributions().colors, static_cast<int>(kPNameScl),
             kPNameSd, &random_state_, &out->name);
 
   int64_t mfgr = random_state_.RandomInt(kPMfgMin, kPMfgMax, kPMfgSd);
-  out->mfgr = FormatTagNumber(kPMfgTag, 1, mfgr);
+  FormatTagNumber(kPMfgTag, 1, mfgr, &out->mfgr);
 
   int64_t brnd = random_state_.RandomInt(kPBrndMin, kPBrndMax, kPBrndSd);
-  out->brand = FormatTagNumber(kPBrndTag, 2, mfgr * 10 + brnd);
+  FormatTagNumber(kPBrndTag, 2, mfgr * 10 + brnd, &out->brand);
 
   PickString(*context_.distributions().p_types, kPTypeSd, &random_state_,
              &out->type);
@@ -87,8 +115,6 @@ void PartRowGenerator::GenerateRow(int64_t row_number, PartRow* out) {
   out->retailprice = RetailPrice(out->partkey);
   GenerateText(kPCommentLen, kPCmntSd, &random_state_, context_.distributions(),
                &out->comment);
-
-  random_state_.RowStop(DbgenTable::kPart);
 }
 
 }  // namespace benchgen::tpch::internal
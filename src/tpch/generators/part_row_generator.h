@@ -16,10 +16,13 @@
 
 #include <arrow/status.h>
 
+#include <array>
 #include <cstdint>
 #include <string>
 
 #include "benchgen/generator_options.h"
+#include "generators/partsupp_row_generator.h"
+#include "utils/constants.h"
 #include "utils/context.h"
 #include "utils/random.h"
 
@@ -43,16 +46,28 @@ class PartRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   void GenerateRow(int64_t row_number, PartRow* out);
+  // Generates the part and its partsupp rows from one random state, as
+  // dbgen's mk_part does. The rows match GenerateRow and
+  // PartSuppRowGenerator.
+  void GenerateRowWithPartSupp(
+      int64_t row_number, PartRow* part,
+      std::array<PartSuppRow, kSuppPerPart>* partsupp);
   int64_t total_rows() const { return total_rows_; }
 
  private:
+  void GeneratePart(int64_t row_number, PartRow* out);
+
   double scale_factor_;
   DbgenSeedMode seed_mode_;
   bool initialized_ = false;
   int64_t total_rows_ = 0;
+  int64_t supplier_count_ = 0;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
@@ -19,6 +19,7 @@
 #include "benchgen/arrow_compat.h"
 #include "benchgen/table.h"
 #include "generators/partsupp_row_generator.h"
+#include "util/batch_sizer.h"
 #include "util/column_selection.h"
 
 namespace benchgen::tpch {
@@ -66,26 +67,35 @@ struct PartSuppGenerator::Impl {
       return status;
     }
     schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
 
     total_rows_ = row_generator_.total_rows();
-    if (options_.start_row < 0) {
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
       return arrow::Status::Invalid("start_row must be non-negative");
     }
-    if (options_.start_row >= total_rows_) {
+    if (start_row >= total_rows_) {
       remaining_rows_ = 0;
-      current_row_ = options_.start_row;
       return arrow::Status::OK();
     }
-    current_row_ = options_.start_row;
-    if (options_.row_count < 0) {
-      remaining_rows_ = total_rows_ - options_.start_row;
+    if (start_row < current_row_) {
+      row_generator_.Rewind();
+      current_row_ = 0;
+    }
+    row_generator_.SkipRows(start_row - current_row_);
+    current_row_ = start_row;
+    if (row_count < 0) {
+      remaining_rows_ = total_rows_ - start_row;
     } else {
-      remaining_rows_ =
-          std::min(options_.row_count, total_rows_ - options_.start_row);
+      remaining_rows_ = std::min(row_count, total_rows_ - start_row);
     }
-
-    row_generator_.SkipRows(options_.start_row);
-
     return arrow::Status::OK();
   }
 
@@ -95,6 +105,7 @@ struct PartSuppGenerator::Impl {
   int64_t current_row_ = 0;
   std::shared_ptr<arrow::Schema> schema_;
   ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
   internal::PartSuppRowGenerator row_generator_;
 };
 
@@ -115,6 +126,10 @@ std::string_view PartSuppGenerator::name() const {
 
 std::string_view PartSuppGenerator::suite_name() const { return "tpch"; }
 
+arrow::Status PartSuppGenerator::Seek(int64_t start_row, int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
 arrow::Status PartSuppGenerator::Next(
     std::shared_ptr<arrow::RecordBatch>* out) {
   if (impl_->remaining_rows_ == 0) {
@@ -123,7 +138,7 @@ arrow::Status PartSuppGenerator::Next(
   }
 
   const int64_t batch_rows =
-      std::min(impl_->remaining_rows_, impl_->options_.chunk_size);
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
 
   arrow::MemoryPool* pool = arrow::default_memory_pool();
   auto money_type = arrow::decimal128(15, 2);
@@ -176,8 +191,10 @@ arrow::Status PartSuppGenerator::Next(
   columns.push_back(ps_supplycost_array);
   columns.push_back(ps_comment_array);
 
-  return impl_->column_selection_.MakeRecordBatch(produced, std::move(columns),
-                                                  out);
+  TPCH_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      produced, std::move(columns), out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
 }
 
 int64_t PartSuppGenerator::total_rows() const { return impl_->total_rows_; }
@@ -186,6 +203,10 @@ int64_t PartSuppGenerator::remaining_rows() const {
   return impl_->remaining_rows_;
 }
 
+std::shared_ptr<arrow::Schema> PartSuppGenerator::TableSchema() {
+  return BuildPartSuppSchema();
+}
+
 int64_t PartSuppGenerator::TotalRows(double scale_factor) {
   GeneratorOptions options;
   options.scale_factor = scale_factor;
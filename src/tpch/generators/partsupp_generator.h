@@ -33,11 +33,14 @@ class PartSuppGenerator final : public RecordBatchIterator {
   std::string_view name() const override;
   std::string_view suite_name() const override;
   arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
 
   int64_t total_rows() const;
   int64_t remaining_rows() const;
 
   static int64_t TotalRows(double scale_factor);
+  // Every column of the table, before column selection.
+  static std::shared_ptr<arrow::Schema> TableSchema();
 
  private:
   struct Impl;
@@ -21,6 +21,19 @@
 
 namespace benchgen::tpch::internal {
 
+void GeneratePartSuppRow(int64_t partkey, int supp_index,
+                         int64_t supplier_count,
+                         const DbgenDistributions& distributions,
+                         RandomState* rng, PartSuppRow* out) {
+  out->partkey = partkey;
+  out->suppkey = PartSuppBridge(partkey, supp_index, supplier_count);
+  out->availqty =
+      static_cast<int32_t>(rng->RandomInt(kPSQtyMin, kPSQtyMax, kPsQtySd));
+  out->supplycost = rng->RandomInt(kPSScostMin, kPSScostMax, kPsScstSd);
+  out->comment.clear();
+  GenerateText(kPSCommentLen, kPsCmntSd, rng, distributions, &out->comment);
+}
+
 PartSuppRowGenerator::PartSuppRowGenerator(double scale_factor,
                                            DbgenSeedMode seed_mode)
     : scale_factor_(scale_factor), seed_mode_(seed_mode) {}
@@ -47,6 +60,7 @@ arrow::Status PartSuppRowGenerator::Init() {
   current_part_index_ = 1;
   current_supp_index_ = 0;
   has_part_ = false;
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
@@ -57,6 +71,13 @@ void PartSuppRowGenerator::LoadPart() {
   current_supp_index_ = 0;
 }
 
+void PartSuppRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+  current_part_index_ = 1;
+  current_supp_index_ = 0;
+  has_part_ = false;
+}
+
 void PartSuppRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -102,17 +123,9 @@ bool PartSuppRowGenerator::NextRow(PartSuppRow* out) {
       LoadPart();
     }
     if (current_supp_index_ < kSuppPerPart) {
-      int64_t supp_index = current_supp_index_;
-      out->partkey = current_part_index_;
-      out->suppkey =
-          PartSuppBridge(current_part_index_, supp_index, supplier_count_);
-      out->availqty = static_cast<int32_t>(
-          random_state_.RandomInt(kPSQtyMin, kPSQtyMax, kPsQtySd));
-      out->supplycost =
-          random_state_.RandomInt(kPSScostMin, kPSScostMax, kPsScstSd);
-      out->comment.clear();
-      GenerateText(kPSCommentLen, kPsCmntSd, &random_state_,
-                   context_.distributions(), &out->comment);
+      GeneratePartSuppRow(current_part_index_, current_supp_index_,
+                          supplier_count_, context_.distributions(),
+                          &random_state_, out);
 
       ++current_supp_index_;
       if (current_supp_index_ >= kSuppPerPart) {
@@ -33,12 +33,22 @@ struct PartSuppRow {
   std::string comment;
 };
 
+// Draws the supp_index-th partsupp row of partkey from rng's partsupp
+// streams. The caller brackets the kSuppPerPart rows of a part with
+// RowStart/RowStop.
+void GeneratePartSuppRow(int64_t partkey, int supp_index,
+                         int64_t supplier_count,
+                         const DbgenDistributions& distributions,
+                         RandomState* rng, PartSuppRow* out);
+
 class PartSuppRowGenerator {
  public:
   PartSuppRowGenerator(double scale_factor, DbgenSeedMode seed_mode);
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   bool NextRow(PartSuppRow* out);
   int64_t total_rows() const { return total_rows_; }
 
@@ -57,6 +67,7 @@ class PartSuppRowGenerator {
 
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
@@ -0,0 +1,150 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "generators/refresh_delete_generator.h"
+
+#include <algorithm>
+
+#include "benchgen/arrow_compat.h"
+#include "distribution/scaling.h"
+#include "util/batch_sizer.h"
+#include "util/column_selection.h"
+#include "utils/utils.h"
+
+namespace benchgen::tpch {
+namespace {
+
+std::shared_ptr<arrow::Schema> BuildRefreshDeleteSchema() {
+  return arrow::schema({
+      arrow::field("o_orderkey", arrow::int64(), false),
+  });
+}
+
+}  // namespace
+
+struct RefreshDeleteGenerator::Impl {
+  explicit Impl(GeneratorOptions options)
+      : options_(std::move(options)), schema_(BuildRefreshDeleteSchema()) {}
+
+  arrow::Status Init() {
+    if (options_.chunk_size <= 0) {
+      return arrow::Status::Invalid("chunk_size must be positive");
+    }
+    if (options_.refresh_stream <= 0) {
+      return arrow::Status::Invalid(
+          "the delete table requires a positive refresh_stream");
+    }
+
+    auto status = column_selection_.Init(schema_, options_.column_names);
+    if (!status.ok()) {
+      return status;
+    }
+    schema_ = column_selection_.schema();
+    status = batch_sizer_.Init(schema_, options_.chunk_size,
+                               options_.chunk_bytes);
+    if (!status.ok()) {
+      return status;
+    }
+
+    // Stream n deletes the base orders at the rows its inserts are
+    // generated from, in sparse key sequence (n - 1) / 1000.
+    total_rows_ = internal::RefreshOrderCount(options_.scale_factor);
+    first_row_ = static_cast<int64_t>(options_.refresh_stream - 1) *
+                     total_rows_ +
+                 1;
+    key_sequence_ = (options_.refresh_stream - 1) / 1000;
+    return Seek(options_.start_row, options_.row_count);
+  }
+
+  arrow::Status Seek(int64_t start_row, int64_t row_count) {
+    if (start_row < 0) {
+      return arrow::Status::Invalid("start_row must be non-negative");
+    }
+    current_row_ = std::min(start_row, total_rows_);
+    remaining_rows_ = total_rows_ - current_row_;
+    if (row_count >= 0) {
+      remaining_rows_ = std::min(row_count, remaining_rows_);
+    }
+    return arrow::Status::OK();
+  }
+
+  GeneratorOptions options_;
+  int64_t total_rows_ = 0;
+  int64_t first_row_ = 1;
+  int64_t key_sequence_ = 0;
+  int64_t remaining_rows_ = 0;
+  int64_t current_row_ = 0;
+  std::shared_ptr<arrow::Schema> schema_;
+  ::benchgen::internal::ColumnSelection column_selection_;
+  ::benchgen::internal::BatchSizer batch_sizer_;
+};
+
+RefreshDeleteGenerator::RefreshDeleteGenerator(GeneratorOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {}
+
+RefreshDeleteGenerator::~RefreshDeleteGenerator() = default;
+
+arrow::Status RefreshDeleteGenerator::Init() { return impl_->Init(); }
+
+std::shared_ptr<arrow::Schema> RefreshDeleteGenerator::schema() const {
+  return impl_->schema_;
+}
+
+std::string_view RefreshDeleteGenerator::name() const {
+  return kRefreshDeleteTableName;
+}
+
+std::string_view RefreshDeleteGenerator::suite_name() const { return "tpch"; }
+
+arrow::Status RefreshDeleteGenerator::Seek(int64_t start_row,
+                                           int64_t row_count) {
+  return impl_->Seek(start_row, row_count);
+}
+
+arrow::Status RefreshDeleteGenerator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  if (impl_->remaining_rows_ == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+
+  const int64_t batch_rows =
+      std::min(impl_->remaining_rows_, impl_->batch_sizer_.batch_rows());
+
+  arrow::Int64Builder o_orderkey(arrow::default_memory_pool());
+  ARROW_RETURN_NOT_OK(o_orderkey.Reserve(batch_rows));
+  for (int64_t i = 0; i < batch_rows; ++i) {
+    o_orderkey.UnsafeAppend(internal::MakeSparseKey(
+        impl_->first_row_ + impl_->current_row_, impl_->key_sequence_));
+    ++impl_->current_row_;
+    --impl_->remaining_rows_;
+  }
+
+  std::shared_ptr<arrow::Array> o_orderkey_array;
+  ARROW_RETURN_NOT_OK(o_orderkey.Finish(&o_orderkey_array));
+  ARROW_RETURN_NOT_OK(impl_->column_selection_.MakeRecordBatch(
+      batch_rows, {std::move(o_orderkey_array)}, out));
+  impl_->batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
+}
+
+int64_t RefreshDeleteGenerator::total_rows() const {
+  return impl_->total_rows_;
+}
+
+int64_t RefreshDeleteGenerator::remaining_rows() const {
+  return impl_->remaining_rows_;
+}
+
+}  // namespace benchgen::tpch
@@ -46,10 +46,15 @@ arrow::Status RegionRowGenerator::Init() {
         static_cast<int64_t>(context_.distributions().regions->list.size());
   }
 
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void RegionRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void RegionRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
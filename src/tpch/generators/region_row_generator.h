@@ -37,6 +37,8 @@ class RegionRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   void GenerateRow(int64_t row_number, RegionRow* out);
   int64_t total_rows() const { return total_rows_; }
 
@@ -47,6 +49,7 @@ class RegionRowGenerator {
   int64_t total_rows_ = 0;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
@@ -42,10 +42,15 @@ arrow::Status SupplierRowGenerator::Init() {
     }
   }
   total_rows_ = RowCount(TableId::kSupplier, scale_factor_);
+  initial_state_ = random_state_;
   initialized_ = true;
   return arrow::Status::OK();
 }
 
+void SupplierRowGenerator::Rewind() {
+  random_state_ = initial_state_;
+}
+
 void SupplierRowGenerator::SkipRows(int64_t rows) {
   if (rows <= 0) {
     return;
@@ -65,7 +70,7 @@ void SupplierRowGenerator::GenerateRow(int64_t row_number, SupplierRow* out) {
   random_state_.RowStart();
 
   out->suppkey = row_number;
-  out->name = FormatTagNumber(kSNameTag, 9, row_number);
+  FormatTagNumber(kSNameTag, 9, row_number, &out->name);
 
   VariableString(kSAddressLen, kSAddrSd, &random_state_, &out->address);
 
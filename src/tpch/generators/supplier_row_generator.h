@@ -41,6 +41,8 @@ class SupplierRowGenerator {
 
   arrow::Status Init();
   void SkipRows(int64_t rows);
+  // Restores the position reached right after Init().
+  void Rewind();
   void GenerateRow(int64_t row_number, SupplierRow* out);
   int64_t total_rows() const { return total_rows_; }
 
@@ -51,6 +53,7 @@ class SupplierRowGenerator {
   int64_t total_rows_ = 0;
   DbgenContext context_;
   RandomState random_state_;
+  RandomState initial_state_;
 };
 
 }  // namespace benchgen::tpch::internal
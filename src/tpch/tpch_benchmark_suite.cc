@@ -20,6 +20,7 @@
 #include "benchgen/benchmark_suite.h"
 #include "benchgen/table.h"
 #include "distribution/scaling.h"
+#include "generators/refresh_delete_generator.h"
 
 namespace benchgen {
 namespace {
@@ -57,6 +58,22 @@ class TpchSuite final : public BenchmarkSuite {
     }
     *is_known = false;
 
+    if (options.refresh_stream > 0) {
+      // Each refresh set holds a fixed number of orders; their lineitem
+      // count is only known after generating them.
+      if (table_name == tpch::kRefreshDeleteTableName ||
+          table_name == tpch::TableIdToString(tpch::TableId::kOrders)) {
+        *out = tpch::internal::RefreshOrderCount(options.scale_factor);
+        *is_known = true;
+        return arrow::Status::OK();
+      }
+      if (table_name == tpch::TableIdToString(tpch::TableId::kLineItem)) {
+        return arrow::Status::OK();
+      }
+      return arrow::Status::Invalid("No refresh stream for TPC-H table: ",
+                                    std::string(table_name));
+    }
+
     tpch::TableId table_id;
     if (!tpch::TableIdFromString(table_name, &table_id)) {
       return arrow::Status::Invalid("Unknown TPC-H table: ",
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <string_view>
 
+#include "util/trace.h"
 #include "utils/constants.h"
 
 namespace benchgen::tpch::internal {
@@ -252,8 +253,9 @@ const TextPool& GetTextPool(const DbgenDistributions& dists) {
   static TextPool pool;
   static bool initialized = false;
 
-  std::lock_guard<std::mutex> lock(mutex);
+  auto lock = benchgen::internal::TracedLock(mutex, "wait text pool");
   if (!initialized) {
+    benchgen::internal::TraceSpan span("build text pool", "init");
     pool.Build(dists);
     initialized = true;
   }
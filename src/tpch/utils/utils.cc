@@ -15,7 +15,9 @@
 #include "utils/utils.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdio>
+#include <cstring>
 
 #include "utils/constants.h"
 
@@ -35,6 +37,15 @@ constexpr MonthInfo kMonths[] = {
     {31, 212}, {31, 243}, {30, 273}, {31, 304}, {30, 334}, {31, 365},
 };
 
+// Writes value as exactly width zero-padded decimal digits; higher digits
+// are dropped, so callers size width to the value range.
+void WriteDigits(int64_t value, int width, char* out) {
+  for (int i = width - 1; i >= 0; --i) {
+    out[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+}
+
 bool IsLeapYear(int64_t year) { return (year % 4 == 0) && (year % 100 != 0); }
 
 int64_t LeapAdjustment(int64_t year, int month) {
@@ -108,17 +119,25 @@ int PickString(const Distribution& dist, int stream, RandomState* rng,
 
 void AggString(const Distribution& dist, int count, int stream,
                RandomState* rng, std::string* out) {
-  if (!rng || !out || dist.list.empty() || count <= 0) {
-    if (out) {
-      out->clear();
-    }
+  if (!out) {
+    return;
+  }
+  out->clear();
+  if (!rng || dist.list.empty() || count <= 0) {
     return;
   }
   int dist_size = static_cast<int>(dist.list.size());
   if (count > dist_size) {
     count = dist_size;
   }
-  std::vector<int> permute(dist_size);
+  // The colors list has 92 entries; only larger lists touch the heap.
+  std::array<int, 128> inline_permute;
+  std::vector<int> heap_permute;
+  int* permute = inline_permute.data();
+  if (dist_size > static_cast<int>(inline_permute.size())) {
+    heap_permute.resize(static_cast<std::size_t>(dist_size));
+    permute = heap_permute.data();
+  }
   for (int i = 0; i < dist_size; ++i) {
     permute[i] = i;
   }
@@ -126,15 +145,12 @@ void AggString(const Distribution& dist, int count, int stream,
     int64_t source = rng->RandomInt(i, dist_size - 1, stream);
     std::swap(permute[i], permute[static_cast<int>(source)]);
   }
-  std::string result;
-  result.reserve(static_cast<std::size_t>(count) * 8);
   for (int i = 0; i < count; ++i) {
     if (i > 0) {
-      result.push_back(' ');
+      out->push_back(' ');
     }
-    result += dist.list[permute[i]].text;
+    out->append(dist.list[static_cast<std::size_t>(permute[i])].text);
   }
-  *out = std::move(result);
 }
 
 void GeneratePhone(int64_t nation_index, int stream, RandomState* rng,
@@ -145,17 +161,14 @@ void GeneratePhone(int64_t nation_index, int stream, RandomState* rng,
   int64_t acode = rng->RandomInt(100, 999, stream);
   int64_t exchg = rng->RandomInt(100, 999, stream);
   int64_t number = rng->RandomInt(1000, 9999, stream);
-  char buffer[kPhoneLen + 1] = {};
-  std::snprintf(buffer, sizeof(buffer), "%02d",
-                10 + static_cast<int>(nation_index % kNationsMax));
-  std::snprintf(buffer + 3, sizeof(buffer) - 3, "%03d",
-                static_cast<int>(acode));
-  std::snprintf(buffer + 7, sizeof(buffer) - 7, "%03d",
-                static_cast<int>(exchg));
-  std::snprintf(buffer + 11, sizeof(buffer) - 11, "%04d",
-                static_cast<int>(number));
+  // "CC-AAA-EEE-NNNN"
+  out->resize(kPhoneLen);
+  char* buffer = out->data();
+  WriteDigits(10 + nation_index % kNationsMax, 2, buffer);
+  WriteDigits(acode, 3, buffer + 3);
+  WriteDigits(exchg, 3, buffer + 7);
+  WriteDigits(number, 4, buffer + 11);
   buffer[2] = buffer[6] = buffer[10] = '-';
-  *out = buffer;
 }
 
 int64_t RetailPrice(int64_t partkey) {
@@ -218,11 +231,20 @@ void BuildAscDate(std::vector<std::string>* out) {
   }
 }
 
-std::string FormatTagNumber(const char* tag, int width, int64_t number) {
-  char buffer[64] = {};
-  std::snprintf(buffer, sizeof(buffer), "%s%0*lld", tag, width,
-                static_cast<long long>(number));
-  return buffer;
+void FormatTagNumber(const char* tag, int width, int64_t number,
+                     std::string* out) {
+  if (!out) {
+    return;
+  }
+  std::size_t tag_len = std::strlen(tag);
+  int digits = 1;
+  for (int64_t rest = number / 10; rest > 0; rest /= 10) {
+    ++digits;
+  }
+  digits = std::max(digits, width);
+  out->resize(tag_len + static_cast<std::size_t>(digits));
+  std::memcpy(out->data(), tag, tag_len);
+  WriteDigits(number, digits, out->data() + tag_len);
 }
 
 }  // namespace benchgen::tpch::internal
@@ -44,6 +44,9 @@ int64_t OrderDateMax();
 int64_t JulianDate(int64_t date);
 void BuildAscDate(std::vector<std::string>* out);
 
-std::string FormatTagNumber(const char* tag, int width, int64_t number);
+// Writes tag followed by number zero-padded to width, e.g.
+// "Customer#000000001".
+void FormatTagNumber(const char* tag, int width, int64_t number,
+                     std::string* out);
 
 }  // namespace benchgen::tpch::internal
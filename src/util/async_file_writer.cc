@@ -0,0 +1,469 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/async_file_writer.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+#include "util/trace.h"
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && \
+    defined(__NR_io_uring_enter)
+#define BENCHGEN_HAVE_IO_URING 1
+#endif
+
+namespace benchgen::internal {
+namespace {
+
+arrow::Status ErrnoStatus(const char* what, const std::string& path,
+                          int error) {
+  return arrow::Status::IOError(what, " ", path, ": ", std::strerror(error));
+}
+
+}  // namespace
+
+bool ParseFileWriteBackend(std::string_view name, FileWriteBackend* out) {
+  if (name == "stream") {
+    *out = FileWriteBackend::kStream;
+  } else if (name == "pwrite") {
+    *out = FileWriteBackend::kPwrite;
+  } else if (name == "io_uring" || name == "io-uring") {
+    *out = FileWriteBackend::kIoUring;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::string_view FileWriteBackendToString(FileWriteBackend backend) {
+  switch (backend) {
+    case FileWriteBackend::kStream:
+      return "stream";
+    case FileWriteBackend::kPwrite:
+      return "pwrite";
+    case FileWriteBackend::kIoUring:
+      return "io_uring";
+  }
+  return "unknown";
+}
+
+// Just enough of io_uring for positional writes, over the raw syscalls so
+// the build does not need liburing. Single submitter, single reaper.
+class AsyncFileWriter::IoUring {
+ public:
+  IoUring() = default;
+  IoUring(const IoUring&) = delete;
+  IoUring& operator=(const IoUring&) = delete;
+
+#ifdef BENCHGEN_HAVE_IO_URING
+  ~IoUring() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_bytes_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      munmap(cq_ring_, cq_ring_bytes_);
+    }
+    if (sq_ring_ != nullptr) {
+      munmap(sq_ring_, sq_ring_bytes_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  arrow::Status Init(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(
+        syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+      return arrow::Status::IOError("io_uring_setup: ", std::strerror(errno));
+    }
+    ring_fd_ = fd;
+
+    sq_ring_bytes_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_bytes_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_bytes_ = cq_ring_bytes_ =
+          std::max(sq_ring_bytes_, cq_ring_bytes_);
+    }
+    ARROW_RETURN_NOT_OK(Map(sq_ring_bytes_, IORING_OFF_SQ_RING, &sq_ring_));
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      ARROW_RETURN_NOT_OK(Map(cq_ring_bytes_, IORING_OFF_CQ_RING, &cq_ring_));
+    }
+    sqes_bytes_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes = nullptr;
+    ARROW_RETURN_NOT_OK(Map(sqes_bytes_, IORING_OFF_SQES, &sqes));
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    char* sq = static_cast<char*>(sq_ring_);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    char* cq = static_cast<char*>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return arrow::Status::OK();
+  }
+
+  arrow::Status SubmitWrite(int fd, const char* data, size_t length,
+                            int64_t offset, uint64_t user_data) {
+    const unsigned tail = *sq_tail_;
+    const unsigned index = tail & sq_mask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(data);
+    sqe->len = static_cast<uint32_t>(length);
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->user_data = user_data;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+    while (true) {
+      long rc = syscall(__NR_io_uring_enter, ring_fd_, 1, 0, 0, nullptr, 0);
+      if (rc >= 0) {
+        return arrow::Status::OK();
+      }
+      if (errno != EINTR && errno != EAGAIN) {
+        return arrow::Status::IOError("io_uring_enter: ",
+                                      std::strerror(errno));
+      }
+    }
+  }
+
+  arrow::Status Wait(uint64_t* user_data, int32_t* result) {
+    while (true) {
+      const unsigned head = *cq_head_;
+      const unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      if (head != tail) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        *user_data = cqe.user_data;
+        *result = cqe.res;
+        __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+        return arrow::Status::OK();
+      }
+      long rc = syscall(__NR_io_uring_enter, ring_fd_, 0, 1,
+                        IORING_ENTER_GETEVENTS, nullptr, 0);
+      if (rc < 0 && errno != EINTR) {
+        return arrow::Status::IOError("io_uring_enter: ",
+                                      std::strerror(errno));
+      }
+    }
+  }
+
+ private:
+  arrow::Status Map(size_t bytes, uint64_t offset, void** out) {
+    void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd_,
+                     static_cast<off_t>(offset));
+    if (ptr == MAP_FAILED) {
+      return arrow::Status::IOError("io_uring mmap: ", std::strerror(errno));
+    }
+    *out = ptr;
+    return arrow::Status::OK();
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ring_ = nullptr;
+  void* cq_ring_ = nullptr;
+  size_t sq_ring_bytes_ = 0;
+  size_t cq_ring_bytes_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_bytes_ = 0;
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = nullptr;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+#else
+  arrow::Status Init(unsigned) {
+    return arrow::Status::NotImplemented("io_uring is not available");
+  }
+  arrow::Status SubmitWrite(int, const char*, size_t, int64_t, uint64_t) {
+    return arrow::Status::NotImplemented("io_uring is not available");
+  }
+  arrow::Status Wait(uint64_t*, int32_t*) {
+    return arrow::Status::NotImplemented("io_uring is not available");
+  }
+#endif
+};
+
+AsyncFileWriter::AsyncFileWriter(std::string path, int fd, bool direct_io)
+    : path_(std::move(path)),
+      fd_(fd),
+      backend_(FileWriteBackend::kPwrite),
+      direct_io_(direct_io),
+      buffer_bytes_(0) {}
+
+AsyncFileWriter::~AsyncFileWriter() {
+  (void)Close();
+  for (Buffer& buffer : buffers_) {
+    std::free(buffer.data);
+  }
+}
+
+arrow::Status AsyncFileWriter::Open(const std::string& path,
+                                    const AsyncFileWriterOptions& options,
+                                    std::unique_ptr<AsyncFileWriter>* out) {
+  if (options.backend == FileWriteBackend::kStream) {
+    return arrow::Status::Invalid(
+        "AsyncFileWriter needs the pwrite or io_uring backend");
+  }
+  if (options.buffer_bytes <= 0 || options.queue_depth <= 0) {
+    return arrow::Status::Invalid(
+        "buffer size and queue depth must be positive");
+  }
+  int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+  bool direct_io = false;
+  int fd = -1;
+#ifdef O_DIRECT
+  if (options.direct_io) {
+    fd = open(path.c_str(), flags | O_DIRECT, 0644);
+    direct_io = fd >= 0;
+    if (fd < 0 && errno != EINVAL) {
+      return ErrnoStatus("Failed to open output file", path, errno);
+    }
+  }
+#endif
+  if (fd < 0) {
+    fd = open(path.c_str(), flags, 0644);
+    if (fd < 0) {
+      return ErrnoStatus("Failed to open output file", path, errno);
+    }
+  }
+  std::unique_ptr<AsyncFileWriter> writer(
+      new AsyncFileWriter(path, fd, direct_io));
+  ARROW_RETURN_NOT_OK(writer->Init(options));
+  *out = std::move(writer);
+  return arrow::Status::OK();
+}
+
+arrow::Status AsyncFileWriter::Init(const AsyncFileWriterOptions& options) {
+  const int64_t alignment = AsyncFileWriterOptions::kAlignment;
+  buffer_bytes_ = static_cast<size_t>(
+      (options.buffer_bytes + alignment - 1) / alignment * alignment);
+
+  size_t buffer_count = 1;
+  if (options.backend == FileWriteBackend::kIoUring) {
+    auto ring = std::make_unique<IoUring>();
+    if (ring->Init(static_cast<unsigned>(options.queue_depth)).ok()) {
+      ring_ = std::move(ring);
+      backend_ = FileWriteBackend::kIoUring;
+      // One buffer fills while queue_depth are in flight.
+      buffer_count = static_cast<size_t>(options.queue_depth) + 1;
+    }
+  }
+  buffers_.resize(buffer_count);
+  for (Buffer& buffer : buffers_) {
+    buffer.data = static_cast<char*>(
+        std::aligned_alloc(static_cast<size_t>(alignment), buffer_bytes_));
+    if (buffer.data == nullptr) {
+      return arrow::Status::OutOfMemory("Failed to allocate ", buffer_bytes_,
+                                        " byte write buffer");
+    }
+  }
+  ResetPutArea();
+  return arrow::Status::OK();
+}
+
+void AsyncFileWriter::ResetPutArea() {
+  char* data = buffers_[current_].data;
+  setp(data, data + buffer_bytes_);
+}
+
+arrow::Status AsyncFileWriter::PwriteAll(const char* data, size_t length,
+                                         int64_t offset) {
+  while (length > 0) {
+    ssize_t written = pwrite(fd_, data, length, static_cast<off_t>(offset));
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return ErrnoStatus("Failed to write", path_, errno);
+    }
+    data += written;
+    length -= static_cast<size_t>(written);
+    offset += written;
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status AsyncFileWriter::SubmitCurrent(size_t length) {
+  Buffer& buffer = buffers_[current_];
+  buffer.length = length;
+  buffer.offset = offset_;
+  offset_ += static_cast<int64_t>(length);
+  if (backend_ != FileWriteBackend::kIoUring) {
+    return PwriteAll(buffer.data, length, buffer.offset);
+  }
+
+  ARROW_RETURN_NOT_OK(ring_->SubmitWrite(fd_, buffer.data, length,
+                                         buffer.offset, current_));
+  buffer.in_flight = true;
+  ++in_flight_;
+  current_ = (current_ + 1) % buffers_.size();
+  while (buffers_[current_].in_flight) {
+    ARROW_RETURN_NOT_OK(WaitForOne());
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status AsyncFileWriter::WaitForOne() {
+  uint64_t index = 0;
+  int32_t result = 0;
+  {
+    TraceSpan span("wait io completion", "io");
+    ARROW_RETURN_NOT_OK(ring_->Wait(&index, &result));
+  }
+  if (index >= buffers_.size()) {
+    return arrow::Status::IOError("Unexpected io_uring completion");
+  }
+  Buffer& buffer = buffers_[index];
+  buffer.in_flight = false;
+  --in_flight_;
+  if (result < 0) {
+    // Kernels before 5.6 reject IORING_OP_WRITE with EINVAL: finish this
+    // buffer with pwrite and stop submitting to the ring.
+    if (result != -EINVAL) {
+      return ErrnoStatus("Failed to write", path_, -result);
+    }
+    backend_ = FileWriteBackend::kPwrite;
+    return PwriteAll(buffer.data, buffer.length, buffer.offset);
+  }
+  if (static_cast<size_t>(result) < buffer.length) {
+    return PwriteAll(buffer.data + result, buffer.length - result,
+                     buffer.offset + result);
+  }
+  return arrow::Status::OK();
+}
+
+AsyncFileWriter::int_type AsyncFileWriter::overflow(int_type ch) {
+  if (!status_.ok()) {
+    return traits_type::eof();
+  }
+  status_ = SubmitCurrent(static_cast<size_t>(pptr() - pbase()));
+  if (!status_.ok()) {
+    setp(nullptr, nullptr);
+    return traits_type::eof();
+  }
+  ResetPutArea();
+  if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+  }
+  return traits_type::not_eof(ch);
+}
+
+arrow::Status AsyncFileWriter::Close() {
+  if (fd_ < 0) {
+    return status_;
+  }
+  const size_t tail = pbase() == nullptr ? 0
+                                         : static_cast<size_t>(pptr() - pbase());
+  setp(nullptr, nullptr);
+  // The kernel may still be reading from in-flight buffers: always drain.
+  while (in_flight_ > 0) {
+    auto status = WaitForOne();
+    if (!status.ok()) {
+      if (status_.ok()) {
+        status_ = status;
+      }
+      // A failed wait leaves nothing reliable to wait for.
+      break;
+    }
+  }
+  if (status_.ok() && tail > 0) {
+    const char* data = buffers_[current_].data;
+    size_t aligned = 0;
+#ifdef O_DIRECT
+    if (direct_io_) {
+      // O_DIRECT needs aligned lengths: write the aligned prefix, then the
+      // remainder through the page cache.
+      const size_t alignment =
+          static_cast<size_t>(AsyncFileWriterOptions::kAlignment);
+      aligned = tail / alignment * alignment;
+      if (aligned > 0) {
+        status_ = PwriteAll(data, aligned, offset_);
+      }
+      int flags = fcntl(fd_, F_GETFL);
+      if (status_.ok() && aligned < tail &&
+          (flags < 0 || fcntl(fd_, F_SETFL, flags & ~O_DIRECT) < 0)) {
+        status_ = ErrnoStatus("Failed to clear O_DIRECT on", path_, errno);
+      }
+    }
+#endif
+    if (status_.ok() && aligned < tail) {
+      status_ = PwriteAll(data + aligned, tail - aligned,
+                          offset_ + static_cast<int64_t>(aligned));
+    }
+    offset_ += static_cast<int64_t>(tail);
+  }
+  if (close(fd_) != 0 && status_.ok()) {
+    status_ = ErrnoStatus("Failed to close", path_, errno);
+  }
+  fd_ = -1;
+  return status_;
+}
+
+AsyncFileSink::AsyncFileSink(std::unique_ptr<AsyncFileWriter> file,
+                             RecordBatchWriterFormat format)
+    : file_(std::move(file)), stream_(file_.get()), writer_(format) {}
+
+arrow::Status AsyncFileSink::Open(const std::string& path,
+                                  RecordBatchWriterFormat format,
+                                  const AsyncFileWriterOptions& options,
+                                  std::unique_ptr<AsyncFileSink>* out) {
+  std::unique_ptr<AsyncFileWriter> file;
+  ARROW_RETURN_NOT_OK(AsyncFileWriter::Open(path, options, &file));
+  out->reset(new AsyncFileSink(std::move(file), format));
+  return arrow::Status::OK();
+}
+
+arrow::Status AsyncFileSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  ARROW_RETURN_NOT_OK(writer_.Write(&stream_, batch));
+  if (!stream_) {
+    return file_->status().ok()
+               ? arrow::Status::IOError("Failed to write output stream")
+               : file_->status();
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status AsyncFileSink::Close() { return file_->Close(); }
+
+}  // namespace benchgen::internal
@@ -0,0 +1,134 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::internal {
+
+enum class FileWriteBackend {
+  kStream,   // std::ofstream
+  kPwrite,   // aligned buffers, synchronous pwrite(2)
+  kIoUring,  // aligned buffers, several writes in flight via io_uring
+};
+
+bool ParseFileWriteBackend(std::string_view name, FileWriteBackend* out);
+std::string_view FileWriteBackendToString(FileWriteBackend backend);
+
+struct AsyncFileWriterOptions {
+  static constexpr int64_t kAlignment = 4096;
+
+  FileWriteBackend backend = FileWriteBackend::kIoUring;
+  // Open with O_DIRECT to bypass the page cache. Falls back to buffered
+  // I/O if the file system rejects it.
+  bool direct_io = false;
+  // Size of each buffer; rounded up to kAlignment.
+  int64_t buffer_bytes = int64_t{4} << 20;
+  // Writes kept in flight (io_uring only).
+  int32_t queue_depth = 4;
+};
+
+// Stream buffer that fills aligned buffers in place and hands each full one
+// to pwrite or io_uring, so generated text is copied once, straight into
+// the buffer that goes to the kernel. With io_uring, queue_depth buffers
+// can be in flight while the next one fills. If io_uring is unavailable
+// (old kernel, seccomp) it falls back to pwrite.
+//
+// Errors make the stream fail; Close() reports the first one.
+class AsyncFileWriter final : public std::streambuf {
+ public:
+  static arrow::Status Open(const std::string& path,
+                            const AsyncFileWriterOptions& options,
+                            std::unique_ptr<AsyncFileWriter>* out);
+  ~AsyncFileWriter() override;
+
+  AsyncFileWriter(const AsyncFileWriter&) = delete;
+  AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+  // Writes the remaining data, waits for in-flight writes and closes the
+  // file.
+  arrow::Status Close();
+
+  const arrow::Status& status() const { return status_; }
+  // Backend actually in use after any fallback.
+  FileWriteBackend backend() const { return backend_; }
+  bool direct_io() const { return direct_io_; }
+
+ protected:
+  int_type overflow(int_type ch) override;
+  int sync() override { return status_.ok() ? 0 : -1; }
+
+ private:
+  class IoUring;
+  struct Buffer {
+    char* data = nullptr;
+    bool in_flight = false;
+    size_t length = 0;
+    int64_t offset = 0;
+  };
+
+  AsyncFileWriter(std::string path, int fd, bool direct_io);
+
+  arrow::Status Init(const AsyncFileWriterOptions& options);
+  arrow::Status SubmitCurrent(size_t length);
+  arrow::Status WaitForOne();
+  arrow::Status PwriteAll(const char* data, size_t length, int64_t offset);
+  void ResetPutArea();
+
+  std::string path_;
+  int fd_ = -1;
+  FileWriteBackend backend_;
+  bool direct_io_;
+  size_t buffer_bytes_;
+  std::vector<Buffer> buffers_;
+  size_t current_ = 0;
+  size_t in_flight_ = 0;
+  int64_t offset_ = 0;
+  std::unique_ptr<IoUring> ring_;
+  arrow::Status status_;
+};
+
+// Text sink over an AsyncFileWriter.
+class AsyncFileSink final : public RecordBatchSink {
+ public:
+  static arrow::Status Open(const std::string& path,
+                            RecordBatchWriterFormat format,
+                            const AsyncFileWriterOptions& options,
+                            std::unique_ptr<AsyncFileSink>* out);
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+ private:
+  AsyncFileSink(std::unique_ptr<AsyncFileWriter> file,
+                RecordBatchWriterFormat format);
+
+  std::unique_ptr<AsyncFileWriter> file_;
+  std::ostream stream_;
+  RecordBatchWriter writer_;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,143 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <arrow/status.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+// Picks the number of rows for each RecordBatch. Without a byte budget this is
+// the fixed chunk size. With one, the row width is estimated from the schema's
+// fixed-width columns plus running averages of the string column lengths seen
+// in earlier batches, and the row count is chosen to fill the budget.
+class BatchSizer {
+ public:
+  // Assumed average length of a string value before any batch was observed.
+  static constexpr double kDefaultStringBytes = 16.0;
+
+  BatchSizer() = default;
+
+  arrow::Status Init(const std::shared_ptr<arrow::Schema>& schema,
+                     int64_t chunk_size, int64_t chunk_bytes);
+
+  int64_t batch_rows() const { return batch_rows_; }
+  double estimated_row_bytes() const;
+
+  // Folds the string lengths of a produced batch into the running averages.
+  void Observe(const arrow::RecordBatch& batch);
+
+ private:
+  void UpdateBatchRows();
+
+  int64_t chunk_size_ = 0;
+  int64_t chunk_bytes_ = 0;
+  int64_t batch_rows_ = 0;
+  int field_count_ = 0;
+  double fixed_row_bytes_ = 0.0;
+  std::vector<int> string_columns_;
+  std::vector<int64_t> string_bytes_;
+  int64_t observed_rows_ = 0;
+};
+
+inline arrow::Status BatchSizer::Init(
+    const std::shared_ptr<arrow::Schema>& schema, int64_t chunk_size,
+    int64_t chunk_bytes) {
+  if (!schema) {
+    return arrow::Status::Invalid("schema must not be null");
+  }
+  if (chunk_bytes < 0) {
+    return arrow::Status::Invalid("chunk_bytes must be non-negative");
+  }
+
+  chunk_size_ = chunk_size;
+  chunk_bytes_ = chunk_bytes;
+  field_count_ = schema->num_fields();
+  fixed_row_bytes_ = 0.0;
+  string_columns_.clear();
+  string_bytes_.clear();
+  observed_rows_ = 0;
+
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    const auto& field = schema->field(i);
+    if (field->nullable()) {
+      fixed_row_bytes_ += 1.0 / 8.0;
+    }
+    const auto& type = field->type();
+    if (type->id() == arrow::Type::STRING ||
+        type->id() == arrow::Type::BINARY) {
+      fixed_row_bytes_ += sizeof(int32_t);
+      string_columns_.push_back(i);
+      continue;
+    }
+    auto fixed_width = dynamic_cast<const arrow::FixedWidthType*>(type.get());
+    if (fixed_width != nullptr) {
+      fixed_row_bytes_ += fixed_width->bit_width() / 8.0;
+    } else {
+      fixed_row_bytes_ += kDefaultStringBytes;
+    }
+  }
+  string_bytes_.assign(string_columns_.size(), 0);
+
+  UpdateBatchRows();
+  return arrow::Status::OK();
+}
+
+inline double BatchSizer::estimated_row_bytes() const {
+  double bytes = fixed_row_bytes_;
+  for (size_t i = 0; i < string_columns_.size(); ++i) {
+    if (observed_rows_ > 0) {
+      bytes += static_cast<double>(string_bytes_[i]) /
+               static_cast<double>(observed_rows_);
+    } else {
+      bytes += kDefaultStringBytes;
+    }
+  }
+  return bytes;
+}
+
+inline void BatchSizer::Observe(const arrow::RecordBatch& batch) {
+  if (chunk_bytes_ <= 0 || batch.num_rows() <= 0) {
+    return;
+  }
+  if (batch.num_columns() != field_count_) {
+    return;
+  }
+  for (size_t i = 0; i < string_columns_.size(); ++i) {
+    const auto& array = batch.column(string_columns_[i]);
+    string_bytes_[i] +=
+        static_cast<const arrow::BinaryArray&>(*array).total_values_length();
+  }
+  observed_rows_ += batch.num_rows();
+  UpdateBatchRows();
+}
+
+inline void BatchSizer::UpdateBatchRows() {
+  if (chunk_bytes_ <= 0) {
+    batch_rows_ = chunk_size_;
+    return;
+  }
+  double row_bytes = std::max(estimated_row_bytes(), 1.0);
+  batch_rows_ = std::max<int64_t>(
+      1, static_cast<int64_t>(static_cast<double>(chunk_bytes_) / row_bytes));
+}
+
+}  // namespace benchgen::internal
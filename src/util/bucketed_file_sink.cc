@@ -0,0 +1,158 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/bucketed_file_sink.h"
+
+#include <arrow/compute/api_vector.h>
+
+#include <filesystem>
+#include <sstream>
+#include <utility>
+
+#include "util/hash.h"
+
+namespace benchgen::internal {
+
+int32_t BucketForKey(int64_t key, int32_t buckets) {
+  return static_cast<int32_t>(MixBits(static_cast<uint64_t>(key)) %
+                              static_cast<uint64_t>(buckets));
+}
+
+int32_t BucketForKey(std::string_view key, int32_t buckets) {
+  return static_cast<int32_t>(HashBytes(key) %
+                              static_cast<uint64_t>(buckets));
+}
+
+BucketedFileSink::BucketedFileSink(std::string root, std::string column,
+                                   int32_t buckets, std::string file_name,
+                                   RecordBatchWriterFormat format,
+                                   int64_t max_open_files,
+                                   int64_t max_buffered_bytes)
+    : root_(std::move(root)),
+      column_(std::move(column)),
+      buckets_(buckets),
+      file_name_(std::move(file_name)),
+      writer_(format),
+      files_(max_open_files, max_buffered_bytes) {}
+
+std::string BucketedFileSink::BucketPath(int32_t bucket) const {
+  return (std::filesystem::path(root_) /
+          ("bucket-" + std::to_string(bucket)) / file_name_)
+      .string();
+}
+
+arrow::Status BucketedFileSink::ComputeBuckets(
+    const arrow::Array& column, std::vector<int32_t>* buckets) const {
+  const int64_t length = column.length();
+  buckets->assign(static_cast<size_t>(length), 0);
+  int32_t* out = buckets->data();
+  switch (column.type_id()) {
+    case arrow::Type::INT32: {
+      const auto& array = static_cast<const arrow::Int32Array&>(column);
+      const int32_t* values = array.raw_values();
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = BucketForKey(static_cast<int64_t>(values[i]), buckets_);
+      }
+      break;
+    }
+    case arrow::Type::INT64: {
+      const auto& array = static_cast<const arrow::Int64Array&>(column);
+      const int64_t* values = array.raw_values();
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = BucketForKey(values[i], buckets_);
+      }
+      break;
+    }
+    case arrow::Type::STRING: {
+      const auto& array = static_cast<const arrow::StringArray&>(column);
+      for (int64_t i = 0; i < length; ++i) {
+        out[i] = BucketForKey(array.GetView(i), buckets_);
+      }
+      break;
+    }
+    default:
+      return arrow::Status::NotImplemented("Unsupported bucket column type: ",
+                                           column.type()->ToString());
+  }
+  if (column.null_count() > 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      if (column.IsNull(i)) {
+        out[i] = 0;
+      }
+    }
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status BucketedFileSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  if (!batch) {
+    return arrow::Status::Invalid("record batch must not be null");
+  }
+  int column_index = batch->schema()->GetFieldIndex(column_);
+  if (column_index < 0) {
+    return arrow::Status::Invalid("Bucket column not found: ", column_);
+  }
+
+  std::vector<int32_t> row_buckets;
+  ARROW_RETURN_NOT_OK(ComputeBuckets(*batch->column(column_index), &row_buckets));
+
+  // Counting sort of row indices by bucket, stable within each bucket.
+  std::vector<int64_t> offsets(static_cast<size_t>(buckets_) + 1, 0);
+  for (int32_t bucket : row_buckets) {
+    ++offsets[static_cast<size_t>(bucket) + 1];
+  }
+  for (size_t b = 1; b < offsets.size(); ++b) {
+    offsets[b] += offsets[b - 1];
+  }
+  const int64_t num_rows = batch->num_rows();
+  ARROW_ASSIGN_OR_RAISE(auto index_buffer, arrow::AllocateBuffer(
+                                               num_rows * sizeof(int64_t)));
+  auto* indices = reinterpret_cast<int64_t*>(index_buffer->mutable_data());
+  std::vector<int64_t> cursor(offsets.begin(), offsets.end() - 1);
+  for (int64_t row = 0; row < num_rows; ++row) {
+    indices[cursor[static_cast<size_t>(row_buckets[row])]++] = row;
+  }
+  auto index_array = std::make_shared<arrow::Int64Array>(
+      num_rows, std::shared_ptr<arrow::Buffer>(std::move(index_buffer)));
+
+  std::ostringstream rendered;
+  for (int32_t bucket = 0; bucket < buckets_; ++bucket) {
+    int64_t begin = offsets[static_cast<size_t>(bucket)];
+    int64_t count = offsets[static_cast<size_t>(bucket) + 1] - begin;
+    if (count == 0) {
+      continue;
+    }
+    std::shared_ptr<arrow::RecordBatch> part = batch;
+    if (count != num_rows) {
+      ARROW_ASSIGN_OR_RAISE(
+          arrow::Datum taken,
+          arrow::compute::Take(batch, index_array->Slice(begin, count)));
+      part = taken.record_batch();
+    }
+    rendered.str(std::string());
+    ARROW_RETURN_NOT_OK(writer_.Write(&rendered, part));
+    ARROW_RETURN_NOT_OK(files_.Append(BucketPath(bucket), rendered.str()));
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status BucketedFileSink::Close() {
+  for (int32_t bucket = 0; bucket < buckets_; ++bucket) {
+    ARROW_RETURN_NOT_OK(files_.Append(BucketPath(bucket), {}));
+  }
+  return files_.Close();
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,66 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/buffered_file_set.h"
+#include "util/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::internal {
+
+// Bucket routing is part of the output contract, so loaders can compute it
+// independently:
+//   integer keys (int32 sign-extended to 64 bits): MixBits(key) % buckets
+//   string keys: HashBytes(utf8 bytes) % buckets
+//   null keys: bucket 0
+// where MixBits/HashBytes are the SplitMix64 / FNV-1a hashes in util/hash.h.
+int32_t BucketForKey(int64_t key, int32_t buckets);
+int32_t BucketForKey(std::string_view key, int32_t buckets);
+
+// Routes the rows of each batch into <root>/bucket-<b>/<file_name> by the
+// hash of one column. Bucket ids are computed for the whole column, rows
+// are grouped with a counting sort and each bucket is gathered with one
+// arrow::compute::Take. Every bucket file exists after Close, even if empty.
+class BucketedFileSink final : public RecordBatchSink {
+ public:
+  BucketedFileSink(std::string root, std::string column, int32_t buckets,
+                   std::string file_name, RecordBatchWriterFormat format,
+                   int64_t max_open_files, int64_t max_buffered_bytes);
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+ private:
+  arrow::Status ComputeBuckets(const arrow::Array& column,
+                               std::vector<int32_t>* buckets) const;
+  std::string BucketPath(int32_t bucket) const;
+
+  std::string root_;
+  std::string column_;
+  int32_t buckets_;
+  std::string file_name_;
+  RecordBatchWriter writer_;
+  BufferedFileSet files_;
+};
+
+}  // namespace benchgen::internal
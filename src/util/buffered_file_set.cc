@@ -0,0 +1,133 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/buffered_file_set.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+namespace benchgen::internal {
+
+BufferedFileSet::BufferedFileSet(int64_t max_open_files,
+                                 int64_t max_buffered_bytes)
+    : max_open_files_(std::max<int64_t>(1, max_open_files)),
+      max_buffered_bytes_(std::max<int64_t>(0, max_buffered_bytes)) {}
+
+BufferedFileSet::~BufferedFileSet() { (void)Close(); }
+
+arrow::Status BufferedFileSet::Append(const std::string& path,
+                                      std::string_view data) {
+  auto [it, inserted] = files_.try_emplace(path);
+  File* file = &it->second;
+  if (inserted) {
+    file->path = path;
+    file->open_position = open_files_.end();
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) {
+      std::error_code ec;
+      std::filesystem::create_directories(parent, ec);
+      if (ec) {
+        return arrow::Status::IOError("Failed to create directory ",
+                                      parent.string(), ": ", ec.message());
+      }
+    }
+  }
+  file->buffer.append(data);
+  buffered_bytes_ += static_cast<int64_t>(data.size());
+  while (buffered_bytes_ > max_buffered_bytes_) {
+    ARROW_RETURN_NOT_OK(FlushLargest());
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status BufferedFileSet::Close() {
+  arrow::Status status;
+  for (auto& entry : files_) {
+    File* file = &entry.second;
+    if (!file->buffer.empty() || !file->created) {
+      status &= Flush(file);
+    }
+    status &= CloseStream(file);
+  }
+  files_.clear();
+  open_files_.clear();
+  buffered_bytes_ = 0;
+  return status;
+}
+
+arrow::Status BufferedFileSet::FlushLargest() {
+  File* largest = nullptr;
+  for (auto& entry : files_) {
+    if (largest == nullptr ||
+        entry.second.buffer.size() > largest->buffer.size()) {
+      largest = &entry.second;
+    }
+  }
+  if (largest == nullptr || largest->buffer.empty()) {
+    buffered_bytes_ = 0;
+    return arrow::Status::OK();
+  }
+  return Flush(largest);
+}
+
+arrow::Status BufferedFileSet::Flush(File* file) {
+  if (file->stream == nullptr) {
+    if (static_cast<int64_t>(open_files_.size()) >= max_open_files_) {
+      ARROW_RETURN_NOT_OK(CloseStream(open_files_.back()));
+    }
+    std::ios::openmode mode = std::ios::out | std::ios::binary |
+                              (file->created ? std::ios::app : std::ios::trunc);
+    auto stream = std::make_unique<std::ofstream>(file->path, mode);
+    if (!*stream) {
+      return arrow::Status::IOError("Failed to open output file: ",
+                                    file->path);
+    }
+    file->stream = std::move(stream);
+    file->created = true;
+    open_files_.push_front(file);
+    file->open_position = open_files_.begin();
+  } else {
+    open_files_.splice(open_files_.begin(), open_files_, file->open_position);
+  }
+
+  file->stream->write(file->buffer.data(),
+                      static_cast<std::streamsize>(file->buffer.size()));
+  if (!*file->stream) {
+    return arrow::Status::IOError("Failed to write output file: ", file->path);
+  }
+  buffered_bytes_ -= static_cast<int64_t>(file->buffer.size());
+  file->buffer.clear();
+  file->buffer.shrink_to_fit();
+  return arrow::Status::OK();
+}
+
+arrow::Status BufferedFileSet::CloseStream(File* file) {
+  if (file->stream == nullptr) {
+    return arrow::Status::OK();
+  }
+  file->stream->close();
+  bool ok = !file->stream->fail();
+  file->stream.reset();
+  open_files_.erase(file->open_position);
+  file->open_position = open_files_.end();
+  if (!ok) {
+    return arrow::Status::IOError("Failed to close output file: ",
+                                  file->path);
+  }
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::internal
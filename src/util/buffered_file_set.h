@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+// A set of output files written through per-file buffers, for sinks that
+// spread one stream of batches over many files. At most max_open_files
+// handles are open at once (least recently flushed is closed first) and
+// buffers are flushed, largest first, once they exceed max_buffered_bytes
+// in total. Files are truncated on first write and appended to afterwards.
+class BufferedFileSet {
+ public:
+  static constexpr int64_t kDefaultMaxOpenFiles = 64;
+  static constexpr int64_t kDefaultMaxBufferedBytes = int64_t{64} << 20;
+
+  BufferedFileSet(int64_t max_open_files, int64_t max_buffered_bytes);
+  ~BufferedFileSet();
+
+  // Creates missing parent directories on first use of path.
+  arrow::Status Append(const std::string& path, std::string_view data);
+  arrow::Status Close();
+
+  int64_t file_count() const { return static_cast<int64_t>(files_.size()); }
+
+ private:
+  struct File {
+    std::string path;
+    std::string buffer;
+    std::unique_ptr<std::ofstream> stream;
+    std::list<File*>::iterator open_position;
+    bool created = false;
+  };
+
+  arrow::Status Flush(File* file);
+  arrow::Status FlushLargest();
+  arrow::Status CloseStream(File* file);
+
+  int64_t max_open_files_;
+  int64_t max_buffered_bytes_;
+  int64_t buffered_bytes_ = 0;
+  std::unordered_map<std::string, File> files_;
+  // Open files, most recently flushed at the front.
+  std::list<File*> open_files_;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,50 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/checksum_sink.h"
+
+#include <arrow/util/crc32.h>
+
+namespace benchgen::internal {
+
+std::streamsize ChecksumSink::Crc32Buffer::xsputn(const char* data,
+                                                  std::streamsize size) {
+  crc32_ = arrow::internal::crc32(crc32_, data, static_cast<size_t>(size));
+  bytes_ += size;
+  return size;
+}
+
+ChecksumSink::Crc32Buffer::int_type ChecksumSink::Crc32Buffer::overflow(
+    int_type ch) {
+  if (traits_type::eq_int_type(ch, traits_type::eof())) {
+    return traits_type::not_eof(ch);
+  }
+  char c = traits_type::to_char_type(ch);
+  xsputn(&c, 1);
+  return ch;
+}
+
+ChecksumSink::ChecksumSink(RecordBatchWriterFormat format)
+    : stream_(&buffer_), writer_(format) {}
+
+arrow::Status ChecksumSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  ARROW_RETURN_NOT_OK(writer_.Write(&stream_, batch));
+  rows_ += batch->num_rows();
+  return arrow::Status::OK();
+}
+
+arrow::Status ChecksumSink::Close() { return arrow::Status::OK(); }
+
+}  // namespace benchgen::internal
@@ -0,0 +1,64 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <streambuf>
+
+#include "benchgen/arrow_compat.h"
+#include "util/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::internal {
+
+// Formats batches as text and keeps only the byte count and zlib CRC-32 of
+// the result, so it matches ChecksumFile of the same rows written as a
+// text file without writing one.
+class ChecksumSink final : public RecordBatchSink {
+ public:
+  explicit ChecksumSink(RecordBatchWriterFormat format);
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+  int64_t rows() const { return rows_; }
+  int64_t bytes() const { return buffer_.bytes(); }
+  uint32_t crc32() const { return buffer_.crc32(); }
+
+ private:
+  class Crc32Buffer final : public std::streambuf {
+   public:
+    int64_t bytes() const { return bytes_; }
+    uint32_t crc32() const { return crc32_; }
+
+   protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) override;
+    int_type overflow(int_type ch) override;
+
+   private:
+    int64_t bytes_ = 0;
+    uint32_t crc32_ = 0;
+  };
+
+  Crc32Buffer buffer_;
+  std::ostream stream_;
+  RecordBatchWriter writer_;
+  int64_t rows_ = 0;
+};
+
+}  // namespace benchgen::internal
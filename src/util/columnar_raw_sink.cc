@@ -0,0 +1,295 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/columnar_raw_sink.h"
+
+#include <arrow/util/endian.h>
+
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#include "util/json.h"
+
+namespace benchgen::internal {
+namespace {
+
+enum class ColumnKind { kFixedWidth, kBoolean, kString };
+
+arrow::Status OpenFile(const std::filesystem::path& path,
+                       std::ofstream* file) {
+  file->open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!*file) {
+    return arrow::Status::IOError("Failed to open output file: ",
+                                  path.string());
+  }
+  return arrow::Status::OK();
+}
+
+}  // namespace
+
+struct ColumnarRawSink::Column {
+  std::shared_ptr<arrow::Field> field;
+  ColumnKind kind = ColumnKind::kFixedWidth;
+  int byte_width = 0;
+  std::ofstream data;
+  std::ofstream offsets;
+  std::ofstream validity;
+  // Bytes written to a string column's .data so far.
+  int64_t string_bytes = 0;
+  // Validity bits not yet filling a whole byte.
+  uint8_t pending_bits = 0;
+  int pending_count = 0;
+  std::vector<uint8_t> scratch;
+};
+
+ColumnarRawSink::ColumnarRawSink(std::string directory,
+                                 std::shared_ptr<arrow::Schema> schema)
+    : directory_(std::move(directory)), schema_(std::move(schema)) {}
+
+ColumnarRawSink::~ColumnarRawSink() = default;
+
+arrow::Status ColumnarRawSink::Open(
+    const std::string& directory, const std::shared_ptr<arrow::Schema>& schema,
+    std::unique_ptr<ColumnarRawSink>* out) {
+  if (!ARROW_LITTLE_ENDIAN) {
+    return arrow::Status::NotImplemented(
+        "columnar-raw output requires a little-endian host");
+  }
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+  if (ec) {
+    return arrow::Status::IOError("Failed to create output directory ",
+                                  directory, ": ", ec.message());
+  }
+  // Files left by an earlier dump (a stale schema.json above all) would pass
+  // for part of this one, so only an empty directory is written into.
+  const bool empty = std::filesystem::is_empty(directory, ec);
+  if (ec) {
+    return arrow::Status::IOError("Failed to read output directory ",
+                                  directory, ": ", ec.message());
+  }
+  if (!empty) {
+    return arrow::Status::Invalid("Output directory ", directory,
+                                  " is not empty");
+  }
+
+  std::unique_ptr<ColumnarRawSink> sink(
+      new ColumnarRawSink(directory, schema));
+  const std::filesystem::path dir(directory);
+  for (const auto& field : schema->fields()) {
+    auto column = std::make_unique<Column>();
+    column->field = field;
+    const auto& type = *field->type();
+    if (type.id() == arrow::Type::BOOL) {
+      column->kind = ColumnKind::kBoolean;
+      column->byte_width = 1;
+    } else if (type.id() == arrow::Type::STRING) {
+      column->kind = ColumnKind::kString;
+    } else if (arrow::is_fixed_width(type.id()) && type.bit_width() % 8 == 0) {
+      column->byte_width = type.bit_width() / 8;
+    } else {
+      return arrow::Status::NotImplemented(
+          "columnar-raw output does not support column ", field->name(),
+          " of type ", type.ToString());
+    }
+
+    ARROW_RETURN_NOT_OK(
+        OpenFile(dir / (field->name() + ".data"), &column->data));
+    if (column->kind == ColumnKind::kString) {
+      ARROW_RETURN_NOT_OK(
+          OpenFile(dir / (field->name() + ".offsets"), &column->offsets));
+      const int64_t first_offset = 0;
+      column->offsets.write(reinterpret_cast<const char*>(&first_offset),
+                            sizeof(first_offset));
+    }
+    if (field->nullable()) {
+      ARROW_RETURN_NOT_OK(
+          OpenFile(dir / (field->name() + ".validity"), &column->validity));
+    }
+    sink->columns_.push_back(std::move(column));
+  }
+  *out = std::move(sink);
+  return arrow::Status::OK();
+}
+
+arrow::Status ColumnarRawSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  if (batch->num_columns() != static_cast<int>(columns_.size())) {
+    return arrow::Status::Invalid("Batch has ", batch->num_columns(),
+                                  " columns, expected ", columns_.size());
+  }
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    ARROW_RETURN_NOT_OK(
+        WriteColumn(*batch->column(i), columns_[static_cast<size_t>(i)].get()));
+  }
+  rows_ += batch->num_rows();
+  return arrow::Status::OK();
+}
+
+arrow::Status ColumnarRawSink::WriteColumn(const arrow::Array& array,
+                                           Column* column) {
+  const int64_t length = array.length();
+  if (length == 0) {
+    return arrow::Status::OK();
+  }
+  switch (column->kind) {
+    case ColumnKind::kFixedWidth: {
+      const auto& data = *array.data();
+      const uint8_t* values =
+          data.buffers[1]->data() + data.offset * column->byte_width;
+      column->data.write(reinterpret_cast<const char*>(values),
+                         static_cast<std::streamsize>(length *
+                                                      column->byte_width));
+      break;
+    }
+    case ColumnKind::kBoolean: {
+      const auto& booleans = static_cast<const arrow::BooleanArray&>(array);
+      column->scratch.resize(static_cast<size_t>(length));
+      for (int64_t i = 0; i < length; ++i) {
+        column->scratch[static_cast<size_t>(i)] = booleans.Value(i) ? 1 : 0;
+      }
+      column->data.write(reinterpret_cast<const char*>(column->scratch.data()),
+                         static_cast<std::streamsize>(length));
+      break;
+    }
+    case ColumnKind::kString: {
+      const auto& strings = static_cast<const arrow::StringArray&>(array);
+      const int32_t first = strings.value_offset(0);
+      const int32_t last = strings.value_offset(length);
+      column->scratch.resize(static_cast<size_t>(length) * sizeof(int64_t));
+      auto* offsets = reinterpret_cast<int64_t*>(column->scratch.data());
+      for (int64_t i = 0; i < length; ++i) {
+        offsets[i] =
+            column->string_bytes + (strings.value_offset(i + 1) - first);
+      }
+      column->offsets.write(
+          reinterpret_cast<const char*>(offsets),
+          static_cast<std::streamsize>(length * sizeof(int64_t)));
+      column->data.write(
+          reinterpret_cast<const char*>(strings.value_data()->data() + first),
+          last - first);
+      column->string_bytes += last - first;
+      if (!column->offsets) {
+        return arrow::Status::IOError("Error writing ", directory_, "/",
+                                      column->field->name(), ".offsets");
+      }
+      break;
+    }
+  }
+  if (!column->data) {
+    return arrow::Status::IOError("Error writing ", directory_, "/",
+                                  column->field->name(), ".data");
+  }
+
+  if (!column->field->nullable()) {
+    if (array.null_count() != 0) {
+      return arrow::Status::Invalid("Non-nullable column ",
+                                    column->field->name(), " has nulls");
+    }
+    return arrow::Status::OK();
+  }
+  // Batches rarely end on a byte boundary, so bits are repacked onto the
+  // running bitmap.
+  column->scratch.clear();
+  for (int64_t i = 0; i < length; ++i) {
+    if (array.IsValid(i)) {
+      column->pending_bits |= static_cast<uint8_t>(1u << column->pending_count);
+    }
+    if (++column->pending_count == 8) {
+      column->scratch.push_back(column->pending_bits);
+      column->pending_bits = 0;
+      column->pending_count = 0;
+    }
+  }
+  column->validity.write(reinterpret_cast<const char*>(column->scratch.data()),
+                         static_cast<std::streamsize>(column->scratch.size()));
+  if (!column->validity) {
+    return arrow::Status::IOError("Error writing ", directory_, "/",
+                                  column->field->name(), ".validity");
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status ColumnarRawSink::Close() {
+  if (closed_) {
+    return arrow::Status::OK();
+  }
+  closed_ = true;
+  for (auto& column : columns_) {
+    if (column->pending_count > 0) {
+      column->validity.put(static_cast<char>(column->pending_bits));
+      column->pending_count = 0;
+    }
+    for (std::ofstream* file :
+         {&column->data, &column->offsets, &column->validity}) {
+      if (!file->is_open()) {
+        continue;
+      }
+      file->close();
+      if (file->fail()) {
+        return arrow::Status::IOError("Error closing output for column ",
+                                      column->field->name(), " in ",
+                                      directory_);
+      }
+    }
+  }
+  return WriteHeader();
+}
+
+arrow::Status ColumnarRawSink::WriteHeader() const {
+  const std::string path =
+      (std::filesystem::path(directory_) / "schema.json").string();
+  std::ofstream out(path, std::ios::out | std::ios::trunc);
+  if (!out) {
+    return arrow::Status::IOError("Failed to open output file: ", path);
+  }
+  out << "{\n";
+  out << "  \"format\": \"benchgen-columnar-raw\",\n";
+  out << "  \"version\": 1,\n";
+  out << "  \"byte_order\": \"little\",\n";
+  out << "  \"num_rows\": " << rows_ << ",\n";
+  out << "  \"columns\": [\n";
+  for (size_t i = 0; i < columns_.size(); ++i) {
+    const Column& column = *columns_[i];
+    const std::string& name = column.field->name();
+    out << (i > 0 ? ",\n" : "") << "    {\"name\": ";
+    WriteJsonString(&out, name);
+    out << ", \"type\": ";
+    WriteJsonString(&out, column.field->type()->ToString());
+    out << ", \"nullable\": " << (column.field->nullable() ? "true" : "false");
+    if (column.kind == ColumnKind::kString) {
+      out << ", \"offsets\": ";
+      WriteJsonString(&out, name + ".offsets");
+    } else {
+      out << ", \"byte_width\": " << column.byte_width;
+    }
+    out << ", \"data\": ";
+    WriteJsonString(&out, name + ".data");
+    if (column.field->nullable()) {
+      out << ", \"validity\": ";
+      WriteJsonString(&out, name + ".validity");
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+  out.close();
+  if (out.fail()) {
+    return arrow::Status::IOError("Error writing ", path);
+  }
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,68 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/record_batch_sink.h"
+
+namespace benchgen::internal {
+
+// Writes each column to its own raw little-endian files under a directory,
+// laid out so a loader can mmap them and adopt the bytes as Arrow buffers:
+//
+//   <column>.data      fixed-width values (ints, decimals, dates, floats;
+//                      booleans as one byte each), or string bytes
+//   <column>.offsets   strings only: num_rows + 1 int64 offsets into
+//                      .data, as in Arrow's large_utf8 layout
+//   <column>.validity  nullable columns only: LSB-first validity bitmap
+//   schema.json        row count, Arrow types and the files of each column
+//
+// Open refuses a directory that is not empty and schema.json is written by
+// Close, so its presence marks a complete dump.
+class ColumnarRawSink final : public RecordBatchSink {
+ public:
+  static arrow::Status Open(const std::string& directory,
+                            const std::shared_ptr<arrow::Schema>& schema,
+                            std::unique_ptr<ColumnarRawSink>* out);
+  ~ColumnarRawSink() override;
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+  int64_t rows() const { return rows_; }
+
+ private:
+  struct Column;
+
+  ColumnarRawSink(std::string directory,
+                  std::shared_ptr<arrow::Schema> schema);
+
+  arrow::Status WriteColumn(const arrow::Array& array, Column* column);
+  arrow::Status WriteHeader() const;
+
+  std::string directory_;
+  std::shared_ptr<arrow::Schema> schema_;
+  std::vector<std::unique_ptr<Column>> columns_;
+  int64_t rows_ = 0;
+  bool closed_ = false;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,122 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/fan_out_sink.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "util/trace.h"
+
+namespace benchgen::internal {
+
+FanOutSink::FanOutSink(std::vector<std::unique_ptr<RecordBatchSink>> sinks,
+                       int64_t queue_depth)
+    : queue_depth_(static_cast<size_t>(std::max<int64_t>(queue_depth, 1))),
+      lanes_(sinks.size()) {
+  for (size_t i = 0; i < sinks.size(); ++i) {
+    lanes_[i].sink = std::move(sinks[i]);
+  }
+  for (auto& lane : lanes_) {
+    lane.thread = std::thread(&FanOutSink::Drain, this, &lane);
+  }
+}
+
+FanOutSink::~FanOutSink() {
+  if (!closed_) {
+    (void)Close();
+  }
+}
+
+void FanOutSink::Drain(Lane* lane) {
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_.wait(lock,
+                      [&] { return !lane->queue.empty() || closing_; });
+      if (lane->queue.empty()) {
+        break;
+      }
+      batch = std::move(lane->queue.front());
+      lane->queue.pop_front();
+      not_full_.notify_all();
+      if (!lane->status.ok()) {
+        continue;
+      }
+    }
+    arrow::Status status = lane->sink->Write(batch);
+    if (!status.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      lane->status = std::move(status);
+    }
+  }
+  arrow::Status status = lane->sink->Close();
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (lane->status.ok()) {
+    lane->status = std::move(status);
+  }
+}
+
+arrow::Status FanOutSink::FirstError() const {
+  for (const auto& lane : lanes_) {
+    if (!lane.status.ok()) {
+      return lane.status;
+    }
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status FanOutSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (closing_) {
+    return arrow::Status::Invalid("FanOutSink is closed");
+  }
+  auto has_room = [&] {
+    return std::all_of(lanes_.begin(), lanes_.end(), [&](const Lane& lane) {
+      return lane.queue.size() < queue_depth_;
+    });
+  };
+  if (!has_room()) {
+    TraceSpan span("wait sink queue", "write");
+    not_full_.wait(lock, has_room);
+  }
+  ARROW_RETURN_NOT_OK(FirstError());
+  for (auto& lane : lanes_) {
+    lane.queue.push_back(batch);
+  }
+  not_empty_.notify_all();
+  return arrow::Status::OK();
+}
+
+arrow::Status FanOutSink::Close() {
+  if (closed_) {
+    return arrow::Status::OK();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closing_ = true;
+  }
+  not_empty_.notify_all();
+  for (auto& lane : lanes_) {
+    if (lane.thread.joinable()) {
+      lane.thread.join();
+    }
+  }
+  closed_ = true;
+  return FirstError();
+}
+
+}  // namespace benchgen::internal
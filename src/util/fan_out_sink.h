@@ -0,0 +1,72 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/record_batch_sink.h"
+
+namespace benchgen::internal {
+
+// Delivers every batch to several sinks, so one generation pass can feed
+// e.g. a text file, an Arrow file and a checksum. Each sink is drained by
+// its own thread through a bounded queue: sinks format and write in
+// parallel with each other and with generation, and batches are shared,
+// not copied. Write blocks while any queue holds queue_depth batches.
+//
+// A failing sink stops receiving batches; its error is returned by the
+// next Write or by Close. Close drains the queues, closes every sink and
+// returns the first error.
+class FanOutSink final : public RecordBatchSink {
+ public:
+  FanOutSink(std::vector<std::unique_ptr<RecordBatchSink>> sinks,
+             int64_t queue_depth);
+  ~FanOutSink() override;
+
+  FanOutSink(const FanOutSink&) = delete;
+  FanOutSink& operator=(const FanOutSink&) = delete;
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+ private:
+  struct Lane {
+    std::unique_ptr<RecordBatchSink> sink;
+    std::deque<std::shared_ptr<arrow::RecordBatch>> queue;
+    arrow::Status status;
+    std::thread thread;
+  };
+
+  void Drain(Lane* lane);
+  arrow::Status FirstError() const;
+
+  const size_t queue_depth_;
+  std::vector<Lane> lanes_;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  bool closing_ = false;
+  bool closed_ = false;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,412 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/generation_manifest.h"
+
+#include <arrow/util/crc32.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+
+#include "util/json.h"
+
+namespace benchgen::internal {
+namespace {
+
+namespace fs = std::filesystem;
+
+std::string FormatCrc32(uint32_t crc) {
+  char buf[9];
+  std::snprintf(buf, sizeof(buf), "%08x", crc);
+  return buf;
+}
+
+std::string FormatDouble(double value) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.17g", value);
+  return buf;
+}
+
+fs::path ManifestDirectory(const std::string& manifest_path) {
+  return fs::absolute(fs::path(manifest_path)).lexically_normal().parent_path();
+}
+
+std::string ToManifestRelative(const std::string& file,
+                               const fs::path& manifest_dir) {
+  fs::path absolute = fs::absolute(fs::path(file)).lexically_normal();
+  fs::path relative = absolute.lexically_relative(manifest_dir);
+  return relative.empty() ? absolute.generic_string()
+                          : relative.generic_string();
+}
+
+std::string FromManifestRelative(const std::string& stored,
+                                 const std::string& manifest_path) {
+  fs::path path(stored);
+  if (path.is_absolute()) {
+    return path.string();
+  }
+  return (fs::path(manifest_path).parent_path() / path)
+      .lexically_normal()
+      .string();
+}
+
+arrow::Status MissingField(const std::string& path, const char* field) {
+  return arrow::Status::Invalid("Manifest ", path, ": missing or invalid \"",
+                                field, "\"");
+}
+
+arrow::Status GetInt(const JsonValue& object, const char* key,
+                     const std::string& path, int64_t* out) {
+  const JsonValue* value = object.Find(key);
+  if (value == nullptr || value->type != JsonValue::Type::kNumber ||
+      !value->is_integer) {
+    return MissingField(path, key);
+  }
+  *out = value->int_value;
+  return arrow::Status::OK();
+}
+
+arrow::Status GetString(const JsonValue& object, const char* key,
+                        const std::string& path, std::string* out) {
+  const JsonValue* value = object.Find(key);
+  if (value == nullptr || value->type != JsonValue::Type::kString) {
+    return MissingField(path, key);
+  }
+  *out = value->string_value;
+  return arrow::Status::OK();
+}
+
+arrow::Status GetArray(const JsonValue& object, const char* key,
+                       const std::string& path,
+                       const std::vector<JsonValue>** out) {
+  const JsonValue* value = object.Find(key);
+  if (value == nullptr || value->type != JsonValue::Type::kArray) {
+    return MissingField(path, key);
+  }
+  *out = &value->array_value;
+  return arrow::Status::OK();
+}
+
+std::string DescribeManifest(const GenerationManifest& manifest) {
+  return "node " + std::to_string(manifest.node_index);
+}
+
+// Orders ranges by start row, with open-ended ranges after bounded ones
+// that start at the same row.
+bool RangeStartsBefore(int64_t lhs_start, int64_t lhs_count,
+                       int64_t rhs_start, int64_t rhs_count) {
+  if (lhs_start != rhs_start) {
+    return lhs_start < rhs_start;
+  }
+  return (lhs_count < 0 ? INT64_MAX : lhs_count) <
+         (rhs_count < 0 ? INT64_MAX : rhs_count);
+}
+
+}  // namespace
+
+arrow::Status ChecksumFile(const std::string& path, int64_t* bytes,
+                           uint32_t* crc32) {
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (!in) {
+    return arrow::Status::IOError("Failed to open file: ", path);
+  }
+  std::vector<char> buffer(1 << 20);
+  int64_t total = 0;
+  uint32_t crc = 0;
+  while (in) {
+    in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    std::streamsize got = in.gcount();
+    if (got <= 0) {
+      break;
+    }
+    crc = arrow::internal::crc32(crc, buffer.data(), static_cast<size_t>(got));
+    total += got;
+  }
+  if (in.bad()) {
+    return arrow::Status::IOError("Failed to read file: ", path);
+  }
+  *bytes = total;
+  *crc32 = crc;
+  return arrow::Status::OK();
+}
+
+arrow::Status WriteGenerationManifest(const std::string& path,
+                                      const GenerationManifest& manifest) {
+  const fs::path manifest_dir = ManifestDirectory(path);
+  const std::string temp_path = path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::out | std::ios::trunc);
+    if (!out) {
+      return arrow::Status::IOError("Failed to open manifest: ", temp_path);
+    }
+    out << "{\n  \"benchmark\": ";
+    WriteJsonString(&out, manifest.benchmark);
+    out << ",\n  \"table\": ";
+    WriteJsonString(&out, manifest.table);
+    out << ",\n  \"scale_factor\": " << FormatDouble(manifest.scale_factor)
+        << ",\n  \"node_index\": " << manifest.node_index
+        << ",\n  \"node_count\": " << manifest.node_count
+        << ",\n  \"total_rows\": " << manifest.total_rows
+        << ",\n  \"table_start_row\": " << manifest.table_start_row
+        << ",\n  \"table_row_count\": " << manifest.table_row_count
+        << ",\n  \"ranges\": [";
+    for (size_t r = 0; r < manifest.ranges.size(); ++r) {
+      const ManifestRange& range = manifest.ranges[r];
+      out << (r == 0 ? "\n" : ",\n") << "    {\"start_row\": "
+          << range.start_row << ", \"row_count\": " << range.row_count
+          << ", \"files\": [";
+      for (size_t f = 0; f < range.files.size(); ++f) {
+        const ManifestFile& file = range.files[f];
+        out << (f == 0 ? "\n" : ",\n") << "      {\"path\": ";
+        WriteJsonString(&out, ToManifestRelative(file.path, manifest_dir));
+        out << ", \"first_row\": " << file.first_row
+            << ", \"row_count\": " << file.row_count
+            << ", \"bytes\": " << file.bytes << ", \"crc32\": \""
+            << FormatCrc32(file.crc32) << "\"}";
+      }
+      out << (range.files.empty() ? "]}" : "\n    ]}");
+    }
+    out << (manifest.ranges.empty() ? "]\n" : "\n  ]\n") << "}\n";
+    if (!out) {
+      return arrow::Status::IOError("Failed to write manifest: ", temp_path);
+    }
+  }
+  std::error_code ec;
+  fs::rename(temp_path, path, ec);
+  if (ec) {
+    return arrow::Status::IOError("Failed to publish manifest ", path, ": ",
+                                  ec.message());
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status ReadGenerationManifest(const std::string& path,
+                                     GenerationManifest* manifest) {
+  if (manifest == nullptr) {
+    return arrow::Status::Invalid("Manifest output must not be null");
+  }
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  if (!in) {
+    return arrow::Status::IOError("Failed to open manifest: ", path);
+  }
+  std::ostringstream text;
+  text << in.rdbuf();
+  JsonValue root;
+  auto status = ParseJson(text.str(), &root);
+  if (!status.ok()) {
+    return arrow::Status::Invalid("Manifest ", path, ": ", status.message());
+  }
+  if (root.type != JsonValue::Type::kObject) {
+    return arrow::Status::Invalid("Manifest ", path, ": not a JSON object");
+  }
+
+  GenerationManifest result;
+  ARROW_RETURN_NOT_OK(GetString(root, "benchmark", path, &result.benchmark));
+  ARROW_RETURN_NOT_OK(GetString(root, "table", path, &result.table));
+  const JsonValue* scale = root.Find("scale_factor");
+  if (scale == nullptr || scale->type != JsonValue::Type::kNumber) {
+    return MissingField(path, "scale_factor");
+  }
+  result.scale_factor = scale->number_value;
+  ARROW_RETURN_NOT_OK(GetInt(root, "node_index", path, &result.node_index));
+  ARROW_RETURN_NOT_OK(GetInt(root, "node_count", path, &result.node_count));
+  ARROW_RETURN_NOT_OK(GetInt(root, "total_rows", path, &result.total_rows));
+  ARROW_RETURN_NOT_OK(
+      GetInt(root, "table_start_row", path, &result.table_start_row));
+  ARROW_RETURN_NOT_OK(
+      GetInt(root, "table_row_count", path, &result.table_row_count));
+
+  const std::vector<JsonValue>* ranges = nullptr;
+  ARROW_RETURN_NOT_OK(GetArray(root, "ranges", path, &ranges));
+  for (const JsonValue& range_value : *ranges) {
+    ManifestRange range;
+    ARROW_RETURN_NOT_OK(
+        GetInt(range_value, "start_row", path, &range.start_row));
+    ARROW_RETURN_NOT_OK(
+        GetInt(range_value, "row_count", path, &range.row_count));
+    const std::vector<JsonValue>* files = nullptr;
+    ARROW_RETURN_NOT_OK(GetArray(range_value, "files", path, &files));
+    for (const JsonValue& file_value : *files) {
+      ManifestFile file;
+      std::string stored_path;
+      ARROW_RETURN_NOT_OK(GetString(file_value, "path", path, &stored_path));
+      file.path = FromManifestRelative(stored_path, path);
+      ARROW_RETURN_NOT_OK(
+          GetInt(file_value, "first_row", path, &file.first_row));
+      ARROW_RETURN_NOT_OK(
+          GetInt(file_value, "row_count", path, &file.row_count));
+      ARROW_RETURN_NOT_OK(GetInt(file_value, "bytes", path, &file.bytes));
+      std::string crc;
+      ARROW_RETURN_NOT_OK(GetString(file_value, "crc32", path, &crc));
+      char* end = nullptr;
+      unsigned long parsed = std::strtoul(crc.c_str(), &end, 16);
+      if (crc.empty() || crc.size() > 8 || end != crc.c_str() + crc.size()) {
+        return MissingField(path, "crc32");
+      }
+      file.crc32 = static_cast<uint32_t>(parsed);
+      range.files.push_back(std::move(file));
+    }
+    result.ranges.push_back(std::move(range));
+  }
+  *manifest = std::move(result);
+  return arrow::Status::OK();
+}
+
+arrow::Status VerifyManifestCoverage(
+    const std::vector<GenerationManifest>& manifests) {
+  if (manifests.empty()) {
+    return arrow::Status::Invalid("No manifests to verify");
+  }
+  const GenerationManifest& first = manifests.front();
+  if (first.node_count != static_cast<int64_t>(manifests.size())) {
+    return arrow::Status::Invalid("Expected ", first.node_count,
+                                  " node manifests, got ", manifests.size());
+  }
+  std::vector<bool> seen(manifests.size(), false);
+  for (const GenerationManifest& manifest : manifests) {
+    if (manifest.benchmark != first.benchmark ||
+        manifest.table != first.table ||
+        manifest.scale_factor != first.scale_factor ||
+        manifest.node_count != first.node_count ||
+        manifest.total_rows != first.total_rows ||
+        manifest.table_start_row != first.table_start_row ||
+        manifest.table_row_count != first.table_row_count) {
+      return arrow::Status::Invalid(
+          DescribeManifest(manifest),
+          " was generated with different table, scale or split settings "
+          "than node ",
+          first.node_index);
+    }
+    if (manifest.node_index < 0 || manifest.node_index >= first.node_count) {
+      return arrow::Status::Invalid("Node index ", manifest.node_index,
+                                    " is outside [0, ", first.node_count,
+                                    ")");
+    }
+    if (seen[static_cast<size_t>(manifest.node_index)]) {
+      return arrow::Status::Invalid("Duplicate manifest for ",
+                                    DescribeManifest(manifest));
+    }
+    seen[static_cast<size_t>(manifest.node_index)] = true;
+  }
+
+  struct Entry {
+    int64_t start_row;
+    int64_t row_count;
+    int64_t node_index;
+  };
+  std::vector<Entry> entries;
+  for (const GenerationManifest& manifest : manifests) {
+    for (const ManifestRange& range : manifest.ranges) {
+      if (range.start_row < 0 || range.row_count < -1) {
+        return arrow::Status::Invalid(DescribeManifest(manifest),
+                                      " has an invalid range starting at ",
+                                      range.start_row);
+      }
+      entries.push_back({range.start_row, range.row_count,
+                         manifest.node_index});
+    }
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry& lhs, const Entry& rhs) {
+              return RangeStartsBefore(lhs.start_row, lhs.row_count,
+                                       rhs.start_row, rhs.row_count);
+            });
+
+  int64_t cursor = first.table_start_row;
+  bool open_ended = false;
+  for (const Entry& entry : entries) {
+    if (open_ended) {
+      return arrow::Status::Invalid(
+          "Rows from ", entry.start_row, " (node ", entry.node_index,
+          ") are also covered by an open-ended range");
+    }
+    if (entry.start_row > cursor) {
+      return arrow::Status::Invalid("Rows [", cursor, ", ", entry.start_row,
+                                    ") are not covered by any node");
+    }
+    if (entry.start_row < cursor) {
+      return arrow::Status::Invalid("Rows [", entry.start_row, ", ", cursor,
+                                    ") are covered more than once (node ",
+                                    entry.node_index, ")");
+    }
+    if (entry.row_count < 0) {
+      open_ended = true;
+    } else {
+      cursor += entry.row_count;
+    }
+  }
+
+  if (first.table_row_count >= 0) {
+    const int64_t end = first.table_start_row + first.table_row_count;
+    if (open_ended || cursor != end) {
+      return arrow::Status::Invalid("Ranges end at ",
+                                    open_ended ? std::string("end of table")
+                                               : std::to_string(cursor),
+                                    ", expected ", end);
+    }
+  } else if (!open_ended &&
+             (first.total_rows < 0 || cursor < first.total_rows)) {
+    return arrow::Status::Invalid("Rows from ", cursor,
+                                  " to the end of the table are not covered");
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status VerifyManifestFiles(const GenerationManifest& manifest) {
+  for (const ManifestRange& range : manifest.ranges) {
+    for (const ManifestFile& file : range.files) {
+      int64_t bytes = 0;
+      uint32_t crc = 0;
+      ARROW_RETURN_NOT_OK(ChecksumFile(file.path, &bytes, &crc));
+      if (bytes != file.bytes || crc != file.crc32) {
+        return arrow::Status::Invalid(
+            "File ", file.path, " does not match ",
+            DescribeManifest(manifest), "'s manifest (", bytes, " bytes, crc32 ",
+            FormatCrc32(crc), "; expected ", file.bytes, " bytes, crc32 ",
+            FormatCrc32(file.crc32), ")");
+      }
+    }
+  }
+  return arrow::Status::OK();
+}
+
+GenerationManifest MergeManifests(
+    const std::vector<GenerationManifest>& manifests) {
+  GenerationManifest merged;
+  if (manifests.empty()) {
+    return merged;
+  }
+  merged = manifests.front();
+  merged.node_index = 0;
+  merged.node_count = 1;
+  merged.ranges.clear();
+  for (const GenerationManifest& manifest : manifests) {
+    merged.ranges.insert(merged.ranges.end(), manifest.ranges.begin(),
+                         manifest.ranges.end());
+  }
+  std::stable_sort(merged.ranges.begin(), merged.ranges.end(),
+                   [](const ManifestRange& lhs, const ManifestRange& rhs) {
+                     return RangeStartsBefore(lhs.start_row, lhs.row_count,
+                                              rhs.start_row, rhs.row_count);
+                   });
+  return merged;
+}
+
+}  // namespace benchgen::internal
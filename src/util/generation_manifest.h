@@ -0,0 +1,85 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+// One output file. first_row/row_count count emitted rows, so they only
+// match table rows when no sampling is applied.
+struct ManifestFile {
+  std::string path;
+  int64_t first_row = 0;
+  int64_t row_count = 0;
+  int64_t bytes = 0;
+  uint32_t crc32 = 0;  // zlib CRC-32 of the file contents
+};
+
+// A contiguous table row range generated by one worker. row_count -1 means
+// "to the end of the table": the last range of a split uses it so that
+// tables whose total is interpolated (lineitem, lineorder) are not cut
+// short.
+struct ManifestRange {
+  int64_t start_row = 0;
+  int64_t row_count = 0;
+  std::vector<ManifestFile> files;
+};
+
+// What one node generated. table_start_row/table_row_count is the row
+// window that was split across node_count nodes, and total_rows the
+// suite's row count for the table (-1 if unknown).
+struct GenerationManifest {
+  std::string benchmark;
+  std::string table;
+  double scale_factor = 1.0;
+  int64_t node_index = 0;
+  int64_t node_count = 1;
+  int64_t total_rows = -1;
+  int64_t table_start_row = 0;
+  int64_t table_row_count = -1;
+  std::vector<ManifestRange> ranges;
+};
+
+// Computes the byte size and zlib CRC-32 of a file.
+arrow::Status ChecksumFile(const std::string& path, int64_t* bytes,
+                           uint32_t* crc32);
+
+// File paths in memory are usable from the working directory; on disk
+// they are stored relative to the manifest's directory, so a manifest can
+// be moved together with its data.
+arrow::Status WriteGenerationManifest(const std::string& path,
+                                      const GenerationManifest& manifest);
+arrow::Status ReadGenerationManifest(const std::string& path,
+                                     GenerationManifest* manifest);
+
+// Checks that the manifests describe the same table and split, come from
+// nodes 0..node_count-1 exactly once, and that their ranges tile the
+// table window with no gap or overlap.
+arrow::Status VerifyManifestCoverage(
+    const std::vector<GenerationManifest>& manifests);
+
+// Recomputes size and checksum of every file listed in the manifest.
+arrow::Status VerifyManifestFiles(const GenerationManifest& manifest);
+
+// Combines verified node manifests into one single-node manifest.
+GenerationManifest MergeManifests(
+    const std::vector<GenerationManifest>& manifests);
+
+}  // namespace benchgen::internal
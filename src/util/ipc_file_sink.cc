@@ -0,0 +1,63 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/ipc_file_sink.h"
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/writer.h>
+
+#include <utility>
+
+namespace benchgen::internal {
+
+ArrowIpcFileSink::ArrowIpcFileSink(
+    std::shared_ptr<arrow::io::FileOutputStream> file,
+    std::shared_ptr<arrow::ipc::RecordBatchWriter> writer)
+    : file_(std::move(file)), writer_(std::move(writer)) {}
+
+ArrowIpcFileSink::~ArrowIpcFileSink() = default;
+
+arrow::Status ArrowIpcFileSink::Open(
+    const std::string& path, const std::shared_ptr<arrow::Schema>& schema,
+    std::unique_ptr<ArrowIpcFileSink>* out) {
+  auto file_result = arrow::io::FileOutputStream::Open(path);
+  if (!file_result.ok()) {
+    return file_result.status();
+  }
+  std::shared_ptr<arrow::io::FileOutputStream> file = *file_result;
+  auto writer_result = arrow::ipc::MakeFileWriter(file, schema);
+  if (!writer_result.ok()) {
+    (void)file->Close();
+    return writer_result.status();
+  }
+  out->reset(new ArrowIpcFileSink(std::move(file), *writer_result));
+  return arrow::Status::OK();
+}
+
+arrow::Status ArrowIpcFileSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  return writer_->WriteRecordBatch(*batch);
+}
+
+arrow::Status ArrowIpcFileSink::Close() {
+  if (closed_) {
+    return arrow::Status::OK();
+  }
+  closed_ = true;
+  arrow::Status status = writer_->Close();
+  arrow::Status file_status = file_->Close();
+  return status.ok() ? file_status : status;
+}
+
+}  // namespace benchgen::internal
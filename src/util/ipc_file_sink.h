@@ -0,0 +1,56 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "benchgen/arrow_compat.h"
+#include "util/record_batch_sink.h"
+
+namespace arrow::io {
+class FileOutputStream;
+}  // namespace arrow::io
+
+namespace arrow::ipc {
+class RecordBatchWriter;
+}  // namespace arrow::ipc
+
+namespace benchgen::internal {
+
+// Writes batches unchanged to an Arrow IPC file (Feather v2), which Arrow
+// readers load without parsing text. The file carries the schema, so an
+// empty run still produces a readable file.
+class ArrowIpcFileSink final : public RecordBatchSink {
+ public:
+  static arrow::Status Open(const std::string& path,
+                            const std::shared_ptr<arrow::Schema>& schema,
+                            std::unique_ptr<ArrowIpcFileSink>* out);
+  ~ArrowIpcFileSink() override;
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+ private:
+  ArrowIpcFileSink(std::shared_ptr<arrow::io::FileOutputStream> file,
+                   std::shared_ptr<arrow::ipc::RecordBatchWriter> writer);
+
+  std::shared_ptr<arrow::io::FileOutputStream> file_;
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer_;
+  bool closed_ = false;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,314 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/json.h"
+
+#include <cerrno>
+#include <cstdlib>
+
+namespace benchgen::internal {
+namespace {
+
+constexpr int kMaxDepth = 64;
+
+class JsonParser {
+ public:
+  explicit JsonParser(std::string_view text) : text_(text) {}
+
+  arrow::Status Parse(JsonValue* out) {
+    ARROW_RETURN_NOT_OK(ParseValue(out, 0));
+    SkipWhitespace();
+    if (pos_ != text_.size()) {
+      return Error("trailing characters");
+    }
+    return arrow::Status::OK();
+  }
+
+ private:
+  arrow::Status Error(const char* what) const {
+    return arrow::Status::Invalid("JSON parse error at offset ", pos_, ": ",
+                                  what);
+  }
+
+  void SkipWhitespace() {
+    while (pos_ < text_.size() &&
+           (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' ||
+            text_[pos_] == '\r')) {
+      ++pos_;
+    }
+  }
+
+  bool Consume(std::string_view literal) {
+    if (text_.substr(pos_, literal.size()) != literal) {
+      return false;
+    }
+    pos_ += literal.size();
+    return true;
+  }
+
+  arrow::Status ParseValue(JsonValue* out, int depth) {
+    if (depth > kMaxDepth) {
+      return Error("nesting too deep");
+    }
+    SkipWhitespace();
+    if (pos_ >= text_.size()) {
+      return Error("unexpected end of input");
+    }
+    *out = JsonValue();
+    char c = text_[pos_];
+    if (c == '{') {
+      return ParseObject(out, depth);
+    }
+    if (c == '[') {
+      return ParseArray(out, depth);
+    }
+    if (c == '"') {
+      out->type = JsonValue::Type::kString;
+      return ParseString(&out->string_value);
+    }
+    if (Consume("true")) {
+      out->type = JsonValue::Type::kBool;
+      out->bool_value = true;
+      return arrow::Status::OK();
+    }
+    if (Consume("false")) {
+      out->type = JsonValue::Type::kBool;
+      return arrow::Status::OK();
+    }
+    if (Consume("null")) {
+      return arrow::Status::OK();
+    }
+    return ParseNumber(out);
+  }
+
+  arrow::Status ParseObject(JsonValue* out, int depth) {
+    out->type = JsonValue::Type::kObject;
+    ++pos_;
+    SkipWhitespace();
+    if (Consume("}")) {
+      return arrow::Status::OK();
+    }
+    while (true) {
+      SkipWhitespace();
+      if (pos_ >= text_.size() || text_[pos_] != '"') {
+        return Error("expected object key");
+      }
+      std::string key;
+      ARROW_RETURN_NOT_OK(ParseString(&key));
+      SkipWhitespace();
+      if (!Consume(":")) {
+        return Error("expected ':'");
+      }
+      JsonValue value;
+      ARROW_RETURN_NOT_OK(ParseValue(&value, depth + 1));
+      out->object_value.emplace_back(std::move(key), std::move(value));
+      SkipWhitespace();
+      if (Consume("}")) {
+        return arrow::Status::OK();
+      }
+      if (!Consume(",")) {
+        return Error("expected ',' or '}'");
+      }
+    }
+  }
+
+  arrow::Status ParseArray(JsonValue* out, int depth) {
+    out->type = JsonValue::Type::kArray;
+    ++pos_;
+    SkipWhitespace();
+    if (Consume("]")) {
+      return arrow::Status::OK();
+    }
+    while (true) {
+      JsonValue value;
+      ARROW_RETURN_NOT_OK(ParseValue(&value, depth + 1));
+      out->array_value.push_back(std::move(value));
+      SkipWhitespace();
+      if (Consume("]")) {
+        return arrow::Status::OK();
+      }
+      if (!Consume(",")) {
+        return Error("expected ',' or ']'");
+      }
+    }
+  }
+
+  arrow::Status ParseHex4(uint32_t* out) {
+    if (pos_ + 4 > text_.size()) {
+      return Error("truncated \\u escape");
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      char c = text_[pos_++];
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= static_cast<uint32_t>(c - '0');
+      } else if (c >= 'a' && c <= 'f') {
+        value |= static_cast<uint32_t>(c - 'a' + 10);
+      } else if (c >= 'A' && c <= 'F') {
+        value |= static_cast<uint32_t>(c - 'A' + 10);
+      } else {
+        return Error("invalid \\u escape");
+      }
+    }
+    *out = value;
+    return arrow::Status::OK();
+  }
+
+  static void AppendUtf8(uint32_t code_point, std::string* out) {
+    if (code_point < 0x80) {
+      out->push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      out->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      out->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+      out->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+  }
+
+  arrow::Status ParseString(std::string* out) {
+    ++pos_;  // opening quote
+    out->clear();
+    while (pos_ < text_.size()) {
+      char c = text_[pos_++];
+      if (c == '"') {
+        return arrow::Status::OK();
+      }
+      if (static_cast<unsigned char>(c) < 0x20) {
+        return Error("control character in string");
+      }
+      if (c != '\\') {
+        out->push_back(c);
+        continue;
+      }
+      if (pos_ >= text_.size()) {
+        break;
+      }
+      char escape = text_[pos_++];
+      switch (escape) {
+        case '"':
+        case '\\':
+        case '/':
+          out->push_back(escape);
+          break;
+        case 'b':
+          out->push_back('\b');
+          break;
+        case 'f':
+          out->push_back('\f');
+          break;
+        case 'n':
+          out->push_back('\n');
+          break;
+        case 'r':
+          out->push_back('\r');
+          break;
+        case 't':
+          out->push_back('\t');
+          break;
+        case 'u': {
+          uint32_t code_point = 0;
+          ARROW_RETURN_NOT_OK(ParseHex4(&code_point));
+          if (code_point >= 0xD800 && code_point < 0xDC00 &&
+              Consume("\\u")) {
+            uint32_t low = 0;
+            ARROW_RETURN_NOT_OK(ParseHex4(&low));
+            if (low < 0xDC00 || low > 0xDFFF) {
+              return Error("invalid surrogate pair");
+            }
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) +
+                         (low - 0xDC00);
+          }
+          AppendUtf8(code_point, out);
+          break;
+        }
+        default:
+          return Error("invalid escape");
+      }
+    }
+    return Error("unterminated string");
+  }
+
+  arrow::Status ParseNumber(JsonValue* out) {
+    size_t begin = pos_;
+    bool integral = true;
+    if (pos_ < text_.size() && text_[pos_] == '-') {
+      ++pos_;
+    }
+    while (pos_ < text_.size()) {
+      char c = text_[pos_];
+      if (c >= '0' && c <= '9') {
+        ++pos_;
+      } else if (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-') {
+        integral = false;
+        ++pos_;
+      } else {
+        break;
+      }
+    }
+    if (pos_ == begin) {
+      return Error("unexpected character");
+    }
+    std::string token(text_.substr(begin, pos_ - begin));
+    char* end = nullptr;
+    errno = 0;
+    out->number_value = std::strtod(token.c_str(), &end);
+    if (end != token.c_str() + token.size()) {
+      return Error("invalid number");
+    }
+    out->type = JsonValue::Type::kNumber;
+    if (integral) {
+      errno = 0;
+      long long value = std::strtoll(token.c_str(), &end, 10);
+      if (errno == 0 && end == token.c_str() + token.size()) {
+        out->int_value = static_cast<int64_t>(value);
+        out->is_integer = true;
+      }
+    }
+    return arrow::Status::OK();
+  }
+
+  std::string_view text_;
+  size_t pos_ = 0;
+};
+
+}  // namespace
+
+const JsonValue* JsonValue::Find(std::string_view key) const {
+  if (type != Type::kObject) {
+    return nullptr;
+  }
+  for (const auto& member : object_value) {
+    if (member.first == key) {
+      return &member.second;
+    }
+  }
+  return nullptr;
+}
+
+arrow::Status ParseJson(std::string_view text, JsonValue* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("JSON output must not be null");
+  }
+  return JsonParser(text).Parse(out);
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+inline std::string EscapeJson(std::string_view input) {
+  std::string output;
+  output.reserve(input.size());
+  for (unsigned char c : input) {
+    switch (c) {
+      case '"':
+        output += "\\\"";
+        break;
+      case '\\':
+        output += "\\\\";
+        break;
+      case '\b':
+        output += "\\b";
+        break;
+      case '\f':
+        output += "\\f";
+        break;
+      case '\n':
+        output += "\\n";
+        break;
+      case '\r':
+        output += "\\r";
+        break;
+      case '\t':
+        output += "\\t";
+        break;
+      default:
+        if (c < 0x20) {
+          char buf[7];
+          std::snprintf(buf, sizeof(buf), "\\u%04x",
+                        static_cast<unsigned int>(c));
+          output += buf;
+        } else {
+          output.push_back(static_cast<char>(c));
+        }
+        break;
+    }
+  }
+  return output;
+}
+
+inline void WriteJsonString(std::ostream* out, std::string_view value) {
+  *out << "\"" << EscapeJson(value) << "\"";
+}
+
+// Minimal JSON document model for reading back the files benchgen writes
+// (manifests). Integers without a fraction or exponent keep their exact
+// int64 value in int_value.
+struct JsonValue {
+  enum class Type { kNull, kBool, kNumber, kString, kArray, kObject };
+
+  Type type = Type::kNull;
+  bool bool_value = false;
+  double number_value = 0.0;
+  int64_t int_value = 0;
+  bool is_integer = false;
+  std::string string_value;
+  std::vector<JsonValue> array_value;
+  std::vector<std::pair<std::string, JsonValue>> object_value;
+
+  // Returns the member named key, or nullptr if this is not an object or
+  // has no such member.
+  const JsonValue* Find(std::string_view key) const;
+};
+
+arrow::Status ParseJson(std::string_view text, JsonValue* out);
+
+}  // namespace benchgen::internal
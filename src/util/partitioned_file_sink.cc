@@ -0,0 +1,242 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/partitioned_file_sink.h"
+
+#include <arrow/compute/api_vector.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <sstream>
+#include <unordered_map>
+#include <utility>
+
+#include "tpcds/utils/date.h"
+
+namespace benchgen::internal {
+namespace {
+
+constexpr char kNullPartition[] = "__HIVE_DEFAULT_PARTITION__";
+
+bool NeedsEscape(char c) {
+  switch (c) {
+    case '"':
+    case '#':
+    case '%':
+    case '\'':
+    case '*':
+    case '/':
+    case ':':
+    case '=':
+    case '?':
+    case '\\':
+    case '[':
+    case ']':
+    case '^':
+    case '{':
+      return true;
+    default:
+      return static_cast<unsigned char>(c) < 0x20 || c == 0x7f;
+  }
+}
+
+std::string EscapePartitionValue(std::string_view value) {
+  std::string out;
+  out.reserve(value.size());
+  for (char c : value) {
+    if (NeedsEscape(c)) {
+      char buf[4];
+      std::snprintf(buf, sizeof(buf), "%%%02X",
+                    static_cast<unsigned char>(c));
+      out.append(buf);
+    } else {
+      out.push_back(c);
+    }
+  }
+  return out;
+}
+
+std::string FormatDate32(int32_t days_since_epoch,
+                         PartitionTransform transform) {
+  static const int kEpochJulian =
+      benchgen::tpcds::internal::Date::ToJulianDays({1970, 1, 1});
+  benchgen::tpcds::internal::Date date =
+      benchgen::tpcds::internal::Date::FromJulianDays(kEpochJulian +
+                                                      days_since_epoch);
+  char buf[16];
+  switch (transform) {
+    case PartitionTransform::kYear:
+      std::snprintf(buf, sizeof(buf), "%04d", date.year);
+      break;
+    case PartitionTransform::kMonth:
+      std::snprintf(buf, sizeof(buf), "%04d-%02d", date.year, date.month);
+      break;
+    case PartitionTransform::kIdentity:
+      std::snprintf(buf, sizeof(buf), "%04d-%02d-%02d", date.year, date.month,
+                    date.day);
+      break;
+  }
+  return buf;
+}
+
+// Returns true when rows are consecutive, so the group is a plain slice.
+bool IsContiguous(const std::vector<int64_t>& rows) {
+  return rows.back() - rows.front() + 1 == static_cast<int64_t>(rows.size());
+}
+
+}  // namespace
+
+arrow::Status PartitionSpec::Parse(std::string_view text, PartitionSpec* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("partition spec output must not be null");
+  }
+  PartitionSpec spec;
+  size_t colon = text.find(':');
+  spec.column = std::string(text.substr(0, colon));
+  if (colon != std::string_view::npos) {
+    std::string_view transform = text.substr(colon + 1);
+    if (transform == "year") {
+      spec.transform = PartitionTransform::kYear;
+    } else if (transform == "month") {
+      spec.transform = PartitionTransform::kMonth;
+    } else {
+      return arrow::Status::Invalid("Unknown partition transform: ",
+                                    std::string(transform));
+    }
+  }
+  if (spec.column.empty()) {
+    return arrow::Status::Invalid("Partition column must not be empty");
+  }
+  *out = std::move(spec);
+  return arrow::Status::OK();
+}
+
+PartitionedFileSink::PartitionedFileSink(std::string root, PartitionSpec spec,
+                                         std::string file_name,
+                                         RecordBatchWriterFormat format,
+                                         int64_t max_open_files,
+                                         int64_t max_buffered_bytes)
+    : root_(std::move(root)),
+      spec_(std::move(spec)),
+      file_name_(std::move(file_name)),
+      writer_(format),
+      files_(max_open_files, max_buffered_bytes) {}
+
+arrow::Status PartitionedFileSink::PartitionValues(
+    const arrow::Array& column, std::vector<std::string>* values) const {
+  const int64_t length = column.length();
+  values->clear();
+  values->reserve(static_cast<size_t>(length));
+  if (spec_.transform != PartitionTransform::kIdentity &&
+      column.type_id() != arrow::Type::DATE32 &&
+      column.type_id() != arrow::Type::STRING) {
+    return arrow::Status::Invalid("Partition transforms require a date "
+                                  "column; ", spec_.column, " is ",
+                                  column.type()->ToString());
+  }
+  // Text dates (TPC-H, SSB) are YYYY-MM-DD, so transforms keep a prefix.
+  size_t prefix = std::string_view::npos;
+  if (spec_.transform == PartitionTransform::kYear) {
+    prefix = 4;
+  } else if (spec_.transform == PartitionTransform::kMonth) {
+    prefix = 7;
+  }
+  for (int64_t row = 0; row < length; ++row) {
+    if (column.IsNull(row)) {
+      values->emplace_back(kNullPartition);
+      continue;
+    }
+    switch (column.type_id()) {
+      case arrow::Type::INT32:
+        values->push_back(std::to_string(
+            static_cast<const arrow::Int32Array&>(column).Value(row)));
+        break;
+      case arrow::Type::INT64:
+        values->push_back(std::to_string(
+            static_cast<const arrow::Int64Array&>(column).Value(row)));
+        break;
+      case arrow::Type::STRING:
+        values->push_back(EscapePartitionValue(
+            static_cast<const arrow::StringArray&>(column)
+                .GetView(row)
+                .substr(0, prefix)));
+        break;
+      case arrow::Type::DATE32:
+        values->push_back(FormatDate32(
+            static_cast<const arrow::Date32Array&>(column).Value(row),
+            spec_.transform));
+        break;
+      default:
+        return arrow::Status::NotImplemented(
+            "Unsupported partition column type: ", column.type()->ToString());
+    }
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status PartitionedFileSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  if (!batch) {
+    return arrow::Status::Invalid("record batch must not be null");
+  }
+  int column_index = batch->schema()->GetFieldIndex(spec_.column);
+  if (column_index < 0) {
+    return arrow::Status::Invalid("Partition column not found: ",
+                                  spec_.column);
+  }
+
+  std::vector<std::string> values;
+  ARROW_RETURN_NOT_OK(PartitionValues(*batch->column(column_index), &values));
+
+  // Group rows by partition, keeping first-seen order.
+  std::unordered_map<std::string_view, size_t> group_index;
+  std::vector<std::pair<std::string_view, std::vector<int64_t>>> groups;
+  for (int64_t row = 0; row < batch->num_rows(); ++row) {
+    std::string_view value = values[static_cast<size_t>(row)];
+    auto [it, inserted] = group_index.try_emplace(value, groups.size());
+    if (inserted) {
+      groups.emplace_back(value, std::vector<int64_t>());
+    }
+    groups[it->second].second.push_back(row);
+  }
+
+  std::ostringstream rendered;
+  for (const auto& [value, rows] : groups) {
+    std::shared_ptr<arrow::RecordBatch> part;
+    if (rows.size() == static_cast<size_t>(batch->num_rows())) {
+      part = batch;
+    } else if (IsContiguous(rows)) {
+      part = batch->Slice(rows.front(), static_cast<int64_t>(rows.size()));
+    } else {
+      arrow::Int64Builder builder;
+      ARROW_RETURN_NOT_OK(builder.AppendValues(rows));
+      ARROW_ASSIGN_OR_RAISE(auto indices, builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(arrow::Datum taken,
+                            arrow::compute::Take(batch, indices));
+      part = taken.record_batch();
+    }
+
+    rendered.str(std::string());
+    ARROW_RETURN_NOT_OK(writer_.Write(&rendered, part));
+    std::filesystem::path path = std::filesystem::path(root_) /
+                                 (spec_.column + "=" + std::string(value)) /
+                                 file_name_;
+    ARROW_RETURN_NOT_OK(files_.Append(path.string(), rendered.str()));
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status PartitionedFileSink::Close() { return files_.Close(); }
+
+}  // namespace benchgen::internal
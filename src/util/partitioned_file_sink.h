@@ -0,0 +1,71 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/buffered_file_set.h"
+#include "util/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::internal {
+
+enum class PartitionTransform {
+  kIdentity,
+  // Date columns only: date32, or YYYY-MM-DD strings.
+  kYear,
+  kMonth,
+};
+
+struct PartitionSpec {
+  std::string column;
+  PartitionTransform transform = PartitionTransform::kIdentity;
+
+  // Parses "column", "column:year" or "column:month".
+  static arrow::Status Parse(std::string_view text, PartitionSpec* out);
+};
+
+// Routes the rows of each batch into Hive-style
+// <root>/<column>=<value>/<file_name> files. Values are rendered like the
+// text output (dates as YYYY-MM-DD, or YYYY / YYYY-MM with a transform),
+// nulls go to __HIVE_DEFAULT_PARTITION__ and path-unsafe characters are
+// %XX-escaped.
+class PartitionedFileSink final : public RecordBatchSink {
+ public:
+  PartitionedFileSink(std::string root, PartitionSpec spec,
+                      std::string file_name, RecordBatchWriterFormat format,
+                      int64_t max_open_files, int64_t max_buffered_bytes);
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+ private:
+  arrow::Status PartitionValues(const arrow::Array& column,
+                                std::vector<std::string>* values) const;
+
+  std::string root_;
+  PartitionSpec spec_;
+  std::string file_name_;
+  RecordBatchWriter writer_;
+  BufferedFileSet files_;
+};
+
+}  // namespace benchgen::internal
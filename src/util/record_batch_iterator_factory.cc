@@ -14,11 +14,15 @@
 
 #include "benchgen/record_batch_iterator_factory.h"
 
+#include <cstdint>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "benchgen/benchmark_suite.h"
 #include "ssb/generators/customer_generator.h"
 #include "ssb/generators/date_generator.h"
+#include "ssb/generators/lineorder_flat_generator.h"
 #include "ssb/generators/lineorder_generator.h"
 #include "ssb/generators/part_generator.h"
 #include "ssb/generators/supplier_generator.h"
@@ -36,6 +40,17 @@
 #include "tpcds/generators/item_generator.h"
 #include "tpcds/generators/promotion_generator.h"
 #include "tpcds/generators/reason_generator.h"
+#include "tpcds/generators/refresh_delete_generator.h"
+#include "tpcds/generators/s_catalog_order_generator.h"
+#include "tpcds/generators/s_catalog_order_lineitem_generator.h"
+#include "tpcds/generators/s_catalog_returns_generator.h"
+#include "tpcds/generators/s_inventory_generator.h"
+#include "tpcds/generators/s_purchase_generator.h"
+#include "tpcds/generators/s_purchase_lineitem_generator.h"
+#include "tpcds/generators/s_store_returns_generator.h"
+#include "tpcds/generators/s_web_order_generator.h"
+#include "tpcds/generators/s_web_order_lineitem_generator.h"
+#include "tpcds/generators/s_web_returns_generator.h"
 #include "tpcds/generators/ship_mode_generator.h"
 #include "tpcds/generators/store_generator.h"
 #include "tpcds/generators/store_returns_generator.h"
@@ -46,74 +61,75 @@
 #include "tpcds/generators/web_returns_generator.h"
 #include "tpcds/generators/web_sales_generator.h"
 #include "tpcds/generators/web_site_generator.h"
+#include "tpcds/utils/column_profiler.h"
 #include "tpch/generators/customer_generator.h"
 #include "tpch/generators/lineitem_generator.h"
 #include "tpch/generators/nation_generator.h"
 #include "tpch/generators/orders_generator.h"
 #include "tpch/generators/part_generator.h"
+#include "tpch/generators/part_partsupp_generator.h"
 #include "tpch/generators/partsupp_generator.h"
+#include "tpch/generators/refresh_delete_generator.h"
 #include "tpch/generators/region_generator.h"
 #include "tpch/generators/supplier_generator.h"
+#include "util/column_selection.h"
+#include "util/sampled_record_batch_iterator.h"
 
 namespace benchgen {
 namespace {
 
+// Generators construct with only their schema; Init does the data
+// dependent setup (distributions, permutations, row counts, the skip to
+// start_row). Schema lookups leave it out.
+template <typename Generator>
+arrow::Status AdoptGenerator(std::unique_ptr<Generator> iter, bool init,
+                             std::unique_ptr<RecordBatchIterator>* out) {
+  if (init) {
+    ARROW_RETURN_NOT_OK(iter->Init());
+  }
+  *out = std::move(iter);
+  return arrow::Status::OK();
+}
+
 arrow::Status MakeTpchRecordBatchIterator(
-    tpch::TableId table, GeneratorOptions options,
+    tpch::TableId table, GeneratorOptions options, bool init,
     std::unique_ptr<RecordBatchIterator>* out) {
   if (out == nullptr) {
     return arrow::Status::Invalid("out iterator must not be null");
   }
 
   switch (table) {
-    case tpch::TableId::kPart: {
-      auto iter = std::make_unique<tpch::PartGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kPartSupp: {
-      auto iter = std::make_unique<tpch::PartSuppGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kSupplier: {
-      auto iter = std::make_unique<tpch::SupplierGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kCustomer: {
-      auto iter = std::make_unique<tpch::CustomerGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kOrders: {
-      auto iter = std::make_unique<tpch::OrdersGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kLineItem: {
-      auto iter = std::make_unique<tpch::LineItemGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kNation: {
-      auto iter = std::make_unique<tpch::NationGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpch::TableId::kRegion: {
-      auto iter = std::make_unique<tpch::RegionGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
+    case tpch::TableId::kPart:
+      return AdoptGenerator(
+          std::make_unique<tpch::PartGenerator>(std::move(options)), init, out);
+    case tpch::TableId::kPartSupp:
+      return AdoptGenerator(
+          std::make_unique<tpch::PartSuppGenerator>(std::move(options)),
+          init, out);
+    case tpch::TableId::kSupplier:
+      return AdoptGenerator(
+          std::make_unique<tpch::SupplierGenerator>(std::move(options)),
+          init, out);
+    case tpch::TableId::kCustomer:
+      return AdoptGenerator(
+          std::make_unique<tpch::CustomerGenerator>(std::move(options)),
+          init, out);
+    case tpch::TableId::kOrders:
+      return AdoptGenerator(
+          std::make_unique<tpch::OrdersGenerator>(std::move(options)),
+          init, out);
+    case tpch::TableId::kLineItem:
+      return AdoptGenerator(
+          std::make_unique<tpch::LineItemGenerator>(std::move(options)),
+          init, out);
+    case tpch::TableId::kNation:
+      return AdoptGenerator(
+          std::make_unique<tpch::NationGenerator>(std::move(options)),
+          init, out);
+    case tpch::TableId::kRegion:
+      return AdoptGenerator(
+          std::make_unique<tpch::RegionGenerator>(std::move(options)),
+          init, out);
     case tpch::TableId::kTableCount:
       break;
   }
@@ -122,159 +138,111 @@ arrow::Status MakeTpchRecordBatchIterator(
 }
 
 arrow::Status MakeTpcdsRecordBatchIterator(
-    tpcds::TableId table, GeneratorOptions options,
+    tpcds::TableId table, GeneratorOptions options, bool init,
     std::unique_ptr<RecordBatchIterator>* out) {
   if (out == nullptr) {
     return arrow::Status::Invalid("out iterator must not be null");
   }
 
   switch (table) {
-    case tpcds::TableId::kCustomer: {
-      auto iter =
-          std::make_unique<tpcds::CustomerGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kCustomerAddress: {
-      auto iter =
-          std::make_unique<tpcds::CustomerAddressGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kCustomerDemographics: {
-      auto iter = std::make_unique<tpcds::CustomerDemographicsGenerator>(
-          std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kDateDim: {
-      auto iter = std::make_unique<tpcds::DateDimGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kCallCenter: {
-      auto iter =
-          std::make_unique<tpcds::CallCenterGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kCatalogPage: {
-      auto iter =
-          std::make_unique<tpcds::CatalogPageGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kCatalogReturns: {
-      auto iter =
-          std::make_unique<tpcds::CatalogReturnsGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kCatalogSales: {
-      auto iter =
-          std::make_unique<tpcds::CatalogSalesGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kHouseholdDemographics: {
-      auto iter = std::make_unique<tpcds::HouseholdDemographicsGenerator>(
-          std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kTimeDim: {
-      auto iter = std::make_unique<tpcds::TimeDimGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kIncomeBand: {
-      auto iter =
-          std::make_unique<tpcds::IncomeBandGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kReason: {
-      auto iter = std::make_unique<tpcds::ReasonGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kShipMode: {
-      auto iter =
-          std::make_unique<tpcds::ShipModeGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kInventory: {
-      auto iter =
-          std::make_unique<tpcds::InventoryGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kItem: {
-      auto iter = std::make_unique<tpcds::ItemGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kPromotion: {
-      auto iter =
-          std::make_unique<tpcds::PromotionGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kStore: {
-      auto iter = std::make_unique<tpcds::StoreGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kStoreReturns: {
-      auto iter =
-          std::make_unique<tpcds::StoreReturnsGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kStoreSales: {
-      auto iter =
-          std::make_unique<tpcds::StoreSalesGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kWarehouse: {
-      auto iter =
-          std::make_unique<tpcds::WarehouseGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kWebPage: {
-      auto iter = std::make_unique<tpcds::WebPageGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kWebReturns: {
-      auto iter =
-          std::make_unique<tpcds::WebReturnsGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kWebSales: {
-      auto iter =
-          std::make_unique<tpcds::WebSalesGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case tpcds::TableId::kWebSite: {
-      auto iter = std::make_unique<tpcds::WebSiteGenerator>(std::move(options));
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
+    case tpcds::TableId::kCustomer:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CustomerGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kCustomerAddress:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CustomerAddressGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kCustomerDemographics:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CustomerDemographicsGenerator>(
+              std::move(options)),
+          init, out);
+    case tpcds::TableId::kDateDim:
+      return AdoptGenerator(
+          std::make_unique<tpcds::DateDimGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kCallCenter:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CallCenterGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kCatalogPage:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CatalogPageGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kCatalogReturns:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CatalogReturnsGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kCatalogSales:
+      return AdoptGenerator(
+          std::make_unique<tpcds::CatalogSalesGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kHouseholdDemographics:
+      return AdoptGenerator(
+          std::make_unique<tpcds::HouseholdDemographicsGenerator>(
+              std::move(options)),
+          init, out);
+    case tpcds::TableId::kTimeDim:
+      return AdoptGenerator(
+          std::make_unique<tpcds::TimeDimGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kIncomeBand:
+      return AdoptGenerator(
+          std::make_unique<tpcds::IncomeBandGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kReason:
+      return AdoptGenerator(
+          std::make_unique<tpcds::ReasonGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kShipMode:
+      return AdoptGenerator(
+          std::make_unique<tpcds::ShipModeGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kInventory:
+      return AdoptGenerator(
+          std::make_unique<tpcds::InventoryGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kItem:
+      return AdoptGenerator(
+          std::make_unique<tpcds::ItemGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kPromotion:
+      return AdoptGenerator(
+          std::make_unique<tpcds::PromotionGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kStore:
+      return AdoptGenerator(
+          std::make_unique<tpcds::StoreGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kStoreReturns:
+      return AdoptGenerator(
+          std::make_unique<tpcds::StoreReturnsGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kStoreSales:
+      return AdoptGenerator(
+          std::make_unique<tpcds::StoreSalesGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kWarehouse:
+      return AdoptGenerator(
+          std::make_unique<tpcds::WarehouseGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kWebPage:
+      return AdoptGenerator(
+          std::make_unique<tpcds::WebPageGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kWebReturns:
+      return AdoptGenerator(
+          std::make_unique<tpcds::WebReturnsGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kWebSales:
+      return AdoptGenerator(
+          std::make_unique<tpcds::WebSalesGenerator>(std::move(options)),
+          init, out);
+    case tpcds::TableId::kWebSite:
+      return AdoptGenerator(
+          std::make_unique<tpcds::WebSiteGenerator>(std::move(options)),
+          init, out);
     case tpcds::TableId::kTableCount:
       break;
   }
@@ -292,44 +260,101 @@ arrow::Status UnsupportedSsbTable(ssb::TableId table,
       std::string(ssb::TableIdToString(table)) + " is not implemented");
 }
 
+arrow::Status MakeTpcdsRefreshRecordBatchIterator(
+    tpcds::RefreshTableId table, GeneratorOptions options, bool init,
+    std::unique_ptr<RecordBatchIterator>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out iterator must not be null");
+  }
+
+  switch (table) {
+    case tpcds::RefreshTableId::kSPurchase:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SPurchaseGenerator>(std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSPurchaseLineitem:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SPurchaseLineitemGenerator>(
+              std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSCatalogOrder:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SCatalogOrderGenerator>(std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSCatalogOrderLineitem:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SCatalogOrderLineitemGenerator>(
+              std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSWebOrder:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SWebOrderGenerator>(std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSWebOrderLineitem:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SWebOrderLineitemGenerator>(
+              std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSStoreReturns:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SStoreReturnsGenerator>(std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSCatalogReturns:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SCatalogReturnsGenerator>(
+              std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSWebReturns:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SWebReturnsGenerator>(std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kSInventory:
+      return AdoptGenerator(
+          std::make_unique<tpcds::SInventoryGenerator>(std::move(options)),
+          init, out);
+    case tpcds::RefreshTableId::kDelete:
+    case tpcds::RefreshTableId::kInventoryDelete:
+      return AdoptGenerator(
+          std::make_unique<tpcds::RefreshDeleteGenerator>(
+              std::move(options), table),
+          init, out);
+    case tpcds::RefreshTableId::kTableCount:
+      break;
+  }
+
+  return arrow::Status::Invalid("unknown refresh table id");
+}
+
 arrow::Status MakeSsbRecordBatchIterator(
-    ssb::TableId table, GeneratorOptions options,
+    ssb::TableId table, GeneratorOptions options, bool init,
     std::unique_ptr<RecordBatchIterator>* out) {
   if (out == nullptr) {
     return arrow::Status::Invalid("out iterator must not be null");
   }
 
   switch (table) {
-    case ssb::TableId::kCustomer: {
-      auto iter = std::make_unique<ssb::CustomerGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case ssb::TableId::kPart: {
-      auto iter = std::make_unique<ssb::PartGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case ssb::TableId::kSupplier: {
-      auto iter = std::make_unique<ssb::SupplierGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case ssb::TableId::kDate: {
-      auto iter = std::make_unique<ssb::DateGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
-    case ssb::TableId::kLineorder: {
-      auto iter = std::make_unique<ssb::LineorderGenerator>(std::move(options));
-      ARROW_RETURN_NOT_OK(iter->Init());
-      *out = std::move(iter);
-      return arrow::Status::OK();
-    }
+    case ssb::TableId::kCustomer:
+      return AdoptGenerator(
+          std::make_unique<ssb::CustomerGenerator>(std::move(options)),
+          init, out);
+    case ssb::TableId::kPart:
+      return AdoptGenerator(
+          std::make_unique<ssb::PartGenerator>(std::move(options)), init, out);
+    case ssb::TableId::kSupplier:
+      return AdoptGenerator(
+          std::make_unique<ssb::SupplierGenerator>(std::move(options)),
+          init, out);
+    case ssb::TableId::kDate:
+      return AdoptGenerator(
+          std::make_unique<ssb::DateGenerator>(std::move(options)), init, out);
+    case ssb::TableId::kLineorder:
+      return AdoptGenerator(
+          std::make_unique<ssb::LineorderGenerator>(std::move(options)),
+          init, out);
+    case ssb::TableId::kLineorderFlat:
+      return AdoptGenerator(
+          std::make_unique<ssb::LineorderFlatGenerator>(std::move(options)),
+          init, out);
     case ssb::TableId::kTableCount:
       break;
   }
@@ -337,33 +362,54 @@ arrow::Status MakeSsbRecordBatchIterator(
   return UnsupportedSsbTable(table, out);
 }
 
-}  // namespace
-
-arrow::Status MakeRecordBatchIterator(
+arrow::Status MakeTableRecordBatchIterator(
     SuiteId suite, std::string_view table_name, GeneratorOptions options,
-    std::unique_ptr<RecordBatchIterator>* out) {
+    bool init, std::unique_ptr<RecordBatchIterator>* out) {
   if (out == nullptr) {
     return arrow::Status::Invalid("out iterator must not be null");
   }
 
   switch (suite) {
     case SuiteId::kTpch: {
+      if (options.refresh_stream > 0 &&
+          table_name == tpch::kRefreshDeleteTableName) {
+        return AdoptGenerator(
+            std::make_unique<tpch::RefreshDeleteGenerator>(std::move(options)),
+            init, out);
+      }
       tpch::TableId table;
       if (!tpch::TableIdFromString(table_name, &table)) {
         out->reset();
         return arrow::Status::Invalid("unknown table name: " +
                                       std::string(table_name));
       }
-      return MakeTpchRecordBatchIterator(table, std::move(options), out);
+      return MakeTpchRecordBatchIterator(table, std::move(options), init,
+                                         out);
     }
     case SuiteId::kTpcds: {
+      tpcds::RefreshTableId refresh_table;
+      if (options.refresh_stream > 0 &&
+          tpcds::RefreshTableIdFromString(table_name, &refresh_table)) {
+        return MakeTpcdsRefreshRecordBatchIterator(
+            refresh_table, std::move(options), init, out);
+      }
       tpcds::TableId table;
       if (!tpcds::TableIdFromString(table_name, &table)) {
         out->reset();
         return arrow::Status::Invalid("unknown table name: " +
                                       std::string(table_name));
       }
-      return MakeTpcdsRecordBatchIterator(table, std::move(options), out);
+#ifdef BENCHGEN_TPCDS_COLUMN_PROFILE
+      return tpcds::internal::MakeColumnProfilingIterator(
+          [&](std::unique_ptr<RecordBatchIterator>* inner) {
+            return MakeTpcdsRecordBatchIterator(table, std::move(options),
+                                                init, inner);
+          },
+          out);
+#else
+      return MakeTpcdsRecordBatchIterator(table, std::move(options), init,
+                                          out);
+#endif
     }
     case SuiteId::kSsb: {
       ssb::TableId table;
@@ -372,7 +418,8 @@ arrow::Status MakeRecordBatchIterator(
         return arrow::Status::Invalid("unknown table name: " +
                                       std::string(table_name));
       }
-      return MakeSsbRecordBatchIterator(table, std::move(options), out);
+      return MakeSsbRecordBatchIterator(table, std::move(options), init,
+                                        out);
     }
     case SuiteId::kUnknown:
       break;
@@ -382,4 +429,159 @@ arrow::Status MakeRecordBatchIterator(
   return arrow::Status::Invalid("unknown suite id");
 }
 
+// Only catalog_sales takes its sold date from the order calendar;
+// store_sales and web_sales draw it through a random date join, so no
+// contiguous ticket range corresponds to a date window for them.
+arrow::Status ValidateSoldDateWindow(SuiteId suite,
+                                     std::string_view table_name,
+                                     const GeneratorOptions& options) {
+  if (options.sold_date_min_sk < 0 && options.sold_date_max_sk < 0) {
+    return arrow::Status::OK();
+  }
+  if (suite != SuiteId::kTpcds ||
+      table_name != tpcds::TableIdToString(tpcds::TableId::kCatalogSales)) {
+    return arrow::Status::Invalid(
+        "sold date ranges are only supported for tpcds catalog_sales");
+  }
+  if (options.sold_date_min_sk >= 0 && options.sold_date_max_sk >= 0 &&
+      options.sold_date_min_sk > options.sold_date_max_sk) {
+    return arrow::Status::Invalid(
+        "sold_date_min_sk must not be greater than sold_date_max_sk");
+  }
+  return arrow::Status::OK();
+}
+
+// Refresh streams only exist for the tables dbgen -U and dsdgen -update
+// write.
+arrow::Status ValidateRefreshStream(SuiteId suite, std::string_view table_name,
+                                    const GeneratorOptions& options) {
+  if (options.refresh_stream == 0) {
+    return arrow::Status::OK();
+  }
+  if (options.refresh_stream < 0) {
+    return arrow::Status::Invalid("refresh_stream must be non-negative");
+  }
+  if (suite == SuiteId::kTpcds) {
+    tpcds::RefreshTableId table;
+    if (!tpcds::RefreshTableIdFromString(table_name, &table)) {
+      return arrow::Status::Invalid(
+          "refresh_stream only generates the approximate tpcds fact "
+          "sources (s_purchase, s_catalog_order, s_web_order, their "
+          "lineitems, the s_*_returns tables, s_inventory, delete and "
+          "inventory_delete)");
+    }
+    return arrow::Status::OK();
+  }
+  if (suite != SuiteId::kTpch ||
+      (table_name != tpch::TableIdToString(tpch::TableId::kOrders) &&
+       table_name != tpch::TableIdToString(tpch::TableId::kLineItem) &&
+       table_name != tpch::kRefreshDeleteTableName)) {
+    return arrow::Status::Invalid(
+        "refresh streams are only supported for tpch orders, lineitem and "
+        "delete");
+  }
+  return arrow::Status::OK();
+}
+
+arrow::Status MakeSampledRecordBatchIterator(
+    SuiteId suite, std::string_view table_name, GeneratorOptions options,
+    std::unique_ptr<RecordBatchIterator>* out) {
+  int64_t total_rows = -1;
+  bool is_known = false;
+  auto benchmark_suite = MakeBenchmarkSuite(suite);
+  if (benchmark_suite) {
+    ARROW_RETURN_NOT_OK(benchmark_suite->ResolveTableRowCount(
+        table_name, options, &total_rows, &is_known));
+  }
+  if (!is_known) {
+    total_rows = -1;
+  }
+  // The sampler takes total_rows as a hint only, since lineitem and
+  // lineorder totals are interpolated and may be short of the real count.
+
+  GeneratorOptions table_options = options;
+  table_options.sample_mode = SampleMode::kNone;
+  std::unique_ptr<RecordBatchIterator> table_iter;
+  ARROW_RETURN_NOT_OK(MakeTableRecordBatchIterator(
+      suite, table_name, std::move(table_options), /*init=*/true,
+      &table_iter));
+  return internal::SampledRecordBatchIterator::Make(
+      std::move(table_iter), options, total_rows, out);
+}
+
+}  // namespace
+
+arrow::Status MakeRecordBatchIterator(
+    SuiteId suite, std::string_view table_name, GeneratorOptions options,
+    std::unique_ptr<RecordBatchIterator>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out iterator must not be null");
+  }
+  ARROW_RETURN_NOT_OK(ValidateSoldDateWindow(suite, table_name, options));
+  ARROW_RETURN_NOT_OK(ValidateRefreshStream(suite, table_name, options));
+  if (options.sample_mode != SampleMode::kNone) {
+    return MakeSampledRecordBatchIterator(suite, table_name,
+                                          std::move(options), out);
+  }
+  return MakeTableRecordBatchIterator(suite, table_name, std::move(options),
+                                      /*init=*/true, out);
+}
+
+arrow::Status MakeTableSchema(SuiteId suite, std::string_view table_name,
+                              GeneratorOptions options,
+                              std::shared_ptr<arrow::Schema>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out schema must not be null");
+  }
+  ARROW_RETURN_NOT_OK(ValidateRefreshStream(suite, table_name, options));
+  std::vector<std::string> column_names = options.column_names;
+  std::unique_ptr<RecordBatchIterator> iter;
+  ARROW_RETURN_NOT_OK(MakeTableRecordBatchIterator(
+      suite, table_name, std::move(options), /*init=*/false, &iter));
+  internal::ColumnSelection selection;
+  ARROW_RETURN_NOT_OK(selection.Init(iter->schema(), column_names));
+  *out = selection.schema();
+  return arrow::Status::OK();
+}
+
+arrow::Status MakeMultiRecordBatchIterator(
+    SuiteId suite, const std::vector<std::string>& table_names,
+    GeneratorOptions options, std::unique_ptr<MultiRecordBatchIterator>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out iterator must not be null");
+  }
+  std::vector<tpch::TableId> tables;
+  for (const auto& name : table_names) {
+    tpch::TableId table;
+    if (suite != SuiteId::kTpch || !tpch::TableIdFromString(name, &table)) {
+      tables.clear();
+      break;
+    }
+    tables.push_back(table);
+  }
+  const bool part_first =
+      tables == std::vector<tpch::TableId>{tpch::TableId::kPart,
+                                           tpch::TableId::kPartSupp};
+  const bool partsupp_first =
+      tables == std::vector<tpch::TableId>{tpch::TableId::kPartSupp,
+                                           tpch::TableId::kPart};
+  if (!part_first && !partsupp_first) {
+    out->reset();
+    return arrow::Status::NotImplemented(
+        "only tpch part and partsupp can be generated together");
+  }
+  if (options.sample_mode != SampleMode::kNone ||
+      options.refresh_stream > 0) {
+    return arrow::Status::NotImplemented(
+        "sampling and refresh streams are not supported when co-generating "
+        "tables");
+  }
+  auto iter =
+      std::make_unique<tpch::PartPartSuppGenerator>(std::move(options),
+                                                    part_first);
+  ARROW_RETURN_NOT_OK(iter->Init());
+  *out = std::move(iter);
+  return arrow::Status::OK();
+}
+
 }  // namespace benchgen
@@ -0,0 +1,69 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "benchgen/record_batch_sink.h"
+
+#include <utility>
+
+#include "util/fan_out_sink.h"
+#include "util/ipc_file_sink.h"
+#include "util/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen {
+
+arrow::Status MakeTextFileSink(SuiteId suite, const std::string& path,
+                               std::unique_ptr<RecordBatchSink>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out sink must not be null");
+  }
+  internal::RecordBatchWriterFormat format;
+  switch (suite) {
+    case SuiteId::kTpch:
+      format = internal::RecordBatchWriterFormat::kTpch;
+      break;
+    case SuiteId::kTpcds:
+      format = internal::RecordBatchWriterFormat::kTpcds;
+      break;
+    case SuiteId::kSsb:
+      format = internal::RecordBatchWriterFormat::kSsb;
+      break;
+    default:
+      return arrow::Status::Invalid("unknown suite");
+  }
+  std::unique_ptr<internal::FileRecordBatchSink> sink;
+  ARROW_RETURN_NOT_OK(internal::FileRecordBatchSink::Open(path, format, &sink));
+  *out = std::move(sink);
+  return arrow::Status::OK();
+}
+
+arrow::Status MakeArrowIpcFileSink(const std::string& path,
+                                   const std::shared_ptr<arrow::Schema>& schema,
+                                   std::unique_ptr<RecordBatchSink>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out sink must not be null");
+  }
+  std::unique_ptr<internal::ArrowIpcFileSink> sink;
+  ARROW_RETURN_NOT_OK(internal::ArrowIpcFileSink::Open(path, schema, &sink));
+  *out = std::move(sink);
+  return arrow::Status::OK();
+}
+
+std::unique_ptr<RecordBatchSink> MakeFanOutSink(
+    std::vector<std::unique_ptr<RecordBatchSink>> sinks, int64_t queue_depth) {
+  return std::make_unique<internal::FanOutSink>(std::move(sinks),
+                                                queue_depth);
+}
+
+}  // namespace benchgen
@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <fstream>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::internal {
+
+// The internal sinks implement the public interface, so they can be handed
+// out by the factories in benchgen/record_batch_sink.h.
+using RecordBatchSink = ::benchgen::RecordBatchSink;
+
+// Writes every batch to a single stream it does not own.
+class StreamRecordBatchSink final : public RecordBatchSink {
+ public:
+  StreamRecordBatchSink(std::ostream* out, RecordBatchWriterFormat format)
+      : out_(out), writer_(format) {}
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override {
+    return writer_.Write(out_, batch);
+  }
+  arrow::Status Close() override { return arrow::Status::OK(); }
+
+ private:
+  std::ostream* out_;
+  RecordBatchWriter writer_;
+};
+
+// Writes every batch to a file it opens and owns.
+class FileRecordBatchSink final : public RecordBatchSink {
+ public:
+  static arrow::Status Open(const std::string& path,
+                            RecordBatchWriterFormat format,
+                            std::unique_ptr<FileRecordBatchSink>* out) {
+    std::unique_ptr<FileRecordBatchSink> sink(
+        new FileRecordBatchSink(path, format));
+    sink->file_.open(path, std::ios::out | std::ios::binary |
+                               std::ios::trunc);
+    if (!sink->file_) {
+      return arrow::Status::IOError("Failed to open output file: ", path);
+    }
+    *out = std::move(sink);
+    return arrow::Status::OK();
+  }
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override {
+    ARROW_RETURN_NOT_OK(writer_.Write(&file_, batch));
+    if (!file_) {
+      return arrow::Status::IOError("Error writing ", path_);
+    }
+    return arrow::Status::OK();
+  }
+  arrow::Status Close() override {
+    file_.close();
+    if (file_.fail()) {
+      return arrow::Status::IOError("Error closing ", path_);
+    }
+    return arrow::Status::OK();
+  }
+
+ private:
+  FileRecordBatchSink(std::string path, RecordBatchWriterFormat format)
+      : path_(std::move(path)), writer_(format) {}
+
+  std::string path_;
+  std::ofstream file_;
+  RecordBatchWriter writer_;
+};
+
+}  // namespace benchgen::internal
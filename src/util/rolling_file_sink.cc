@@ -0,0 +1,164 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/rolling_file_sink.h"
+
+#include <filesystem>
+#include <sstream>
+#include <system_error>
+#include <utility>
+
+#include "util/json.h"
+
+namespace benchgen::internal {
+namespace {
+
+std::string SuffixedPath(const std::string& output_path,
+                         const std::string& suffix,
+                         const std::string& extension) {
+  std::filesystem::path path(output_path);
+  return (path.parent_path() / (path.stem().string() + suffix + extension))
+      .string();
+}
+
+}  // namespace
+
+RollingFileSink::RollingFileSink(std::string output_path, int64_t worker_index,
+                                 int64_t first_row, int64_t max_file_bytes,
+                                 int64_t max_file_rows,
+                                 RecordBatchWriterFormat format)
+    : output_path_(std::move(output_path)),
+      worker_index_(worker_index),
+      next_row_(first_row),
+      max_file_bytes_(max_file_bytes),
+      max_file_rows_(max_file_rows),
+      writer_(format) {}
+
+std::string RollingFileSink::FilePath(const std::string& output_path,
+                                      int64_t worker_index, int64_t sequence) {
+  return SuffixedPath(
+      output_path,
+      "-" + std::to_string(worker_index) + "-" + std::to_string(sequence),
+      std::filesystem::path(output_path).extension().string());
+}
+
+std::string RollingFileSink::ManifestPath(const std::string& output_path,
+                                          int64_t worker_index) {
+  return SuffixedPath(output_path, "-" + std::to_string(worker_index),
+                      ".manifest.json");
+}
+
+arrow::Status RollingFileSink::OpenFile() {
+  current_ = RollingFileInfo();
+  current_.path = FilePath(output_path_, worker_index_,
+                           static_cast<int64_t>(files_.size()));
+  current_.first_row = next_row_;
+  stream_.open(current_.path, std::ios::out | std::ios::binary);
+  if (!stream_) {
+    return arrow::Status::IOError("Failed to open output file: ",
+                                  current_.path);
+  }
+  has_current_ = true;
+  return arrow::Status::OK();
+}
+
+arrow::Status RollingFileSink::FinishFile() {
+  stream_.close();
+  has_current_ = false;
+  if (stream_.fail()) {
+    return arrow::Status::IOError("Failed to close output file: ",
+                                  current_.path);
+  }
+  files_.push_back(current_);
+  return WriteManifest(false);
+}
+
+arrow::Status RollingFileSink::Write(
+    const std::shared_ptr<arrow::RecordBatch>& batch) {
+  if (!batch) {
+    return arrow::Status::Invalid("record batch must not be null");
+  }
+  std::ostringstream rendered;
+  ARROW_RETURN_NOT_OK(writer_.Write(&rendered, batch));
+  const std::string data = rendered.str();
+  const int64_t bytes = static_cast<int64_t>(data.size());
+  const int64_t rows = batch->num_rows();
+
+  if (has_current_ && current_.row_count > 0 &&
+      ((max_file_bytes_ > 0 && current_.bytes + bytes > max_file_bytes_) ||
+       (max_file_rows_ > 0 && current_.row_count + rows > max_file_rows_))) {
+    ARROW_RETURN_NOT_OK(FinishFile());
+  }
+  if (!has_current_) {
+    ARROW_RETURN_NOT_OK(OpenFile());
+  }
+
+  stream_.write(data.data(), static_cast<std::streamsize>(data.size()));
+  if (!stream_) {
+    return arrow::Status::IOError("Failed to write output file: ",
+                                  current_.path);
+  }
+  current_.bytes += bytes;
+  current_.row_count += rows;
+  next_row_ += rows;
+  return arrow::Status::OK();
+}
+
+arrow::Status RollingFileSink::Close() {
+  // An empty worker still leaves one (empty) file behind, like a plain
+  // --output run would.
+  if (!has_current_ && files_.empty()) {
+    ARROW_RETURN_NOT_OK(OpenFile());
+  }
+  if (has_current_) {
+    ARROW_RETURN_NOT_OK(FinishFile());
+  }
+  return WriteManifest(true);
+}
+
+arrow::Status RollingFileSink::WriteManifest(bool complete) const {
+  const std::string path = ManifestPath(output_path_, worker_index_);
+  const std::string temp_path = path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::out | std::ios::trunc);
+    if (!out) {
+      return arrow::Status::IOError("Failed to open manifest: ", temp_path);
+    }
+    out << "{\n";
+    out << "  \"complete\": " << (complete ? "true" : "false") << ",\n";
+    out << "  \"files\": [";
+    for (size_t i = 0; i < files_.size(); ++i) {
+      const RollingFileInfo& file = files_[i];
+      out << (i == 0 ? "\n" : ",\n") << "    {\"path\": ";
+      WriteJsonString(&out,
+                      std::filesystem::path(file.path).filename().string());
+      out << ", \"first_row\": " << file.first_row
+          << ", \"row_count\": " << file.row_count
+          << ", \"bytes\": " << file.bytes << "}";
+    }
+    out << (files_.empty() ? "]\n" : "\n  ]\n") << "}\n";
+    if (!out) {
+      return arrow::Status::IOError("Failed to write manifest: ", temp_path);
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    return arrow::Status::IOError("Failed to publish manifest ", path, ": ",
+                                  ec.message());
+  }
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,82 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/record_batch_sink.h"
+#include "util/record_batch_writer.h"
+
+namespace benchgen::internal {
+
+struct RollingFileInfo {
+  std::string path;
+  int64_t first_row = 0;
+  int64_t row_count = 0;
+  int64_t bytes = 0;
+};
+
+// Writes a worker's output as a sequence of files named
+// <stem>-<worker>-<seq><ext> after the output path (lineitem.tbl becomes
+// lineitem-0-0.tbl, lineitem-0-1.tbl, ...). A new file is started at the
+// first batch boundary that would take the current one past max_file_bytes
+// or max_file_rows (a limit <= 0 is disabled); a batch larger than a limit
+// gets a file of its own.
+//
+// Each time a file is finished, <stem>-<worker>.manifest.json is replaced
+// (write to a temporary file, then rename) with the list of finished files,
+// so consumers can pick up completed files while generation continues. Its
+// "complete" flag turns true on Close. first_row counts emitted rows from
+// the worker's first row.
+class RollingFileSink final : public RecordBatchSink {
+ public:
+  RollingFileSink(std::string output_path, int64_t worker_index,
+                  int64_t first_row, int64_t max_file_bytes,
+                  int64_t max_file_rows, RecordBatchWriterFormat format);
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override;
+  arrow::Status Close() override;
+
+  const std::vector<RollingFileInfo>& files() const { return files_; }
+
+  static std::string FilePath(const std::string& output_path,
+                              int64_t worker_index, int64_t sequence);
+  static std::string ManifestPath(const std::string& output_path,
+                                  int64_t worker_index);
+
+ private:
+  arrow::Status OpenFile();
+  arrow::Status FinishFile();
+  arrow::Status WriteManifest(bool complete) const;
+
+  std::string output_path_;
+  int64_t worker_index_;
+  int64_t next_row_;
+  int64_t max_file_bytes_;
+  int64_t max_file_rows_;
+  RecordBatchWriter writer_;
+  std::ofstream stream_;
+  RollingFileInfo current_;
+  bool has_current_ = false;
+  std::vector<RollingFileInfo> files_;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,298 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/run_stats.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#include "util/json.h"
+
+namespace benchgen::internal {
+namespace {
+
+std::string FormatSeconds(double value) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.6f", value);
+  return buf;
+}
+
+std::string FormatDouble(double value) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.17g", value);
+  return buf;
+}
+
+double Rate(int64_t count, double seconds) {
+  return seconds > 0.0 ? static_cast<double>(count) / seconds : 0.0;
+}
+
+void WriteWorker(std::ostream& out, const WorkerStats& worker) {
+  out << "    {\"worker\": " << worker.worker_index
+      << ", \"numa_node\": " << worker.numa_node
+      << ", \"start_row\": " << worker.start_row
+      << ", \"row_count\": " << worker.row_count
+      << ",\n     \"rows\": " << worker.rows
+      << ", \"batches\": " << worker.batches << ", \"bytes\": " << worker.bytes
+      << ", \"seconds\": " << FormatSeconds(worker.total_seconds)
+      << ", \"rows_per_second\": "
+      << FormatSeconds(Rate(worker.rows, worker.total_seconds))
+      << ",\n     \"startup\": {\"make_iterator_seconds\": "
+      << FormatSeconds(worker.make_iterator_seconds)
+      << ", \"first_batch_seconds\": "
+      << FormatSeconds(worker.first_batch_seconds) << "}"
+      << ",\n     \"phases\": {\"generate_seconds\": "
+      << FormatSeconds(worker.generate_seconds)
+      << ", \"format_seconds\": " << FormatSeconds(worker.format_seconds)
+      << ", \"write_seconds\": " << FormatSeconds(worker.write_seconds)
+      << ", \"close_seconds\": " << FormatSeconds(worker.close_seconds)
+      << ", \"write_timed\": " << (worker.write_timed ? "true" : "false")
+      << "}"
+      << ",\n     \"timeline_interval_seconds\": "
+      << FormatDouble(worker.timeline.interval_seconds())
+      << ", \"timeline\": [";
+  const auto& samples = worker.timeline.samples();
+  for (size_t i = 0; i < samples.size(); ++i) {
+    out << (i == 0 ? "" : ", ") << "[" << FormatSeconds(samples[i].seconds)
+        << ", " << samples[i].rows << "]";
+  }
+  out << "]}";
+}
+
+}  // namespace
+
+void RunStatsTimeline::Update(double seconds, int64_t rows) {
+  if (seconds < next_sample_) {
+    return;
+  }
+  samples_.push_back({seconds, rows});
+  next_sample_ = seconds + interval_seconds_;
+  if (samples_.size() > kMaxSamples) {
+    size_t kept = 0;
+    for (size_t i = 0; i < samples_.size(); i += 2) {
+      samples_[kept++] = samples_[i];
+    }
+    samples_.resize(kept);
+    interval_seconds_ *= 2.0;
+    next_sample_ = samples_.back().seconds + interval_seconds_;
+  }
+}
+
+void RunStatsTimeline::Finish(double seconds, int64_t rows) {
+  if (!samples_.empty() && samples_.back().seconds == seconds) {
+    samples_.back().rows = rows;
+    return;
+  }
+  samples_.push_back({seconds, rows});
+}
+
+arrow::Status WriteRunStats(const std::string& path, const RunStats& stats) {
+  const std::string temp_path = path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::out | std::ios::trunc);
+    if (!out) {
+      return arrow::Status::IOError("Failed to open stats file: ", temp_path);
+    }
+    int64_t rows = 0;
+    int64_t bytes = 0;
+    for (const WorkerStats& worker : stats.workers) {
+      rows += worker.rows;
+      bytes = (bytes < 0 || worker.bytes < 0) ? -1 : bytes + worker.bytes;
+    }
+    out << "{\n  \"benchmark\": ";
+    WriteJsonString(&out, stats.benchmark);
+    out << ",\n  \"table\": ";
+    WriteJsonString(&out, stats.table);
+    out << ",\n  \"scale_factor\": " << FormatDouble(stats.scale_factor)
+        << ",\n  \"node_index\": " << stats.node_index
+        << ",\n  \"node_count\": " << stats.node_count
+        << ",\n  \"parallel\": " << stats.workers.size()
+        << ",\n  \"wall_seconds\": " << FormatSeconds(stats.wall_seconds)
+        << ",\n  \"rows\": " << rows << ",\n  \"bytes\": " << bytes
+        << ",\n  \"rows_per_second\": "
+        << FormatSeconds(Rate(rows, stats.wall_seconds))
+        << ",\n  \"workers\": [";
+    for (size_t i = 0; i < stats.workers.size(); ++i) {
+      out << (i == 0 ? "\n" : ",\n");
+      WriteWorker(out, stats.workers[i]);
+    }
+    out << (stats.workers.empty() ? "]\n" : "\n  ]\n") << "}\n";
+    if (!out) {
+      return arrow::Status::IOError("Failed to write stats file: ", temp_path);
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    return arrow::Status::IOError("Failed to publish stats file ", path, ": ",
+                                  ec.message());
+  }
+  return arrow::Status::OK();
+}
+
+TimedStreambuf::TimedStreambuf(std::streambuf* target, size_t buffer_bytes)
+    : target_(target), buffer_(buffer_bytes == 0 ? 1 : buffer_bytes) {
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+}
+
+TimedStreambuf::~TimedStreambuf() { FlushBuffer(); }
+
+bool TimedStreambuf::Forward(const char* data, std::streamsize count) {
+  const auto started = std::chrono::steady_clock::now();
+  std::streamsize written = target_->sputn(data, count);
+  write_seconds_ += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - started)
+                        .count();
+  if (written > 0) {
+    bytes_ += written;
+  }
+  return written == count;
+}
+
+bool TimedStreambuf::FlushBuffer() {
+  std::streamsize pending = pptr() - pbase();
+  if (pending == 0) {
+    return true;
+  }
+  bool ok = Forward(pbase(), pending);
+  setp(buffer_.data(), buffer_.data() + buffer_.size());
+  return ok;
+}
+
+TimedStreambuf::int_type TimedStreambuf::overflow(int_type ch) {
+  if (!FlushBuffer()) {
+    return traits_type::eof();
+  }
+  if (traits_type::eq_int_type(ch, traits_type::eof())) {
+    return traits_type::not_eof(ch);
+  }
+  *pptr() = traits_type::to_char_type(ch);
+  pbump(1);
+  return ch;
+}
+
+std::streamsize TimedStreambuf::xsputn(const char* data,
+                                       std::streamsize count) {
+  std::streamsize room = epptr() - pptr();
+  if (count <= room) {
+    std::memcpy(pptr(), data, static_cast<size_t>(count));
+    pbump(static_cast<int>(count));
+    return count;
+  }
+  if (!FlushBuffer()) {
+    return 0;
+  }
+  if (count >= static_cast<std::streamsize>(buffer_.size())) {
+    return Forward(data, count) ? count : 0;
+  }
+  std::memcpy(pptr(), data, static_cast<size_t>(count));
+  pbump(static_cast<int>(count));
+  return count;
+}
+
+int TimedStreambuf::sync() {
+  if (!FlushBuffer()) {
+    return -1;
+  }
+  const auto started = std::chrono::steady_clock::now();
+  int result = target_->pubsync();
+  write_seconds_ += std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - started)
+                        .count();
+  return result;
+}
+
+std::string FormatProgressLine(const std::string& label, int64_t rows,
+                               int64_t total_rows, int64_t bytes,
+                               double seconds) {
+  char buf[256];
+  int length = std::snprintf(buf, sizeof(buf), "%s: %lld rows", label.c_str(),
+                             static_cast<long long>(rows));
+  std::string line(buf, static_cast<size_t>(length));
+  if (total_rows > 0) {
+    std::snprintf(buf, sizeof(buf), " (%.1f%%)",
+                  100.0 * static_cast<double>(rows) /
+                      static_cast<double>(total_rows));
+    line += buf;
+  }
+  std::snprintf(buf, sizeof(buf), ", %.0f rows/s", Rate(rows, seconds));
+  line += buf;
+  if (bytes > 0) {
+    std::snprintf(buf, sizeof(buf), ", %.1f MiB/s",
+                  Rate(bytes, seconds) / (1024.0 * 1024.0));
+    line += buf;
+  }
+  std::snprintf(buf, sizeof(buf), ", %.1f s", seconds);
+  line += buf;
+  return line;
+}
+
+ProgressReporter::ProgressReporter(std::string label, int64_t total_rows,
+                                   const std::vector<WorkerProgress>* workers,
+                                   std::chrono::milliseconds interval)
+    : label_(std::move(label)),
+      total_rows_(total_rows),
+      workers_(workers),
+      interval_(interval) {}
+
+ProgressReporter::~ProgressReporter() {
+  if (thread_.joinable()) {
+    Stop();
+  }
+}
+
+void ProgressReporter::Start() {
+  started_ = std::chrono::steady_clock::now();
+  thread_ = std::thread([this] { Run(); });
+}
+
+void ProgressReporter::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  Print();
+}
+
+void ProgressReporter::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!cv_.wait_for(lock, interval_, [this] { return stopping_; })) {
+    Print();
+  }
+}
+
+void ProgressReporter::Print() {
+  int64_t rows = 0;
+  int64_t bytes = 0;
+  for (const WorkerProgress& worker : *workers_) {
+    rows += worker.rows.load(std::memory_order_relaxed);
+    bytes += worker.bytes.load(std::memory_order_relaxed);
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - started_)
+                       .count();
+  std::string line =
+      FormatProgressLine(label_, rows, total_rows_, bytes, seconds);
+  std::fprintf(stderr, "%s\n", line.c_str());
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,173 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+struct RunStatsSample {
+  double seconds = 0.0;  // since the worker started
+  int64_t rows = 0;      // emitted so far
+};
+
+// Rows emitted over time, one sample per interval. When it grows past
+// kMaxSamples every other sample is dropped and the interval doubles, so
+// long runs keep a bounded, evenly spaced history.
+class RunStatsTimeline {
+ public:
+  static constexpr size_t kMaxSamples = 512;
+
+  explicit RunStatsTimeline(double interval_seconds = 1.0)
+      : interval_seconds_(interval_seconds) {}
+
+  // Records a sample if an interval has passed since the last one.
+  void Update(double seconds, int64_t rows);
+  // Records the final sample unconditionally.
+  void Finish(double seconds, int64_t rows);
+
+  const std::vector<RunStatsSample>& samples() const { return samples_; }
+  double interval_seconds() const { return interval_seconds_; }
+
+ private:
+  double interval_seconds_;
+  double next_sample_ = 0.0;
+  std::vector<RunStatsSample> samples_;
+};
+
+// Where one worker's wall time went. Startup is iterator creation (which
+// loads distributions, builds indexes and seeks to start_row) plus the
+// first Next(), where some generators finish initialising. The phases
+// cover the remaining batches: generate is Next(), format is rendering
+// rows to text and write is handing the text to the output. write is only
+// measured for plain stream output (write_timed); for other sinks it is
+// included in format.
+struct WorkerStats {
+  int64_t worker_index = 0;
+  int numa_node = -1;
+  int64_t start_row = 0;
+  int64_t row_count = -1;
+  int64_t rows = 0;
+  int64_t batches = 0;
+  int64_t bytes = -1;  // -1 when the sink does not report it
+  double make_iterator_seconds = 0.0;
+  double first_batch_seconds = 0.0;
+  double generate_seconds = 0.0;
+  double format_seconds = 0.0;
+  double write_seconds = 0.0;
+  double close_seconds = 0.0;
+  double total_seconds = 0.0;
+  bool write_timed = false;
+  RunStatsTimeline timeline;
+};
+
+struct RunStats {
+  std::string benchmark;
+  std::string table;
+  double scale_factor = 1.0;
+  int64_t node_index = 0;
+  int64_t node_count = 1;
+  double wall_seconds = 0.0;
+  std::vector<WorkerStats> workers;
+};
+
+// Writes the report as JSON (tmp file + rename).
+arrow::Status WriteRunStats(const std::string& path, const RunStats& stats);
+
+// Pass-through stream buffer that counts the bytes written and the time
+// spent handing them to the target buffer. It buffers up to buffer_bytes
+// itself so the clock is read once per flush, not once per value.
+class TimedStreambuf final : public std::streambuf {
+ public:
+  explicit TimedStreambuf(std::streambuf* target,
+                          size_t buffer_bytes = size_t{1} << 16);
+  ~TimedStreambuf() override;
+
+  TimedStreambuf(const TimedStreambuf&) = delete;
+  TimedStreambuf& operator=(const TimedStreambuf&) = delete;
+
+  int64_t bytes() const { return bytes_ + (pptr() - pbase()); }
+  double write_seconds() const { return write_seconds_; }
+
+ protected:
+  int_type overflow(int_type ch) override;
+  std::streamsize xsputn(const char* data, std::streamsize count) override;
+  int sync() override;
+
+ private:
+  bool Forward(const char* data, std::streamsize count);
+  bool FlushBuffer();
+
+  std::streambuf* target_;
+  std::vector<char> buffer_;
+  int64_t bytes_ = 0;
+  double write_seconds_ = 0.0;
+};
+
+// Live per-worker counters, written by the worker and read by the
+// progress reporter.
+struct WorkerProgress {
+  std::atomic<int64_t> rows{0};
+  std::atomic<int64_t> bytes{0};  // stays 0 when the sink does not report it
+};
+
+// "<label>: <rows> rows (<pct>%), <rows/s> rows/s, <MiB/s> MiB/s, <s> s";
+// the percentage is left out when total_rows is unknown (< 0) and the
+// throughput in MiB/s when bytes is 0.
+std::string FormatProgressLine(const std::string& label, int64_t rows,
+                               int64_t total_rows, int64_t bytes,
+                               double seconds);
+
+// Prints a progress line to stderr every interval from a background
+// thread, and a last one on Stop().
+class ProgressReporter {
+ public:
+  ProgressReporter(std::string label, int64_t total_rows,
+                   const std::vector<WorkerProgress>* workers,
+                   std::chrono::milliseconds interval);
+  ~ProgressReporter();
+
+  ProgressReporter(const ProgressReporter&) = delete;
+  ProgressReporter& operator=(const ProgressReporter&) = delete;
+
+  void Start();
+  void Stop();
+
+ private:
+  void Run();
+  void Print();
+
+  std::string label_;
+  int64_t total_rows_;
+  const std::vector<WorkerProgress>* workers_;
+  std::chrono::milliseconds interval_;
+  std::chrono::steady_clock::time_point started_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+}  // namespace benchgen::internal
@@ -0,0 +1,206 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/sampled_record_batch_iterator.h"
+
+#include <arrow/array/concatenate.h>
+
+#include <utility>
+#include <vector>
+
+#include "util/hash.h"
+
+namespace benchgen::internal {
+namespace {
+
+// Bernoulli scans over a table of unknown size check that they are still
+// inside the table after this many unsampled rows.
+constexpr int64_t kEndProbeRows = int64_t{1} << 20;
+
+}  // namespace
+
+bool IsSampledRow(const GeneratorOptions& options, int64_t row) {
+  switch (options.sample_mode) {
+    case SampleMode::kNone:
+      return true;
+    case SampleMode::kSystematic: {
+      int64_t phase = static_cast<int64_t>(
+          options.sample_seed % static_cast<uint64_t>(options.sample_interval));
+      return row % options.sample_interval == phase;
+    }
+    case SampleMode::kBernoulli: {
+      uint64_t hash =
+          MixBits(MixBits(options.sample_seed) ^ static_cast<uint64_t>(row));
+      double unit = static_cast<double>(hash >> 11) * 0x1.0p-53;
+      return unit < options.sample_fraction;
+    }
+  }
+  return true;
+}
+
+SampledRecordBatchIterator::SampledRecordBatchIterator(
+    std::unique_ptr<RecordBatchIterator> inner, const GeneratorOptions& options,
+    int64_t total_rows)
+    : inner_(std::move(inner)), options_(options), total_rows_(total_rows) {}
+
+arrow::Status SampledRecordBatchIterator::Make(
+    std::unique_ptr<RecordBatchIterator> inner, const GeneratorOptions& options,
+    int64_t total_rows, std::unique_ptr<RecordBatchIterator>* out) {
+  if (out == nullptr) {
+    return arrow::Status::Invalid("out iterator must not be null");
+  }
+  if (!inner) {
+    return arrow::Status::Invalid("inner iterator must not be null");
+  }
+  if (options.sample_mode == SampleMode::kSystematic &&
+      options.sample_interval <= 0) {
+    return arrow::Status::Invalid("sample_interval must be positive");
+  }
+  if (options.sample_mode == SampleMode::kBernoulli &&
+      !(options.sample_fraction > 0.0 && options.sample_fraction <= 1.0)) {
+    return arrow::Status::Invalid("sample_fraction must be in (0, 1]");
+  }
+
+  std::unique_ptr<SampledRecordBatchIterator> iter(
+      new SampledRecordBatchIterator(std::move(inner), options, total_rows));
+  ARROW_RETURN_NOT_OK(iter->batch_sizer_.Init(
+      iter->inner_->schema(), options.chunk_size, options.chunk_bytes));
+  ARROW_RETURN_NOT_OK(iter->Seek(options.start_row, options.row_count));
+  *out = std::move(iter);
+  return arrow::Status::OK();
+}
+
+arrow::Status SampledRecordBatchIterator::Seek(int64_t start_row,
+                                               int64_t row_count) {
+  if (start_row < 0) {
+    return arrow::Status::Invalid("start_row must be non-negative");
+  }
+  next_row_ = start_row;
+  // total_rows_ is not a bound: past it the table ends when the wrapped
+  // iterator runs out of rows.
+  end_row_ = row_count < 0 ? -1 : start_row + row_count;
+  done_ = end_row_ >= 0 && next_row_ >= end_row_;
+  return arrow::Status::OK();
+}
+
+arrow::Status SampledRecordBatchIterator::FindNextSampledRow(int64_t* row,
+                                                             bool* found) {
+  int64_t candidate = next_row_;
+  if (options_.sample_mode == SampleMode::kSystematic) {
+    int64_t interval = options_.sample_interval;
+    int64_t phase = static_cast<int64_t>(options_.sample_seed %
+                                         static_cast<uint64_t>(interval));
+    int64_t offset = ((candidate - phase) % interval + interval) % interval;
+    if (offset != 0) {
+      candidate += interval - offset;
+    }
+  } else {
+    int64_t scanned = 0;
+    while (!IsSampledRow(options_, candidate)) {
+      ++candidate;
+      if (end_row_ >= 0 && candidate >= end_row_) {
+        break;
+      }
+      // Inside total_rows_ the rows exist; past it (or without it) check
+      // now and then that the scan has not left the table.
+      if (end_row_ < 0 && candidate >= total_rows_ &&
+          ++scanned % kEndProbeRows == 0) {
+        std::shared_ptr<arrow::RecordBatch> probe;
+        ARROW_RETURN_NOT_OK(inner_->Seek(candidate, 1));
+        ARROW_RETURN_NOT_OK(inner_->Next(&probe));
+        if (probe == nullptr) {
+          *found = false;
+          return arrow::Status::OK();
+        }
+      }
+    }
+  }
+  *row = candidate;
+  *found = end_row_ < 0 || candidate < end_row_;
+  return arrow::Status::OK();
+}
+
+arrow::Status SampledRecordBatchIterator::Next(
+    std::shared_ptr<arrow::RecordBatch>* out) {
+  if (done_) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+
+  const int64_t target_rows = batch_sizer_.batch_rows();
+  std::vector<std::shared_ptr<arrow::RecordBatch>> pieces;
+  int64_t rows = 0;
+  while (rows < target_rows) {
+    int64_t row = 0;
+    bool found = false;
+    ARROW_RETURN_NOT_OK(FindNextSampledRow(&row, &found));
+    if (!found) {
+      done_ = true;
+      break;
+    }
+
+    // Extend to the run of consecutive sampled rows so they are generated
+    // with a single seek.
+    int64_t run = 1;
+    while (rows + run < target_rows &&
+           (end_row_ < 0 || row + run < end_row_) &&
+           IsSampledRow(options_, row + run)) {
+      ++run;
+    }
+
+    ARROW_RETURN_NOT_OK(inner_->Seek(row, run));
+    int64_t produced = 0;
+    std::shared_ptr<arrow::RecordBatch> batch;
+    while (produced < run) {
+      ARROW_RETURN_NOT_OK(inner_->Next(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      produced += batch->num_rows();
+      pieces.push_back(std::move(batch));
+    }
+    rows += produced;
+    next_row_ = row + produced;
+    if (produced < run) {
+      done_ = true;
+      break;
+    }
+  }
+
+  if (rows == 0) {
+    *out = nullptr;
+    return arrow::Status::OK();
+  }
+  if (pieces.size() == 1) {
+    *out = std::move(pieces.front());
+  } else {
+    const int num_columns = pieces.front()->num_columns();
+    std::vector<std::shared_ptr<arrow::Array>> columns;
+    columns.reserve(static_cast<size_t>(num_columns));
+    for (int col = 0; col < num_columns; ++col) {
+      arrow::ArrayVector chunks;
+      chunks.reserve(pieces.size());
+      for (const auto& piece : pieces) {
+        chunks.push_back(piece->column(col));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto column, arrow::Concatenate(chunks));
+      columns.push_back(std::move(column));
+    }
+    *out = arrow::RecordBatch::Make(inner_->schema(), rows, std::move(columns));
+  }
+  batch_sizer_.Observe(**out);
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::internal
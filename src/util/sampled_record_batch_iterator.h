@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <arrow/status.h>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/generator_options.h"
+#include "benchgen/record_batch_iterator.h"
+#include "util/batch_sizer.h"
+
+namespace benchgen::internal {
+
+// Returns whether the table-wide row index is kept by the sampling options.
+bool IsSampledRow(const GeneratorOptions& options, int64_t row);
+
+// Produces the sampled rows of a table by seeking the wrapped iterator from
+// one run of sampled rows to the next, so unsampled rows are never generated.
+class SampledRecordBatchIterator final : public RecordBatchIterator {
+ public:
+  // total_rows is the table size if known (< 0 if not). It only spares end
+  // of table checks below it: interpolated totals (lineitem, lineorder) can
+  // fall short, so rows past it are still produced until the wrapped
+  // iterator runs out.
+  static arrow::Status Make(std::unique_ptr<RecordBatchIterator> inner,
+                            const GeneratorOptions& options, int64_t total_rows,
+                            std::unique_ptr<RecordBatchIterator>* out);
+
+  std::string_view name() const override { return inner_->name(); }
+  std::string_view suite_name() const override {
+    return inner_->suite_name();
+  }
+  std::shared_ptr<arrow::Schema> schema() const override {
+    return inner_->schema();
+  }
+
+  arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override;
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override;
+
+ private:
+  SampledRecordBatchIterator(std::unique_ptr<RecordBatchIterator> inner,
+                             const GeneratorOptions& options,
+                             int64_t total_rows);
+
+  // Finds the first sampled row at or after next_row_. Sets *found to false
+  // once the range (or the table) is exhausted.
+  arrow::Status FindNextSampledRow(int64_t* row, bool* found);
+
+  std::unique_ptr<RecordBatchIterator> inner_;
+  GeneratorOptions options_;
+  int64_t total_rows_ = -1;
+  int64_t end_row_ = -1;
+  int64_t next_row_ = 0;
+  bool done_ = false;
+  BatchSizer batch_sizer_;
+};
+
+}  // namespace benchgen::internal
@@ -130,6 +130,23 @@ constexpr std::array<std::string_view,
         "web_site",
 };
 
+constexpr std::array<std::string_view,
+                     static_cast<size_t>(RefreshTableId::kTableCount)>
+    kRefreshTableNames = {
+        "s_purchase",
+        "s_purchase_lineitem",
+        "s_catalog_order",
+        "s_catalog_order_lineitem",
+        "s_web_order",
+        "s_web_order_lineitem",
+        "s_store_returns",
+        "s_catalog_returns",
+        "s_web_returns",
+        "s_inventory",
+        "delete",
+        "inventory_delete",
+};
+
 }  // namespace
 
 std::string_view TableIdToString(TableId table) {
@@ -144,6 +161,18 @@ bool TableIdFromString(std::string_view name, TableId* out) {
   return TableIdFromStringImpl(normalized, out, kTableNames);
 }
 
+std::string_view RefreshTableIdToString(RefreshTableId table) {
+  return TableIdToStringImpl(table, kRefreshTableNames);
+}
+
+bool RefreshTableIdFromString(std::string_view name, RefreshTableId* out) {
+  if (out == nullptr) {
+    return false;
+  }
+  std::string normalized = NormalizeTableNameUnderscore(name);
+  return TableIdFromStringImpl(normalized, out, kRefreshTableNames);
+}
+
 }  // namespace benchgen::tpcds
 
 namespace benchgen::ssb {
@@ -152,7 +181,7 @@ namespace {
 constexpr std::array<std::string_view,
                      static_cast<size_t>(TableId::kTableCount)>
     kTableNames = {
-        "customer", "part", "supplier", "date", "lineorder",
+        "customer", "part", "supplier", "date", "lineorder", "lineorder_flat",
 };
 
 }  // namespace
@@ -0,0 +1,199 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/thread_affinity.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace benchgen::internal {
+namespace {
+
+bool ParseCpuNumber(std::string_view text, int* out) {
+  if (text.empty() || text.size() > 9) {
+    return false;
+  }
+  int value = 0;
+  for (char c : text) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    value = value * 10 + (c - '0');
+  }
+  *out = value;
+  return true;
+}
+
+std::string_view Trim(std::string_view text) {
+  while (!text.empty() && (text.back() == '\n' || text.back() == ' ')) {
+    text.remove_suffix(1);
+  }
+  while (!text.empty() && text.front() == ' ') {
+    text.remove_prefix(1);
+  }
+  return text;
+}
+
+std::vector<int> AllCpus() {
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  if (cpus.empty()) {
+    unsigned count = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned cpu = 0; cpu < count; ++cpu) {
+      cpus.push_back(static_cast<int>(cpu));
+    }
+  }
+  return cpus;
+}
+
+}  // namespace
+
+arrow::Status ParseCpuList(std::string_view text, std::vector<int>* out) {
+  out->clear();
+  text = Trim(text);
+  if (text.empty()) {
+    return arrow::Status::OK();
+  }
+  while (true) {
+    size_t comma = text.find(',');
+    std::string_view item = text.substr(0, comma);
+    size_t dash = item.find('-');
+    int first = 0;
+    int last = 0;
+    bool ok = dash == std::string_view::npos
+                  ? ParseCpuNumber(item, &first)
+                  : ParseCpuNumber(item.substr(0, dash), &first) &&
+                        ParseCpuNumber(item.substr(dash + 1), &last);
+    if (dash == std::string_view::npos) {
+      last = first;
+    }
+    if (!ok || last < first) {
+      return arrow::Status::Invalid("Invalid CPU list: ", std::string(text));
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      out->push_back(cpu);
+    }
+    if (comma == std::string_view::npos) {
+      break;
+    }
+    text.remove_prefix(comma + 1);
+  }
+  std::sort(out->begin(), out->end());
+  out->erase(std::unique(out->begin(), out->end()), out->end());
+  return arrow::Status::OK();
+}
+
+std::vector<NumaNode> DetectNumaNodes() {
+  std::vector<NumaNode> nodes;
+  const std::vector<int> allowed = AllCpus();
+  std::error_code ec;
+  const std::filesystem::path root("/sys/devices/system/node");
+  for (const auto& entry : std::filesystem::directory_iterator(root, ec)) {
+    const std::string name = entry.path().filename().string();
+    NumaNode node;
+    if (name.rfind("node", 0) != 0 ||
+        !ParseCpuNumber(std::string_view(name).substr(4), &node.id)) {
+      continue;
+    }
+    std::ifstream in(entry.path() / "cpulist");
+    std::string line;
+    std::vector<int> cpus;
+    if (!std::getline(in, line) || !ParseCpuList(line, &cpus).ok()) {
+      continue;
+    }
+    // Only CPUs this process may run on (cgroups, taskset).
+    for (int cpu : cpus) {
+      if (std::binary_search(allowed.begin(), allowed.end(), cpu)) {
+        node.cpus.push_back(cpu);
+      }
+    }
+    if (!node.cpus.empty()) {
+      nodes.push_back(std::move(node));
+    }
+  }
+  if (nodes.empty()) {
+    NumaNode node;
+    node.cpus = allowed;
+    nodes.push_back(std::move(node));
+  }
+  std::sort(nodes.begin(), nodes.end(),
+            [](const NumaNode& lhs, const NumaNode& rhs) {
+              return lhs.id < rhs.id;
+            });
+  return nodes;
+}
+
+WorkerPlacement PlaceWorker(const std::vector<NumaNode>& nodes,
+                            int64_t worker_index, bool pin_cpu) {
+  WorkerPlacement placement;
+  if (nodes.empty() || worker_index < 0) {
+    return placement;
+  }
+  const int64_t node_count = static_cast<int64_t>(nodes.size());
+  const NumaNode& node = nodes[static_cast<size_t>(worker_index % node_count)];
+  placement.node = node.id;
+  if (pin_cpu) {
+    const int64_t slot = worker_index / node_count;
+    placement.cpus.push_back(
+        node.cpus[static_cast<size_t>(slot %
+                                      static_cast<int64_t>(node.cpus.size()))]);
+  } else {
+    placement.cpus = node.cpus;
+  }
+  return placement;
+}
+
+arrow::Status BindCurrentThread(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return arrow::Status::Invalid("CPU out of range: ", cpu);
+    }
+    CPU_SET(cpu, &set);
+  }
+  int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  if (rc != 0) {
+    return arrow::Status::IOError("pthread_setaffinity_np failed: ",
+                                  std::strerror(rc));
+  }
+  return arrow::Status::OK();
+#else
+  (void)cpus;
+  return arrow::Status::NotImplemented(
+      "Thread pinning is only supported on Linux");
+#endif
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,53 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+struct NumaNode {
+  int id = 0;
+  std::vector<int> cpus;
+};
+
+// Parses a Linux cpulist/nodelist such as "0-3,8,10-11".
+arrow::Status ParseCpuList(std::string_view text, std::vector<int>* out);
+
+// Reads the NUMA topology from /sys/devices/system/node. Nodes without
+// CPUs are skipped. Falls back to a single node 0 holding every CPU when
+// the topology is not available.
+std::vector<NumaNode> DetectNumaNodes();
+
+// Where a worker runs: round-robin over nodes, and with pin_cpu, on one CPU
+// of that node (successive workers on a node take successive CPUs).
+struct WorkerPlacement {
+  int node = -1;
+  std::vector<int> cpus;
+};
+
+WorkerPlacement PlaceWorker(const std::vector<NumaNode>& nodes,
+                            int64_t worker_index, bool pin_cpu);
+
+// Restricts the calling thread to the given CPUs. Memory the thread touches
+// afterwards is then allocated on its node under the kernel's default
+// first-touch policy.
+arrow::Status BindCurrentThread(const std::vector<int>& cpus);
+
+}  // namespace benchgen::internal
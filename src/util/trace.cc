@@ -0,0 +1,124 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "util/trace.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#include "util/json.h"
+
+namespace benchgen::internal {
+namespace {
+
+// Chrome trace timestamps are microseconds.
+std::string FormatMicros(int64_t nanos) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.3f", static_cast<double>(nanos) / 1e3);
+  return buf;
+}
+
+}  // namespace
+
+thread_local TraceBuffer* TraceBuffer::current_ = nullptr;
+
+TraceBuffer::TraceBuffer(const TraceRecorder* recorder, int64_t thread_id,
+                         std::string thread_name)
+    : recorder_(recorder),
+      thread_id_(thread_id),
+      thread_name_(std::move(thread_name)) {}
+
+int64_t TraceBuffer::NowNs() const { return recorder_->NowNs(); }
+
+void TraceBuffer::Add(const char* name, const char* category,
+                      int64_t start_ns, int64_t end_ns, int64_t rows) {
+  if (events_.size() >= kMaxEvents) {
+    ++dropped_;
+    return;
+  }
+  events_.push_back({name, category, start_ns, end_ns - start_ns, rows});
+}
+
+TraceRecorder::TraceRecorder(std::string process_name)
+    : process_name_(std::move(process_name)),
+      epoch_(std::chrono::steady_clock::now()) {}
+
+TraceBuffer* TraceRecorder::AddThread(int64_t thread_id,
+                                      std::string thread_name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  buffers_.push_back(
+      std::make_unique<TraceBuffer>(this, thread_id, std::move(thread_name)));
+  return buffers_.back().get();
+}
+
+arrow::Status TraceRecorder::Write(const std::string& path) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::string temp_path = path + ".tmp";
+  {
+    std::ofstream out(temp_path, std::ios::out | std::ios::trunc);
+    if (!out) {
+      return arrow::Status::IOError("Failed to open trace file: ", temp_path);
+    }
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, "
+           "\"tid\": 0, \"args\": {\"name\": ";
+    WriteJsonString(&out, process_name_);
+    out << "}}";
+    for (const auto& buffer : buffers_) {
+      out << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+             "\"tid\": "
+          << buffer->thread_id() << ", \"args\": {\"name\": ";
+      WriteJsonString(&out, buffer->thread_name());
+      out << "}}";
+      for (const TraceEvent& event : buffer->events()) {
+        out << ",\n{\"name\": ";
+        WriteJsonString(&out, event.name);
+        out << ", \"cat\": ";
+        WriteJsonString(&out, event.category);
+        out << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << buffer->thread_id()
+            << ", \"ts\": " << FormatMicros(event.start_ns)
+            << ", \"dur\": " << FormatMicros(event.duration_ns);
+        if (event.rows >= 0) {
+          out << ", \"args\": {\"rows\": " << event.rows << "}";
+        }
+        out << "}";
+      }
+      if (buffer->dropped() > 0) {
+        out << ",\n{\"name\": \"dropped events\", \"ph\": \"i\", \"s\": "
+               "\"t\", \"pid\": 1, \"tid\": "
+            << buffer->thread_id() << ", \"ts\": "
+            << FormatMicros(buffer->events().back().start_ns +
+                            buffer->events().back().duration_ns)
+            << ", \"args\": {\"count\": " << buffer->dropped() << "}}";
+      }
+    }
+    out << "\n]}\n";
+    if (!out) {
+      return arrow::Status::IOError("Failed to write trace file: ", temp_path);
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temp_path, path, ec);
+  if (ec) {
+    return arrow::Status::IOError("Failed to publish trace file ", path, ": ",
+                                  ec.message());
+  }
+  return arrow::Status::OK();
+}
+
+}  // namespace benchgen::internal
@@ -0,0 +1,157 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+
+namespace benchgen::internal {
+
+// A completed span. Names and categories must be string literals (or
+// otherwise outlive the recorder), so recording never allocates a string.
+struct TraceEvent {
+  const char* name = nullptr;
+  const char* category = nullptr;
+  int64_t start_ns = 0;
+  int64_t duration_ns = 0;
+  int64_t rows = -1;  // shown as an argument when >= 0
+};
+
+class TraceRecorder;
+
+// Spans recorded by one thread. Only its owning thread may add to it.
+// Events past kMaxEvents are counted but dropped, bounding memory on long
+// runs.
+class TraceBuffer {
+ public:
+  static constexpr size_t kMaxEvents = size_t{1} << 22;
+
+  TraceBuffer(const TraceRecorder* recorder, int64_t thread_id,
+              std::string thread_name);
+
+  int64_t NowNs() const;
+  void Add(const char* name, const char* category, int64_t start_ns,
+           int64_t end_ns, int64_t rows = -1);
+
+  int64_t thread_id() const { return thread_id_; }
+  const std::string& thread_name() const { return thread_name_; }
+  const std::vector<TraceEvent>& events() const { return events_; }
+  int64_t dropped() const { return dropped_; }
+
+  // Buffer that TraceSpan and TracedLock record into on this thread;
+  // nullptr (the default) disables them.
+  static TraceBuffer* Current() { return current_; }
+
+  // Installs a buffer as the calling thread's current one for the scope's
+  // lifetime.
+  class ThreadScope {
+   public:
+    explicit ThreadScope(TraceBuffer* buffer) : previous_(current_) {
+      current_ = buffer;
+    }
+    ~ThreadScope() { current_ = previous_; }
+
+    ThreadScope(const ThreadScope&) = delete;
+    ThreadScope& operator=(const ThreadScope&) = delete;
+
+   private:
+    TraceBuffer* previous_;
+  };
+
+ private:
+  static thread_local TraceBuffer* current_;
+
+  const TraceRecorder* recorder_;
+  int64_t thread_id_;
+  std::string thread_name_;
+  std::vector<TraceEvent> events_;
+  int64_t dropped_ = 0;
+};
+
+// Collects per-thread span buffers and writes them in Chrome trace-event
+// JSON, which chrome://tracing and Perfetto load directly.
+class TraceRecorder {
+ public:
+  explicit TraceRecorder(std::string process_name);
+
+  // Nanoseconds since the recorder was created.
+  int64_t NowNs() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - epoch_)
+        .count();
+  }
+
+  // Thread-safe. The buffer lives as long as the recorder.
+  TraceBuffer* AddThread(int64_t thread_id, std::string thread_name);
+
+  // Call once all threads have stopped recording.
+  arrow::Status Write(const std::string& path) const;
+
+ private:
+  std::string process_name_;
+  std::chrono::steady_clock::time_point epoch_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<TraceBuffer>> buffers_;
+};
+
+// Records [construction, destruction) into the current thread's buffer.
+// Costs one thread-local load when tracing is off.
+class TraceSpan {
+ public:
+  TraceSpan(const char* name, const char* category, int64_t rows = -1)
+      : buffer_(TraceBuffer::Current()),
+        name_(name),
+        category_(category),
+        rows_(rows),
+        start_ns_(buffer_ != nullptr ? buffer_->NowNs() : 0) {}
+  ~TraceSpan() {
+    if (buffer_ != nullptr) {
+      buffer_->Add(name_, category_, start_ns_, buffer_->NowNs(), rows_);
+    }
+  }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+  void set_rows(int64_t rows) { rows_ = rows; }
+
+ private:
+  TraceBuffer* buffer_;
+  const char* name_;
+  const char* category_;
+  int64_t rows_;
+  int64_t start_ns_;
+};
+
+// Locks mutex; if it is held by another thread the wait is recorded as a
+// "lock" span named name. Uncontended locks record nothing.
+template <typename Mutex>
+std::unique_lock<Mutex> TracedLock(Mutex& mutex, const char* name) {
+  std::unique_lock<Mutex> lock(mutex, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    TraceSpan span(name, "lock");
+    lock.lock();
+  }
+  return lock;
+}
+
+}  // namespace benchgen::internal
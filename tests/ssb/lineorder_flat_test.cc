@@ -0,0 +1,109 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace benchgen::ssb {
+namespace {
+
+std::shared_ptr<arrow::Table> Collect(const std::string& table,
+                                      const GeneratorOptions& options) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  auto status = MakeRecordBatchIterator(SuiteId::kSsb, table, options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  if (!status.ok()) {
+    return nullptr;
+  }
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (iter->Next(&batch).ok() && batch) {
+    batches.push_back(batch);
+  }
+  return arrow::Table::FromRecordBatches(iter->schema(), batches)
+      .ValueOrDie();
+}
+
+std::string Cell(const std::shared_ptr<arrow::Table>& table,
+                 const std::string& column, int64_t row) {
+  auto chunked = table->GetColumnByName(column);
+  EXPECT_NE(chunked, nullptr) << column;
+  return chunked->GetScalar(row).ValueOrDie()->ToString();
+}
+
+GeneratorOptions FlatOptions(int64_t start_row, int64_t row_count) {
+  GeneratorOptions options;
+  options.scale_factor = 1;
+  options.start_row = start_row;
+  options.row_count = row_count;
+  options.chunk_size = 700;
+  return options;
+}
+
+}  // namespace
+
+TEST(LineorderFlatTest, RowsJoinTheirDimensions) {
+  auto flat = Collect("lineorder_flat", FlatOptions(12345, 2000));
+  auto lineorder = Collect("lineorder", FlatOptions(12345, 2000));
+  GeneratorOptions dimension_options;
+  dimension_options.scale_factor = 1;
+  auto customer = Collect("customer", dimension_options);
+  auto supplier = Collect("supplier", dimension_options);
+  auto part = Collect("part", dimension_options);
+  ASSERT_TRUE(flat && lineorder && customer && supplier && part);
+  ASSERT_EQ(flat->num_rows(), 2000);
+  ASSERT_EQ(flat->num_columns(), lineorder->num_columns() + 21);
+
+  for (int64_t row = 0; row < flat->num_rows(); row += 97) {
+    for (const auto& field : lineorder->schema()->fields()) {
+      EXPECT_EQ(Cell(flat, field->name(), row),
+                Cell(lineorder, field->name(), row));
+    }
+    int64_t custkey = std::stoll(Cell(flat, "lo_custkey", row));
+    int64_t suppkey = std::stoll(Cell(flat, "lo_suppkey", row));
+    int64_t partkey = std::stoll(Cell(flat, "lo_partkey", row));
+    for (const char* column : {"c_name", "c_city", "c_mktsegment"}) {
+      EXPECT_EQ(Cell(flat, column, row), Cell(customer, column, custkey - 1));
+    }
+    for (const char* column : {"s_address", "s_region", "s_phone"}) {
+      EXPECT_EQ(Cell(flat, column, row), Cell(supplier, column, suppkey - 1));
+    }
+    for (const char* column : {"p_brand", "p_size", "p_container"}) {
+      EXPECT_EQ(Cell(flat, column, row), Cell(part, column, partkey - 1));
+    }
+  }
+}
+
+TEST(LineorderFlatTest, ProjectsColumns) {
+  GeneratorOptions options = FlatOptions(0, 1500);
+  options.column_names = {"p_brand", "lo_revenue", "s_nation"};
+  auto projected = Collect("lineorder_flat", options);
+  auto full = Collect("lineorder_flat", FlatOptions(0, 1500));
+  ASSERT_TRUE(projected && full);
+  ASSERT_EQ(projected->num_columns(), 3);
+  ASSERT_EQ(projected->num_rows(), 1500);
+  for (const auto& name : options.column_names) {
+    EXPECT_TRUE(projected->GetColumnByName(name)->Equals(
+        *full->GetColumnByName(name)))
+        << name;
+  }
+}
+
+}  // namespace benchgen::ssb
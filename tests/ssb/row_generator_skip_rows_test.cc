@@ -223,4 +223,28 @@ TEST(RowGeneratorSkipRows, Lineorder) {
   EXPECT_EQ(expected.shipmode, actual.shipmode);
 }
 
+TEST(RowGeneratorSkipRows, LineorderRewind) {
+  LineorderRowGenerator gen(1.0, benchgen::DbgenSeedMode::kAllTables);
+  ASSERT_TRUE(gen.Init().ok());
+
+  const lineorder_t* row = nullptr;
+  ASSERT_TRUE(gen.NextRow(&row));
+  LineorderSnapshot first = Snapshot(row);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_TRUE(gen.NextRow(&row));
+  }
+
+  gen.Rewind();
+  ASSERT_TRUE(gen.NextRow(&row));
+  LineorderSnapshot actual = Snapshot(row);
+
+  EXPECT_EQ(first.orderkey, actual.orderkey);
+  EXPECT_EQ(first.linenumber, actual.linenumber);
+  EXPECT_EQ(first.custkey, actual.custkey);
+  EXPECT_EQ(first.partkey, actual.partkey);
+  EXPECT_EQ(first.orderdate, actual.orderdate);
+  EXPECT_EQ(first.extendedprice, actual.extendedprice);
+  EXPECT_EQ(first.shipmode, actual.shipmode);
+}
+
 }  // namespace benchgen::ssb::internal
@@ -0,0 +1,105 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <arrow/util/byte_size.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace {
+
+constexpr int64_t kChunkBytes = 256 * 1024;
+
+std::vector<std::shared_ptr<arrow::RecordBatch>> CollectBatches(
+    const char* table, const benchgen::GeneratorOptions& options,
+    int64_t max_batches) {
+  std::unique_ptr<benchgen::RecordBatchIterator> iter;
+  auto status = benchgen::MakeRecordBatchIterator(benchgen::SuiteId::kTpcds,
+                                                  table, options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  if (!status.ok()) {
+    return batches;
+  }
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (static_cast<int64_t>(batches.size()) < max_batches) {
+    status = iter->Next(&batch);
+    EXPECT_TRUE(status.ok()) << status.ToString();
+    if (!status.ok() || batch == nullptr) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  return batches;
+}
+
+}  // namespace
+
+TEST(BatchSizingTest, ItemBatchesTrackByteBudget) {
+  benchgen::GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.chunk_bytes = kChunkBytes;
+  auto batches = CollectBatches("item", options, 8);
+  ASSERT_GE(batches.size(), 4u);
+
+  // The first batch is sized from default string widths; later batches use
+  // the observed averages and should land close to the budget.
+  for (size_t i = 1; i + 1 < batches.size(); ++i) {
+    int64_t bytes = arrow::util::TotalBufferSize(*batches[i]);
+    EXPECT_GT(bytes, kChunkBytes / 2) << "batch " << i;
+    EXPECT_LT(bytes, kChunkBytes * 3 / 2) << "batch " << i;
+  }
+}
+
+TEST(BatchSizingTest, NarrowTablesGetMoreRowsPerBatch) {
+  benchgen::GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.chunk_bytes = kChunkBytes;
+  auto inventory = CollectBatches("inventory", options, 2);
+  auto item = CollectBatches("item", options, 2);
+  ASSERT_EQ(inventory.size(), 2u);
+  ASSERT_EQ(item.size(), 2u);
+  EXPECT_GT(inventory[1]->num_rows(), item[1]->num_rows() * 4);
+}
+
+TEST(BatchSizingTest, RowsMatchFixedChunkSize) {
+  benchgen::GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.row_count = 5000;
+  options.chunk_size = 1000;
+  auto fixed = CollectBatches("item", options, 1000);
+
+  options.chunk_bytes = 64 * 1024;
+  auto sized = CollectBatches("item", options, 1000);
+  ASSERT_FALSE(fixed.empty());
+  ASSERT_FALSE(sized.empty());
+
+  auto fixed_table = arrow::Table::FromRecordBatches(fixed).ValueOrDie();
+  auto sized_table = arrow::Table::FromRecordBatches(sized).ValueOrDie();
+  EXPECT_EQ(sized_table->num_rows(), 5000);
+  EXPECT_TRUE(fixed_table->Equals(*sized_table));
+}
+
+TEST(BatchSizingTest, RejectsNegativeByteBudget) {
+  benchgen::GeneratorOptions options;
+  options.chunk_bytes = -1;
+  std::unique_ptr<benchgen::RecordBatchIterator> iter;
+  auto status = benchgen::MakeRecordBatchIterator(benchgen::SuiteId::kTpch,
+                                                  "customer", options, &iter);
+  EXPECT_FALSE(status.ok());
+}
@@ -211,6 +211,28 @@ void ExpectStartRowMatches(double scale_factor, int64_t total_rows) {
 
   EXPECT_EQ(static_cast<int64_t>(actual_rows.size()), range.row_count);
   EXPECT_EQ(actual_rows, expected);
+
+  // Backward seek on the exhausted baseline, then a full rewind.
+  auto seek_status = baseline.Seek(range.start_row, range.row_count);
+  ASSERT_TRUE(seek_status.ok()) << seek_status.ToString();
+  EXPECT_EQ(CollectRows(&baseline), expected);
+  seek_status = baseline.Seek(0, range.start_row + range.row_count);
+  ASSERT_TRUE(seek_status.ok()) << seek_status.ToString();
+  EXPECT_EQ(CollectRows(&baseline), baseline_rows);
+
+  // Forward seek after a partially consumed range.
+  benchgen::GeneratorOptions forward_options = base_options;
+  forward_options.chunk_size = 1;
+  forward_options.row_count = 1;
+  Generator forward(forward_options);
+  auto forward_status = InitGeneratorIfSupported(&forward);
+  ASSERT_TRUE(forward_status.ok()) << forward_status.ToString();
+  ASSERT_EQ(CollectRows(&forward).size(), 1u);
+  seek_status = forward.Seek(range.start_row, range.row_count);
+  ASSERT_TRUE(seek_status.ok()) << seek_status.ToString();
+  EXPECT_EQ(CollectRows(&forward), expected);
+
+  EXPECT_FALSE(forward.Seek(-1, 1).ok());
 }
 
 }  // namespace
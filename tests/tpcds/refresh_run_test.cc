@@ -0,0 +1,148 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace benchgen::tpcds {
+namespace {
+
+std::vector<std::vector<std::string>> CollectRows(
+    const std::string& table, const GeneratorOptions& options) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  auto status =
+      MakeRecordBatchIterator(SuiteId::kTpcds, table, options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  std::vector<std::vector<std::string>> rows;
+  if (!status.ok()) {
+    return rows;
+  }
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (iter->Next(&batch).ok() && batch) {
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      std::vector<std::string> values;
+      for (int col = 0; col < batch->num_columns(); ++col) {
+        values.push_back(
+            batch->column(col)->GetScalar(row).ValueOrDie()->ToString());
+      }
+      rows.push_back(std::move(values));
+    }
+  }
+  return rows;
+}
+
+GeneratorOptions RunOptions(int32_t run, int64_t start_row = 0,
+                            int64_t row_count = -1) {
+  GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.chunk_size = 1000;
+  options.refresh_stream = run;
+  options.start_row = start_row;
+  options.row_count = row_count;
+  return options;
+}
+
+}  // namespace
+
+TEST(TpcdsRefreshRun, LineitemsFollowOrders) {
+  auto purchases = CollectRows("s_purchase", RunOptions(1));
+  auto lines = CollectRows("s_purchase_lineitem", RunOptions(1));
+  ASSERT_EQ(purchases.size(), 8000u);
+  ASSERT_EQ(lines.size(), purchases.size() * 12);
+  for (size_t i = 0; i < lines.size(); ++i) {
+    ASSERT_EQ(lines[i][0], purchases[i / 12][0]);
+    ASSERT_EQ(lines[i][1], std::to_string(i % 12 + 1));
+  }
+
+  auto orders = CollectRows("s_web_order", RunOptions(1));
+  auto web_lines = CollectRows("s_web_order_lineitem", RunOptions(1));
+  ASSERT_FALSE(orders.empty());
+  EXPECT_EQ(web_lines.size(), orders.size() * 12);
+}
+
+// Return row r returns one of lines 10r-9..10r of its run, with that line's
+// item and at most its quantity.
+TEST(TpcdsRefreshRun, ReturnsReferenceLineitems) {
+  auto lines = CollectRows("s_purchase_lineitem", RunOptions(1));
+  auto returns = CollectRows("s_store_returns", RunOptions(1));
+  ASSERT_EQ(returns.size(), lines.size() / 10);
+  for (size_t r = 0; r < returns.size(); ++r) {
+    const auto& ret = returns[r];
+    int64_t line = (std::stoll(ret[1]) - std::stoll(lines[0][0])) * 12 +
+                   std::stoll(ret[2]) - 1;
+    ASSERT_GE(line, static_cast<int64_t>(r * 10)) << "return " << r;
+    ASSERT_LT(line, static_cast<int64_t>(r * 10 + 10)) << "return " << r;
+    EXPECT_EQ(ret[3], lines[line][2]) << "return " << r;
+    EXPECT_LE(std::stoi(ret[7]), std::stoi(lines[line][4])) << "return " << r;
+  }
+
+  auto web_lines = CollectRows("s_web_order_lineitem", RunOptions(2));
+  auto web_returns = CollectRows("s_web_returns", RunOptions(2));
+  EXPECT_EQ(web_returns.size(), web_lines.size() / 10);
+}
+
+TEST(TpcdsRefreshRun, StartRowMatchesSequentialRows) {
+  for (const char* table :
+       {"s_purchase", "s_purchase_lineitem", "s_catalog_order",
+        "s_catalog_order_lineitem", "s_web_order_lineitem", "s_store_returns",
+        "s_catalog_returns", "s_web_returns", "s_inventory"}) {
+    auto all = CollectRows(table, RunOptions(2, 0, 1100));
+    auto skipped = CollectRows(table, RunOptions(2, 1003, 50));
+    ASSERT_EQ(all.size(), 1100u) << table;
+    ASSERT_EQ(skipped.size(), 50u) << table;
+    for (size_t i = 0; i < skipped.size(); ++i) {
+      EXPECT_EQ(skipped[i], all[i + 1003]) << table << " row " << i;
+    }
+  }
+}
+
+// Run n's ids continue after run n - 1's, and its rows are new draws.
+TEST(TpcdsRefreshRun, RunsContinueIdsAndDiffer) {
+  auto first = CollectRows("s_catalog_order", RunOptions(1));
+  auto second = CollectRows("s_catalog_order", RunOptions(2, 0, 10));
+  ASSERT_FALSE(first.empty());
+  ASSERT_EQ(second.size(), 10u);
+  EXPECT_EQ(std::stoll(second[0][0]), std::stoll(first.back()[0]) + 1);
+  EXPECT_NE(std::vector<std::string>(second[0].begin() + 1, second[0].end()),
+            std::vector<std::string>(first[0].begin() + 1, first[0].end()));
+}
+
+TEST(TpcdsRefreshRun, DeletesCoverEachWindow) {
+  auto deletes = CollectRows("delete", RunOptions(1));
+  auto inventory_deletes = CollectRows("inventory_delete", RunOptions(1));
+  ASSERT_EQ(deletes.size(), 3u);
+  ASSERT_EQ(inventory_deletes.size(), 3u);
+  EXPECT_EQ(deletes[0][0], "1998-01-01");
+  EXPECT_EQ(deletes[0][1], "1998-01-03");
+  EXPECT_EQ(inventory_deletes[0][1], "1998-01-07");
+  EXPECT_LT(deletes[0][1], deletes[1][0]);
+}
+
+TEST(TpcdsRefreshRun, RejectsOtherTables) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  EXPECT_FALSE(MakeRecordBatchIterator(SuiteId::kTpcds, "store_sales",
+                                       RunOptions(1), &iter)
+                   .ok());
+  EXPECT_FALSE(MakeRecordBatchIterator(SuiteId::kTpcds, "s_purchase",
+                                       GeneratorOptions(), &iter)
+                   .ok());
+}
+
+}  // namespace benchgen::tpcds
@@ -44,12 +44,13 @@ bool operator==(const Decimal& lhs, const Decimal& rhs) {
 }
 
 bool operator==(const Address& lhs, const Address& rhs) {
-  return std::tie(lhs.street_num, lhs.street_name1, lhs.street_name2,
-                  lhs.street_type, lhs.suite_num, lhs.city, lhs.county,
-                  lhs.state, lhs.country, lhs.zip, lhs.plus4, lhs.gmt_offset) ==
-         std::tie(rhs.street_num, rhs.street_name1, rhs.street_name2,
-                  rhs.street_type, rhs.suite_num, rhs.city, rhs.county,
-                  rhs.state, rhs.country, rhs.zip, rhs.plus4, rhs.gmt_offset);
+  return lhs.suite_num() == rhs.suite_num() &&
+         std::tie(lhs.street_num, lhs.street_name1, lhs.street_name2,
+                  lhs.street_type, lhs.city, lhs.county, lhs.state,
+                  lhs.country, lhs.zip, lhs.plus4, lhs.gmt_offset) ==
+             std::tie(rhs.street_num, rhs.street_name1, rhs.street_name2,
+                      rhs.street_type, rhs.city, rhs.county, rhs.state,
+                      rhs.country, rhs.zip, rhs.plus4, rhs.gmt_offset);
 }
 
 bool operator==(const Pricing& lhs, const Pricing& rhs) {
@@ -83,13 +84,9 @@ bool operator==(const CatalogPageRowData& lhs, const CatalogPageRowData& rhs) {
 
 bool operator==(const CustomerAddressRowData& lhs,
                 const CustomerAddressRowData& rhs) {
-  return std::tie(lhs.address_sk, lhs.address_id, lhs.street_num,
-                  lhs.street_name, lhs.street_type, lhs.suite_num, lhs.city,
-                  lhs.county, lhs.state, lhs.zip, lhs.country, lhs.gmt_offset,
+  return std::tie(lhs.address_sk, lhs.address_id, lhs.address,
                   lhs.location_type, lhs.null_bitmap) ==
-         std::tie(rhs.address_sk, rhs.address_id, rhs.street_num,
-                  rhs.street_name, rhs.street_type, rhs.suite_num, rhs.city,
-                  rhs.county, rhs.state, rhs.zip, rhs.country, rhs.gmt_offset,
+         std::tie(rhs.address_sk, rhs.address_id, rhs.address,
                   rhs.location_type, rhs.null_bitmap);
 }
 
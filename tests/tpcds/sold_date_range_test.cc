@@ -0,0 +1,146 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+#include "generators/catalog_sales_generator.h"
+
+namespace {
+
+constexpr double kScaleFactor = 0.1;
+constexpr int64_t kFeb2000First = 2451576;  // 2000-02-01
+constexpr int64_t kFeb2000Last = 2451604;   // 2000-02-29
+
+std::shared_ptr<arrow::Table> Generate(
+    const benchgen::GeneratorOptions& options) {
+  std::unique_ptr<benchgen::RecordBatchIterator> iter;
+  auto status = benchgen::MakeRecordBatchIterator(
+      benchgen::SuiteId::kTpcds, "catalog_sales", options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  if (!status.ok()) {
+    return nullptr;
+  }
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    status = iter->Next(&batch);
+    EXPECT_TRUE(status.ok()) << status.ToString();
+    if (!status.ok() || batch == nullptr) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  auto table = arrow::Table::FromRecordBatches(iter->schema(), batches);
+  EXPECT_TRUE(table.ok()) << table.status().ToString();
+  return table.ok() ? table.ValueOrDie()->CombineChunks().ValueOrDie()
+                    : nullptr;
+}
+
+std::shared_ptr<arrow::Int32Array> DateColumn(const arrow::Table& table) {
+  return std::static_pointer_cast<arrow::Int32Array>(
+      table.GetColumnByName("cs_sold_date_sk")->chunk(0));
+}
+
+std::shared_ptr<arrow::Int64Array> OrderColumn(const arrow::Table& table) {
+  return std::static_pointer_cast<arrow::Int64Array>(
+      table.GetColumnByName("cs_order_number")->chunk(0));
+}
+
+benchgen::GeneratorOptions BaseOptions() {
+  benchgen::GeneratorOptions options;
+  options.scale_factor = kScaleFactor;
+  options.chunk_size = 4096;
+  return options;
+}
+
+}  // namespace
+
+TEST(SoldDateRangeTest, CatalogSalesWindowMatchesFullTable) {
+  auto full = Generate(BaseOptions());
+  ASSERT_NE(full, nullptr);
+
+  benchgen::GeneratorOptions options = BaseOptions();
+  options.sold_date_min_sk = kFeb2000First;
+  options.sold_date_max_sk = kFeb2000Last;
+  auto window = Generate(options);
+  ASSERT_NE(window, nullptr);
+  ASSERT_GT(window->num_rows(), 0);
+  EXPECT_EQ(window->num_rows(),
+            benchgen::tpcds::CatalogSalesGenerator::TotalRows(options));
+
+  auto dates = DateColumn(*window);
+  for (int64_t i = 0; i < dates->length(); ++i) {
+    if (dates->IsValid(i)) {
+      EXPECT_GE(dates->Value(i), kFeb2000First);
+      EXPECT_LE(dates->Value(i), kFeb2000Last);
+    }
+  }
+
+  // The window is a contiguous slice of the full table made of whole orders.
+  auto full_orders = OrderColumn(*full);
+  int64_t first_order = OrderColumn(*window)->Value(0);
+  int64_t begin = 0;
+  while (begin < full_orders->length() &&
+         full_orders->Value(begin) != first_order) {
+    ++begin;
+  }
+  ASSERT_LT(begin, full_orders->length());
+  EXPECT_TRUE(window->Equals(*full->Slice(begin, window->num_rows())));
+
+  auto full_dates = DateColumn(*full);
+  ASSERT_GT(begin, 0);
+  if (full_dates->IsValid(begin - 1)) {
+    EXPECT_LT(full_dates->Value(begin - 1), kFeb2000First);
+  }
+  int64_t end = begin + window->num_rows();
+  ASSERT_LT(end, full->num_rows());
+  if (full_dates->IsValid(end)) {
+    EXPECT_GT(full_dates->Value(end), kFeb2000Last);
+  }
+}
+
+TEST(SoldDateRangeTest, RowRangeIsRelativeToWindow) {
+  benchgen::GeneratorOptions options = BaseOptions();
+  options.sold_date_min_sk = kFeb2000First;
+  auto window = Generate(options);
+  ASSERT_NE(window, nullptr);
+
+  options.start_row = 100;
+  options.row_count = 50;
+  auto slice = Generate(options);
+  ASSERT_NE(slice, nullptr);
+  EXPECT_TRUE(slice->Equals(*window->Slice(100, 50)));
+}
+
+TEST(SoldDateRangeTest, RejectsTablesWithoutDateOrderedTickets) {
+  benchgen::GeneratorOptions options = BaseOptions();
+  options.sold_date_min_sk = kFeb2000First;
+  std::unique_ptr<benchgen::RecordBatchIterator> iter;
+  EXPECT_FALSE(benchgen::MakeRecordBatchIterator(
+                   benchgen::SuiteId::kTpcds, "store_sales", options, &iter)
+                   .ok());
+  EXPECT_FALSE(benchgen::MakeRecordBatchIterator(
+                   benchgen::SuiteId::kTpcds, "web_sales", options, &iter)
+                   .ok());
+
+  options.sold_date_max_sk = kFeb2000First - 1;
+  EXPECT_FALSE(benchgen::MakeRecordBatchIterator(
+                   benchgen::SuiteId::kTpcds, "catalog_sales", options, &iter)
+                   .ok());
+}
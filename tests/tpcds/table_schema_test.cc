@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/benchmark_suite.h"
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace {
+
+TEST(TableSchemaTest, MatchesInitializedIterator) {
+  for (auto suite_id : {benchgen::SuiteId::kTpch, benchgen::SuiteId::kTpcds,
+                        benchgen::SuiteId::kSsb}) {
+    auto suite = benchgen::MakeBenchmarkSuite(suite_id);
+    ASSERT_NE(suite, nullptr);
+    for (int i = 0; i < suite->table_count(); ++i) {
+      std::string table(suite->TableName(i));
+      benchgen::GeneratorOptions options;
+      // SSB rejects fractional scales.
+      options.scale_factor = suite_id == benchgen::SuiteId::kSsb ? 1.0 : 0.01;
+      options.row_count = 1;
+      std::unique_ptr<benchgen::RecordBatchIterator> iter;
+      auto status = suite->MakeIterator(table, options, &iter);
+      ASSERT_TRUE(status.ok()) << table << ": " << status.ToString();
+
+      std::shared_ptr<arrow::Schema> schema;
+      status = suite->TableSchema(table, options, &schema);
+      ASSERT_TRUE(status.ok()) << table << ": " << status.ToString();
+      EXPECT_TRUE(schema->Equals(*iter->schema())) << table;
+
+      // Projection to the last column, as MakeIterator applies it.
+      options.column_names = {iter->schema()->field(
+          iter->schema()->num_fields() - 1)->name()};
+      status = suite->TableSchema(table, options, &schema);
+      ASSERT_TRUE(status.ok()) << table << ": " << status.ToString();
+      ASSERT_EQ(schema->num_fields(), 1) << table;
+      EXPECT_EQ(schema->field(0)->name(), options.column_names[0]);
+    }
+  }
+}
+
+TEST(TableSchemaTest, NoDataDependentWork) {
+  // store_returns replays the whole sales stream to count its rows; at this
+  // scale that would take hours.
+  benchgen::GeneratorOptions options;
+  options.scale_factor = 100000;
+  const auto started = std::chrono::steady_clock::now();
+  for (const char* table : {"store_sales", "store_returns", "catalog_sales",
+                            "web_returns", "inventory", "item"}) {
+    std::shared_ptr<arrow::Schema> schema;
+    auto status = benchgen::MakeTableSchema(benchgen::SuiteId::kTpcds, table,
+                                            options, &schema);
+    ASSERT_TRUE(status.ok()) << table << ": " << status.ToString();
+    EXPECT_GT(schema->num_fields(), 0);
+  }
+  EXPECT_LT(std::chrono::steady_clock::now() - started,
+            std::chrono::seconds(5));
+}
+
+TEST(TableSchemaTest, InvalidOptionsReturnStatus) {
+  benchgen::GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 0;
+  std::unique_ptr<benchgen::RecordBatchIterator> iter;
+  auto status = benchgen::MakeRecordBatchIterator(
+      benchgen::SuiteId::kTpcds, "store_sales", options, &iter);
+  EXPECT_TRUE(status.IsInvalid()) << status.ToString();
+
+  options.chunk_size = 100;
+  options.column_names = {"no_such_column"};
+  status = benchgen::MakeRecordBatchIterator(
+      benchgen::SuiteId::kTpcds, "web_sales", options, &iter);
+  EXPECT_FALSE(status.ok());
+  std::shared_ptr<arrow::Schema> schema;
+  status = benchgen::MakeTableSchema(benchgen::SuiteId::kTpcds, "web_sales",
+                                     options, &schema);
+  EXPECT_FALSE(status.ok());
+}
+
+}  // namespace
@@ -0,0 +1,86 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/column_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/columns.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+TEST(ColumnProfilerTest, NamesColumnsFromColumnsHeader) {
+  EXPECT_STREQ(ColumnName(CC_CALL_CENTER_SK), "CC_CALL_CENTER_SK");
+  EXPECT_STREQ(ColumnName(SS_PRICING), "SS_PRICING");
+  EXPECT_STREQ(ColumnName(MAX_COLUMN), "S_ZIPG_GMT");
+  EXPECT_STREQ(ColumnName(MAX_COLUMN + 1), "");
+  EXPECT_STREQ(ColumnName(-1), "");
+}
+
+TEST(ColumnProfilerTest, CountsDrawsAndChargesTimeOnTransitions) {
+  ColumnProfiler profiler;
+  {
+    ColumnProfiler::Scope scope(&profiler);
+    EXPECT_EQ(ColumnProfiler::Active(), &profiler);
+    ColumnProfiler::OnDraw(SS_PRICING);
+    ColumnProfiler::OnDraw(SS_PRICING);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ColumnProfiler::OnDraw(SS_NULLS);
+    ColumnProfiler::OnEnter(ColumnProfiler::kRowAssembly);
+  }
+  EXPECT_EQ(ColumnProfiler::Active(), nullptr);
+  // Without an active profiler the hooks are no-ops.
+  ColumnProfiler::OnDraw(SS_PRICING);
+
+  std::vector<ColumnCost> costs = profiler.Costs();
+  ASSERT_GE(costs.size(), 2u);
+  EXPECT_EQ(costs[0].column_id, SS_PRICING);
+  EXPECT_EQ(costs[0].draws, 2);
+  EXPECT_GE(costs[0].nanos, 20 * 1000 * 1000);
+  int64_t nulls_draws = 0;
+  for (const ColumnCost& cost : costs) {
+    if (cost.column_id == SS_NULLS) {
+      nulls_draws = cost.draws;
+    }
+  }
+  EXPECT_EQ(nulls_draws, 1);
+
+  const std::string report = profiler.FormatReport("store_sales", 2);
+  EXPECT_NE(report.find("column profile for store_sales: 2 rows"),
+            std::string::npos);
+  EXPECT_NE(report.find("SS_PRICING"), std::string::npos);
+  EXPECT_LT(report.find("SS_PRICING"), report.find("SS_NULLS"));
+}
+
+TEST(ColumnProfilerTest, ChargesSetupSeparately) {
+  ColumnProfiler profiler;
+  {
+    ColumnProfiler::Scope scope(&profiler, ColumnProfiler::kSetup);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  std::vector<ColumnCost> costs = profiler.Costs();
+  ASSERT_EQ(costs.size(), 1u);
+  EXPECT_EQ(costs[0].column_id, ColumnProfiler::kSetup);
+  EXPECT_NE(profiler.FormatReport("item", 0).find("<setup>"),
+            std::string::npos);
+}
+
+}  // namespace
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/permute.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "utils/column_streams.h"
+#include "utils/columns.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+TEST(PermuteTest, SharedPermutationMatchesFreshStream) {
+  constexpr int kSize = 18000;
+  RandomNumberStream stream(SS_PERMUTATION, SeedsPerRow(SS_PERMUTATION));
+  std::vector<int> expected = MakePermutation(kSize, &stream);
+
+  auto shared = SharedPermutation(SS_PERMUTATION, kSize);
+  ASSERT_NE(shared, nullptr);
+  EXPECT_EQ(*shared, expected);
+}
+
+TEST(PermuteTest, SharedPermutationIsBuiltOncePerKey) {
+  constexpr int kSize = 2000;
+  std::vector<std::shared_ptr<const std::vector<int>>> results(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < results.size(); ++i) {
+    threads.emplace_back([&results, i] {
+      results[i] = SharedPermutation(CS_PERMUTE, kSize);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& result : results) {
+    EXPECT_EQ(result.get(), results.front().get());
+  }
+
+  EXPECT_NE(SharedPermutation(WS_PERMUTATION, kSize).get(),
+            results.front().get());
+  EXPECT_NE(SharedPermutation(CS_PERMUTE, kSize + 1).get(),
+            results.front().get());
+}
+
+}  // namespace
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,118 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "utils/ticket_cursor.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "utils/column_streams.h"
+#include "utils/columns.h"
+#include "utils/constants.h"
+#include "utils/random_utils.h"
+
+namespace benchgen::tpcds::internal {
+namespace {
+
+// Last row of each of the first ticket_count tickets, replayed from the start.
+std::vector<int64_t> TicketEndRows(int column_id, int min_items, int max_items,
+                                   int ticket_count) {
+  RandomNumberStream stream(column_id, SeedsPerRow(column_id));
+  std::vector<int64_t> ends;
+  int64_t end = 0;
+  for (int i = 0; i < ticket_count; ++i) {
+    end += GenerateUniformRandomInt(min_items, max_items, &stream);
+    while (stream.seeds_used() < stream.seeds_per_row()) {
+      GenerateUniformRandomInt(1, 100, &stream);
+    }
+    stream.ResetSeedsUsed();
+    ends.push_back(end);
+  }
+  return ends;
+}
+
+TEST(TicketCursorTest, MatchesReplayFromFirstTicket) {
+  constexpr int kTickets = 500;
+  std::vector<int64_t> ends = TicketEndRows(CS_ORDER_NUMBER, 4, 14, kTickets);
+  TicketCursor cursor(CS_ORDER_NUMBER, 4, 14);
+  // Forward, within one ticket, and backward moves.
+  for (int64_t row : {1, 2, 40, 40, 41, 999, 17, 1, 2500}) {
+    SCOPED_TRACE(row);
+    cursor.MoveTo(row);
+    int64_t ticket = 0;
+    while (ends[ticket] < row) {
+      ++ticket;
+    }
+    EXPECT_EQ(cursor.order_number(), ticket + 1);
+    EXPECT_EQ(cursor.ticket_end_row(), ends[ticket]);
+    EXPECT_EQ(cursor.ticket_start_row(),
+              ticket == 0 ? 1 : ends[ticket - 1] + 1);
+    EXPECT_EQ(cursor.prev_order_number(), ticket);
+    EXPECT_EQ(cursor.prev_ticket_start_row(),
+              ticket <= 1 ? 1 : ends[ticket - 2] + 1);
+  }
+}
+
+TEST(TicketCursorTest, IncreasingMovesDrawEachTicketOnce) {
+  TicketCursor cursor(SS_TICKET_NUMBER, 8, 16);
+  // A sparse sample: one row every ~1000 over 1M rows.
+  for (int64_t row = 1; row <= 1000000; row += 997) {
+    cursor.MoveTo(row);
+  }
+  // A replay per move would draw ~1000 times as many tickets.
+  EXPECT_EQ(cursor.tickets_drawn(), cursor.order_number());
+  EXPECT_LT(cursor.tickets_drawn(), 1000000 / 8 + 1);
+}
+
+TEST(ReturnTicketCursorTest, CountsReturnsPerTicket) {
+  constexpr int kTickets = 300;
+  std::vector<int64_t> ends = TicketEndRows(WS_ORDER_NUMBER, 8, 16, kTickets);
+  RandomNumberStream returned(WR_IS_RETURNED, SeedsPerRow(WR_IS_RETURNED));
+  std::vector<int> returns;
+  for (int i = 0; i < kTickets; ++i) {
+    int64_t items = ends[i] - (i == 0 ? 0 : ends[i - 1]);
+    int count = 0;
+    for (int64_t item = 0; item < items; ++item) {
+      if (GenerateUniformRandomInt(0, 99, &returned) < WR_RETURN_PCT) {
+        ++count;
+      }
+    }
+    while (returned.seeds_used() < returned.seeds_per_row()) {
+      GenerateUniformRandomInt(1, 100, &returned);
+    }
+    returned.ResetSeedsUsed();
+    returns.push_back(count);
+  }
+
+  ReturnTicketCursor cursor(WS_ORDER_NUMBER, 8, 16, WR_IS_RETURNED,
+                            WR_RETURN_PCT);
+  for (int64_t order_count : {0, 1, 150, 150, 299, 20}) {
+    SCOPED_TRACE(order_count);
+    cursor.MoveTo(order_count);
+    EXPECT_EQ(cursor.order_count(), order_count);
+    EXPECT_EQ(cursor.sales_rows(),
+              order_count == 0 ? 0 : ends[order_count - 1]);
+    EXPECT_EQ(cursor.next_returns(), returns[order_count]);
+    // Peeking does not move the cursor.
+    EXPECT_EQ(cursor.next_returns(), returns[order_count]);
+  }
+  cursor.Advance();
+  EXPECT_EQ(cursor.order_count(), 21);
+  EXPECT_EQ(cursor.next_returns(), returns[21]);
+}
+
+}  // namespace
+}  // namespace benchgen::tpcds::internal
@@ -0,0 +1,113 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "util/async_file_writer.h"
+
+namespace benchgen::tpch {
+namespace {
+
+namespace fs = std::filesystem;
+
+std::string ReadFile(const fs::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(in)),
+                     std::istreambuf_iterator<char>());
+}
+
+// Writes lines of varying length so buffer boundaries fall mid-line and the
+// tail is not aligned.
+std::string WriteThrough(const fs::path& path,
+                         const internal::AsyncFileWriterOptions& options,
+                         internal::FileWriteBackend* used) {
+  std::unique_ptr<internal::AsyncFileWriter> writer;
+  auto status = internal::AsyncFileWriter::Open(path.string(), options,
+                                                &writer);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  if (!status.ok()) {
+    return {};
+  }
+  std::string expected;
+  std::ostream out(writer.get());
+  for (int i = 0; i < 5000; ++i) {
+    std::string line = std::to_string(i) + "|" + std::string(i % 37, 'x') +
+                       "|\n";
+    out << line;
+    expected += line;
+  }
+  EXPECT_TRUE(out.good());
+  status = writer->Close();
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  *used = writer->backend();
+  return expected;
+}
+
+}  // namespace
+
+TEST(AsyncFileWriterTest, BackendsWriteIdenticalFiles) {
+  fs::path root = fs::temp_directory_path() / "benchgen_async_writer_test";
+  fs::remove_all(root);
+  fs::create_directories(root);
+
+  for (auto backend : {internal::FileWriteBackend::kPwrite,
+                       internal::FileWriteBackend::kIoUring}) {
+    for (bool direct_io : {false, true}) {
+      internal::AsyncFileWriterOptions options;
+      options.backend = backend;
+      options.direct_io = direct_io;
+      options.buffer_bytes = 5000;  // rounded up to 8192
+      options.queue_depth = 3;
+      fs::path path = root / "out.tbl";
+      internal::FileWriteBackend used = backend;
+      std::string expected = WriteThrough(path, options, &used);
+      EXPECT_EQ(ReadFile(path), expected)
+          << internal::FileWriteBackendToString(backend)
+          << (direct_io ? " direct" : "");
+      if (backend == internal::FileWriteBackend::kPwrite) {
+        EXPECT_EQ(used, internal::FileWriteBackend::kPwrite);
+      }
+    }
+  }
+
+  // An empty file is still created and truncated.
+  {
+    std::ofstream(root / "empty.tbl") << "stale";
+    std::unique_ptr<internal::AsyncFileWriter> writer;
+    ASSERT_TRUE(internal::AsyncFileWriter::Open((root / "empty.tbl").string(),
+                                                {}, &writer)
+                    .ok());
+    ASSERT_TRUE(writer->Close().ok());
+    EXPECT_EQ(fs::file_size(root / "empty.tbl"), 0u);
+  }
+  fs::remove_all(root);
+}
+
+TEST(AsyncFileWriterTest, ParsesBackendNames) {
+  internal::FileWriteBackend backend;
+  ASSERT_TRUE(internal::ParseFileWriteBackend("io_uring", &backend));
+  EXPECT_EQ(backend, internal::FileWriteBackend::kIoUring);
+  ASSERT_TRUE(internal::ParseFileWriteBackend("pwrite", &backend));
+  EXPECT_EQ(backend, internal::FileWriteBackend::kPwrite);
+  EXPECT_FALSE(internal::ParseFileWriteBackend("aio", &backend));
+}
+
+}  // namespace benchgen::tpch
@@ -0,0 +1,197 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "util/columnar_raw_sink.h"
+
+namespace benchgen::tpch {
+namespace {
+
+namespace fs = std::filesystem;
+
+std::string ReadFile(const fs::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  std::ostringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+template <typename T>
+std::vector<T> ReadValues(const fs::path& path) {
+  std::string bytes = ReadFile(path);
+  std::vector<T> values(bytes.size() / sizeof(T));
+  std::memcpy(values.data(), bytes.data(), values.size() * sizeof(T));
+  return values;
+}
+
+bool BitSet(const std::string& bitmap, int64_t i) {
+  return (static_cast<uint8_t>(bitmap[i / 8]) >> (i % 8)) & 1;
+}
+
+std::shared_ptr<arrow::Schema> MakeSchema() {
+  return arrow::schema({arrow::field("id", arrow::int64(), false),
+                        arrow::field("name", arrow::utf8(), true),
+                        arrow::field("price", arrow::decimal128(15, 2), false),
+                        arrow::field("flag", arrow::boolean(), false),
+                        arrow::field("day", arrow::date32(), true)});
+}
+
+// Rows [first, first + count): names and days are null on every third row.
+std::shared_ptr<arrow::RecordBatch> MakeBatch(
+    const std::shared_ptr<arrow::Schema>& schema, int64_t first,
+    int64_t count) {
+  arrow::Int64Builder id;
+  arrow::StringBuilder name;
+  arrow::Decimal128Builder price(arrow::decimal128(15, 2));
+  arrow::BooleanBuilder flag;
+  arrow::Date32Builder day;
+  for (int64_t i = first; i < first + count; ++i) {
+    EXPECT_TRUE(id.Append(i).ok());
+    EXPECT_TRUE(price.Append(arrow::Decimal128(i * 100 + 5)).ok());
+    EXPECT_TRUE(flag.Append(i % 2 == 0).ok());
+    if (i % 3 == 0) {
+      EXPECT_TRUE(name.AppendNull().ok());
+      EXPECT_TRUE(day.AppendNull().ok());
+    } else {
+      EXPECT_TRUE(name.Append("n" + std::to_string(i)).ok());
+      EXPECT_TRUE(day.Append(static_cast<int32_t>(i)).ok());
+    }
+  }
+  std::vector<std::shared_ptr<arrow::Array>> arrays(5);
+  EXPECT_TRUE(id.Finish(&arrays[0]).ok());
+  EXPECT_TRUE(name.Finish(&arrays[1]).ok());
+  EXPECT_TRUE(price.Finish(&arrays[2]).ok());
+  EXPECT_TRUE(flag.Finish(&arrays[3]).ok());
+  EXPECT_TRUE(day.Finish(&arrays[4]).ok());
+  return arrow::RecordBatch::Make(schema, count, arrays);
+}
+
+}  // namespace
+
+TEST(ColumnarRawSinkTest, WritesColumnFilesAcrossBatches) {
+  fs::path root = fs::temp_directory_path() / "benchgen_columnar_raw_test";
+  fs::remove_all(root);
+
+  auto schema = MakeSchema();
+  std::unique_ptr<internal::ColumnarRawSink> sink;
+  ASSERT_TRUE(
+      internal::ColumnarRawSink::Open(root.string(), schema, &sink).ok());
+  // Batch sizes that leave validity bits straddling byte boundaries.
+  const int64_t sizes[] = {5, 0, 7, 11};
+  int64_t rows = 0;
+  for (int64_t size : sizes) {
+    ASSERT_TRUE(sink->Write(MakeBatch(schema, rows, size)).ok());
+    rows += size;
+  }
+  ASSERT_TRUE(sink->Close().ok());
+  EXPECT_EQ(sink->rows(), rows);
+
+  auto ids = ReadValues<int64_t>(root / "id.data");
+  auto offsets = ReadValues<int64_t>(root / "name.offsets");
+  std::string names = ReadFile(root / "name.data");
+  std::string name_validity = ReadFile(root / "name.validity");
+  auto prices = ReadValues<int64_t>(root / "price.data");
+  std::string flags = ReadFile(root / "flag.data");
+  auto days = ReadValues<int32_t>(root / "day.data");
+  std::string day_validity = ReadFile(root / "day.validity");
+
+  ASSERT_EQ(static_cast<int64_t>(ids.size()), rows);
+  ASSERT_EQ(static_cast<int64_t>(offsets.size()), rows + 1);
+  ASSERT_EQ(static_cast<int64_t>(prices.size()), 2 * rows);
+  ASSERT_EQ(static_cast<int64_t>(flags.size()), rows);
+  ASSERT_EQ(static_cast<int64_t>(days.size()), rows);
+  ASSERT_EQ(static_cast<int64_t>(name_validity.size()), (rows + 7) / 8);
+  ASSERT_EQ(day_validity, name_validity);
+  EXPECT_EQ(offsets[0], 0);
+  EXPECT_EQ(offsets[rows], static_cast<int64_t>(names.size()));
+  for (int64_t i = 0; i < rows; ++i) {
+    SCOPED_TRACE(i);
+    EXPECT_EQ(ids[i], i);
+    EXPECT_EQ(prices[2 * i], i * 100 + 5);
+    EXPECT_EQ(prices[2 * i + 1], 0);
+    EXPECT_EQ(flags[i], i % 2 == 0 ? 1 : 0);
+    bool valid = i % 3 != 0;
+    EXPECT_EQ(BitSet(name_validity, i), valid);
+    std::string name = names.substr(offsets[i], offsets[i + 1] - offsets[i]);
+    EXPECT_EQ(name, valid ? "n" + std::to_string(i) : "");
+    if (valid) {
+      EXPECT_EQ(days[i], i);
+    }
+  }
+  EXPECT_FALSE(fs::exists(root / "id.validity"));
+
+  std::string header = ReadFile(root / "schema.json");
+  EXPECT_NE(header.find("\"num_rows\": " + std::to_string(rows)),
+            std::string::npos);
+  EXPECT_NE(header.find("\"offsets\": \"name.offsets\""), std::string::npos);
+  EXPECT_NE(header.find("\"type\": \"decimal128(15, 2)\""),
+            std::string::npos);
+
+  fs::remove_all(root);
+}
+
+TEST(ColumnarRawSinkTest, RejectsNullsInNonNullableColumns) {
+  fs::path root = fs::temp_directory_path() / "benchgen_columnar_raw_nulls";
+  fs::remove_all(root);
+
+  auto schema = arrow::schema({arrow::field("id", arrow::int64(), false)});
+  std::unique_ptr<internal::ColumnarRawSink> sink;
+  ASSERT_TRUE(
+      internal::ColumnarRawSink::Open(root.string(), schema, &sink).ok());
+  arrow::Int64Builder builder;
+  ASSERT_TRUE(builder.Append(1).ok());
+  ASSERT_TRUE(builder.AppendNull().ok());
+  std::shared_ptr<arrow::Array> array;
+  ASSERT_TRUE(builder.Finish(&array).ok());
+  arrow::Status status =
+      sink->Write(arrow::RecordBatch::Make(schema, 2, {array}));
+  EXPECT_TRUE(status.IsInvalid()) << status.ToString();
+  EXPECT_TRUE(sink->Close().ok());
+
+  fs::remove_all(root);
+}
+
+TEST(ColumnarRawSinkTest, RefusesNonEmptyDirectory) {
+  fs::path root = fs::temp_directory_path() / "benchgen_columnar_raw_reuse";
+  fs::remove_all(root);
+
+  auto schema = arrow::schema({arrow::field("id", arrow::int64(), false)});
+  std::unique_ptr<internal::ColumnarRawSink> sink;
+  ASSERT_TRUE(
+      internal::ColumnarRawSink::Open(root.string(), schema, &sink).ok());
+  ASSERT_TRUE(sink->Close().ok());
+  ASSERT_TRUE(fs::exists(root / "schema.json"));
+
+  // A second dump must not leave the first one's schema.json behind.
+  sink.reset();
+  arrow::Status status =
+      internal::ColumnarRawSink::Open(root.string(), schema, &sink);
+  EXPECT_TRUE(status.IsInvalid()) << status.ToString();
+  EXPECT_EQ(sink, nullptr);
+
+  fs::remove_all(root);
+}
+
+}  // namespace benchgen::tpch
@@ -0,0 +1,211 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <arrow/io/file.h>
+#include <arrow/ipc/reader.h>
+
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+#include "benchgen/record_batch_sink.h"
+#include "util/checksum_sink.h"
+#include "util/fan_out_sink.h"
+#include "util/generation_manifest.h"
+#include "util/ipc_file_sink.h"
+
+namespace benchgen::tpch {
+namespace {
+
+namespace fs = std::filesystem;
+
+// Counts batches on the drain thread and fails from the given batch on.
+class CountingSink final : public internal::RecordBatchSink {
+ public:
+  CountingSink(std::atomic<int64_t>* rows, int fail_at)
+      : rows_(rows), fail_at_(fail_at) {}
+
+  arrow::Status Write(
+      const std::shared_ptr<arrow::RecordBatch>& batch) override {
+    if (fail_at_ >= 0 && batches_++ >= fail_at_) {
+      return arrow::Status::IOError("disk full");
+    }
+    *rows_ += batch->num_rows();
+    return arrow::Status::OK();
+  }
+  arrow::Status Close() override { return arrow::Status::OK(); }
+
+ private:
+  std::atomic<int64_t>* rows_;
+  int fail_at_;
+  int batches_ = 0;
+};
+
+std::unique_ptr<RecordBatchIterator> MakeOrders() {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 1000;
+  std::unique_ptr<RecordBatchIterator> iter;
+  auto status =
+      MakeRecordBatchIterator(SuiteId::kTpch, "orders", options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  return iter;
+}
+
+}  // namespace
+
+TEST(FanOutSinkTest, EverySinkSeesEveryBatch) {
+  fs::path root = fs::temp_directory_path() / "benchgen_fan_out_sink_test";
+  fs::remove_all(root);
+  fs::create_directories(root);
+  const std::string text_path = (root / "orders.tbl").string();
+  const std::string ipc_path = (root / "orders.arrow").string();
+
+  auto iter = MakeOrders();
+  ASSERT_NE(iter, nullptr);
+  std::vector<std::unique_ptr<internal::RecordBatchSink>> sinks;
+  std::unique_ptr<internal::FileRecordBatchSink> text;
+  ASSERT_TRUE(internal::FileRecordBatchSink::Open(
+                  text_path, internal::RecordBatchWriterFormat::kTpch, &text)
+                  .ok());
+  sinks.push_back(std::move(text));
+  std::unique_ptr<internal::ArrowIpcFileSink> ipc;
+  ASSERT_TRUE(
+      internal::ArrowIpcFileSink::Open(ipc_path, iter->schema(), &ipc).ok());
+  sinks.push_back(std::move(ipc));
+  auto checksum = std::make_unique<internal::ChecksumSink>(
+      internal::RecordBatchWriterFormat::kTpch);
+  const internal::ChecksumSink* checksum_ptr = checksum.get();
+  sinks.push_back(std::move(checksum));
+
+  internal::FanOutSink fan_out(std::move(sinks), 2);
+  std::shared_ptr<arrow::RecordBatch> batch;
+  int64_t rows = 0;
+  while (true) {
+    ASSERT_TRUE(iter->Next(&batch).ok());
+    if (!batch) {
+      break;
+    }
+    rows += batch->num_rows();
+    ASSERT_TRUE(fan_out.Write(batch).ok());
+  }
+  ASSERT_TRUE(fan_out.Close().ok());
+  EXPECT_EQ(rows, 15000);
+
+  // The checksum equals that of the text file it did not write.
+  int64_t bytes = 0;
+  uint32_t crc32 = 0;
+  ASSERT_TRUE(internal::ChecksumFile(text_path, &bytes, &crc32).ok());
+  EXPECT_EQ(checksum_ptr->rows(), rows);
+  EXPECT_EQ(checksum_ptr->bytes(), bytes);
+  EXPECT_EQ(checksum_ptr->crc32(), crc32);
+
+  auto file = arrow::io::ReadableFile::Open(ipc_path);
+  ASSERT_TRUE(file.ok());
+  auto reader = arrow::ipc::RecordBatchFileReader::Open(*file);
+  ASSERT_TRUE(reader.ok()) << reader.status().ToString();
+  int64_t ipc_rows = 0;
+  for (int i = 0; i < (*reader)->num_record_batches(); ++i) {
+    auto read = (*reader)->ReadRecordBatch(i);
+    ASSERT_TRUE(read.ok());
+    ipc_rows += (*read)->num_rows();
+  }
+  EXPECT_EQ(ipc_rows, rows);
+  EXPECT_TRUE((*reader)->schema()->Equals(*iter->schema()));
+
+  fs::remove_all(root);
+}
+
+TEST(FanOutSinkTest, ReportsSinkErrors) {
+  auto iter = MakeOrders();
+  ASSERT_NE(iter, nullptr);
+  std::atomic<int64_t> good_rows(0);
+  std::atomic<int64_t> bad_rows(0);
+  std::vector<std::unique_ptr<internal::RecordBatchSink>> sinks;
+  sinks.push_back(std::make_unique<CountingSink>(&good_rows, -1));
+  sinks.push_back(std::make_unique<CountingSink>(&bad_rows, 3));
+  internal::FanOutSink fan_out(std::move(sinks), 1);
+
+  std::shared_ptr<arrow::RecordBatch> batch;
+  arrow::Status status;
+  while (status.ok()) {
+    ASSERT_TRUE(iter->Next(&batch).ok());
+    if (!batch) {
+      break;
+    }
+    status = fan_out.Write(batch);
+  }
+  arrow::Status close_status = fan_out.Close();
+  EXPECT_FALSE(status.ok() && close_status.ok());
+  EXPECT_TRUE(close_status.IsIOError()) << close_status.ToString();
+  EXPECT_EQ(bad_rows.load(), 3000);
+}
+
+// The public factories, with a caller-defined sink alongside the library's.
+TEST(FanOutSinkTest, PublicFactoriesWriteEverySink) {
+  fs::path root = fs::temp_directory_path() / "benchgen_fan_out_public_test";
+  fs::remove_all(root);
+  fs::create_directories(root);
+  const std::string text_path = (root / "orders.tbl").string();
+  const std::string ipc_path = (root / "orders.arrow").string();
+
+  auto iter = MakeOrders();
+  ASSERT_NE(iter, nullptr);
+  std::atomic<int64_t> counted_rows(0);
+  std::vector<std::unique_ptr<RecordBatchSink>> sinks;
+  std::unique_ptr<RecordBatchSink> sink;
+  ASSERT_TRUE(MakeTextFileSink(SuiteId::kTpch, text_path, &sink).ok());
+  sinks.push_back(std::move(sink));
+  ASSERT_TRUE(MakeArrowIpcFileSink(ipc_path, iter->schema(), &sink).ok());
+  sinks.push_back(std::move(sink));
+  sinks.push_back(std::make_unique<CountingSink>(&counted_rows, -1));
+
+  std::unique_ptr<RecordBatchSink> fan_out =
+      MakeFanOutSink(std::move(sinks), 2);
+  std::shared_ptr<arrow::RecordBatch> batch;
+  int64_t rows = 0;
+  while (true) {
+    ASSERT_TRUE(iter->Next(&batch).ok());
+    if (!batch) {
+      break;
+    }
+    rows += batch->num_rows();
+    ASSERT_TRUE(fan_out->Write(batch).ok());
+  }
+  ASSERT_TRUE(fan_out->Close().ok());
+  EXPECT_EQ(counted_rows.load(), rows);
+
+  int64_t bytes = 0;
+  uint32_t crc32 = 0;
+  ASSERT_TRUE(internal::ChecksumFile(text_path, &bytes, &crc32).ok());
+  EXPECT_GT(bytes, 0);
+  auto file = arrow::io::ReadableFile::Open(ipc_path);
+  ASSERT_TRUE(file.ok());
+  auto reader = arrow::ipc::RecordBatchFileReader::Open(*file);
+  ASSERT_TRUE(reader.ok()) << reader.status().ToString();
+  EXPECT_TRUE((*reader)->schema()->Equals(*iter->schema()));
+
+  std::unique_ptr<RecordBatchSink> bad;
+  EXPECT_FALSE(MakeTextFileSink(SuiteId::kUnknown, text_path, &bad).ok());
+
+  fs::remove_all(root);
+}
+
+}  // namespace benchgen::tpch
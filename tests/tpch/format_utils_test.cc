@@ -0,0 +1,61 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "utils/constants.h"
+#include "utils/random.h"
+#include "utils/utils.h"
+
+namespace benchgen::tpch::internal {
+namespace {
+
+TEST(FormatUtilsTest, FormatTagNumberPadsToWidth) {
+  std::string out;
+  FormatTagNumber(kCNameTag, 9, 1, &out);
+  EXPECT_EQ(out, "Customer#000000001");
+  FormatTagNumber(kPMfgTag, 1, 5, &out);
+  EXPECT_EQ(out, "Manufacturer#5");
+  FormatTagNumber(kPBrndTag, 2, 3, &out);
+  EXPECT_EQ(out, "Brand#03");
+  FormatTagNumber(kSNameTag, 9, 0, &out);
+  EXPECT_EQ(out, "Supplier#000000000");
+}
+
+TEST(FormatUtilsTest, FormatTagNumberKeepsWideNumbers) {
+  std::string out;
+  FormatTagNumber(kCNameTag, 9, 15000000000LL, &out);
+  EXPECT_EQ(out, "Customer#15000000000");
+  FormatTagNumber(kPBrndTag, 2, 123, &out);
+  EXPECT_EQ(out, "Brand#123");
+}
+
+TEST(FormatUtilsTest, GeneratePhoneLayout) {
+  RandomState rng;
+  rng.Reset();
+  std::string phone = "stale contents that are longer than a phone number";
+  GeneratePhone(7, kCPhneSd, &rng, &phone);
+  ASSERT_EQ(phone.size(), static_cast<size_t>(kPhoneLen));
+  EXPECT_EQ(phone.substr(0, 3), "17-");
+  EXPECT_EQ(phone[6], '-');
+  EXPECT_EQ(phone[10], '-');
+  for (size_t i : {3, 4, 5, 7, 8, 9, 11, 12, 13, 14}) {
+    EXPECT_TRUE(phone[i] >= '0' && phone[i] <= '9') << phone;
+  }
+}
+
+}  // namespace
+}  // namespace benchgen::tpch::internal
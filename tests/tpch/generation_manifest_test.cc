@@ -0,0 +1,135 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "util/generation_manifest.h"
+
+namespace benchgen::tpch {
+namespace {
+
+namespace fs = std::filesystem;
+
+internal::GenerationManifest MakeNode(int64_t node_index, int64_t node_count,
+                                      int64_t start_row, int64_t row_count) {
+  internal::GenerationManifest manifest;
+  manifest.benchmark = "tpch";
+  manifest.table = "lineitem";
+  manifest.scale_factor = 0.01;
+  manifest.node_index = node_index;
+  manifest.node_count = node_count;
+  manifest.total_rows = 60012;
+  internal::ManifestRange range;
+  range.start_row = start_row;
+  range.row_count = row_count;
+  manifest.ranges.push_back(range);
+  return manifest;
+}
+
+}  // namespace
+
+TEST(GenerationManifestTest, CoverageAcceptsExactTiling) {
+  std::vector<internal::GenerationManifest> manifests = {
+      MakeNode(1, 3, 20004, 20004), MakeNode(0, 3, 0, 20004),
+      MakeNode(2, 3, 40008, -1)};
+  auto status = internal::VerifyManifestCoverage(manifests);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+
+  internal::GenerationManifest merged = internal::MergeManifests(manifests);
+  EXPECT_EQ(merged.node_count, 1);
+  ASSERT_EQ(merged.ranges.size(), 3u);
+  EXPECT_EQ(merged.ranges[0].start_row, 0);
+  EXPECT_TRUE(internal::VerifyManifestCoverage({merged}).ok());
+}
+
+TEST(GenerationManifestTest, CoverageRejectsGapsOverlapsAndDuplicates) {
+  EXPECT_FALSE(internal::VerifyManifestCoverage(
+                   {MakeNode(0, 2, 0, 20000), MakeNode(1, 2, 20004, -1)})
+                   .ok());
+  EXPECT_FALSE(internal::VerifyManifestCoverage(
+                   {MakeNode(0, 2, 0, 30000), MakeNode(1, 2, 20004, -1)})
+                   .ok());
+  EXPECT_FALSE(internal::VerifyManifestCoverage(
+                   {MakeNode(0, 2, 0, 20004), MakeNode(0, 2, 20004, -1)})
+                   .ok());
+  EXPECT_FALSE(
+      internal::VerifyManifestCoverage({MakeNode(0, 2, 0, 20004)}).ok());
+  // Without an open-ended tail, bounded ranges must reach total_rows.
+  EXPECT_TRUE(internal::VerifyManifestCoverage(
+                  {MakeNode(0, 2, 0, 30006), MakeNode(1, 2, 30006, 30006)})
+                  .ok());
+
+  internal::GenerationManifest other_scale = MakeNode(1, 2, 20004, -1);
+  other_scale.scale_factor = 0.1;
+  EXPECT_FALSE(internal::VerifyManifestCoverage(
+                   {MakeNode(0, 2, 0, 20004), other_scale})
+                   .ok());
+}
+
+TEST(GenerationManifestTest, RoundTripsWithRelativePathsAndChecksums) {
+  fs::path root = fs::temp_directory_path() / "benchgen_manifest_test";
+  fs::remove_all(root);
+  fs::create_directories(root / "data");
+  const std::string data_path = (root / "data" / "lineitem-0.tbl").string();
+  {
+    std::ofstream out(data_path, std::ios::binary);
+    out << "123456789";
+  }
+
+  internal::GenerationManifest manifest = MakeNode(0, 1, 0, -1);
+  internal::ManifestFile file;
+  file.path = data_path;
+  file.row_count = 1;
+  ASSERT_TRUE(
+      internal::ChecksumFile(data_path, &file.bytes, &file.crc32).ok());
+  // zlib CRC-32 check value.
+  EXPECT_EQ(file.crc32, 0xcbf43926u);
+  EXPECT_EQ(file.bytes, 9);
+  manifest.ranges[0].files.push_back(file);
+
+  const std::string manifest_path = (root / "manifest.json").string();
+  ASSERT_TRUE(internal::WriteGenerationManifest(manifest_path, manifest).ok());
+  std::ifstream in(manifest_path);
+  std::string text((std::istreambuf_iterator<char>(in)),
+                   std::istreambuf_iterator<char>());
+  EXPECT_NE(text.find("\"path\": \"data/lineitem-0.tbl\""), std::string::npos);
+
+  internal::GenerationManifest read;
+  auto status = internal::ReadGenerationManifest(manifest_path, &read);
+  ASSERT_TRUE(status.ok()) << status.ToString();
+  EXPECT_EQ(read.table, "lineitem");
+  EXPECT_EQ(read.scale_factor, 0.01);
+  EXPECT_EQ(read.total_rows, 60012);
+  ASSERT_EQ(read.ranges.size(), 1u);
+  EXPECT_EQ(read.ranges[0].row_count, -1);
+  ASSERT_EQ(read.ranges[0].files.size(), 1u);
+  EXPECT_EQ(fs::path(read.ranges[0].files[0].path), fs::path(data_path));
+  EXPECT_EQ(read.ranges[0].files[0].crc32, 0xcbf43926u);
+  EXPECT_TRUE(internal::VerifyManifestFiles(read).ok());
+
+  {
+    std::ofstream out(data_path, std::ios::binary);
+    out << "123456780";
+  }
+  EXPECT_FALSE(internal::VerifyManifestFiles(read).ok());
+  fs::remove_all(root);
+}
+
+}  // namespace benchgen::tpch
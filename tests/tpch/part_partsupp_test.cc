@@ -0,0 +1,140 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace benchgen::tpch {
+namespace {
+
+std::shared_ptr<arrow::Table> GenerateTable(const std::string& table,
+                                            const GeneratorOptions& options) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  auto status =
+      MakeRecordBatchIterator(SuiteId::kTpch, table, options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  if (!status.ok()) {
+    return nullptr;
+  }
+  std::vector<std::shared_ptr<arrow::RecordBatch>> batches;
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    status = iter->Next(&batch);
+    EXPECT_TRUE(status.ok()) << status.ToString();
+    if (!status.ok() || !batch) {
+      break;
+    }
+    batches.push_back(batch);
+  }
+  auto result = arrow::Table::FromRecordBatches(iter->schema(), batches);
+  return result.ok() ? result.ValueOrDie() : nullptr;
+}
+
+std::vector<std::shared_ptr<arrow::Table>> CoGenerate(
+    const std::vector<std::string>& tables, const GeneratorOptions& options) {
+  std::unique_ptr<MultiRecordBatchIterator> iter;
+  auto status = MakeMultiRecordBatchIterator(SuiteId::kTpch, tables, options,
+                                             &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  if (!status.ok()) {
+    return {};
+  }
+  EXPECT_EQ(iter->table_count(), static_cast<int>(tables.size()));
+  // Row windows count parts in either table order.
+  EXPECT_EQ(iter->name(iter->driving_table()), "part");
+  std::vector<std::vector<std::shared_ptr<arrow::RecordBatch>>> batches(
+      tables.size());
+  std::vector<std::shared_ptr<arrow::RecordBatch>> next;
+  while (true) {
+    status = iter->Next(&next);
+    EXPECT_TRUE(status.ok()) << status.ToString();
+    if (!status.ok() || next.empty()) {
+      break;
+    }
+    for (size_t t = 0; t < tables.size(); ++t) {
+      batches[t].push_back(next[t]);
+    }
+  }
+  std::vector<std::shared_ptr<arrow::Table>> out;
+  for (size_t t = 0; t < tables.size(); ++t) {
+    EXPECT_EQ(iter->name(static_cast<int>(t)), tables[t]);
+    auto result = arrow::Table::FromRecordBatches(
+        iter->schema(static_cast<int>(t)), batches[t]);
+    out.push_back(result.ok() ? result.ValueOrDie() : nullptr);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(TpchPartPartSupp, MatchesSeparateGenerators) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 300;
+
+  auto tables = CoGenerate({"part", "partsupp"}, options);
+  ASSERT_EQ(tables.size(), 2u);
+  auto part = GenerateTable("part", options);
+  auto partsupp = GenerateTable("partsupp", options);
+  ASSERT_TRUE(tables[0] && tables[1] && part && partsupp);
+  EXPECT_EQ(tables[0]->num_rows(), 2000);
+  EXPECT_TRUE(tables[0]->Equals(*part));
+  EXPECT_TRUE(tables[1]->Equals(*partsupp));
+}
+
+TEST(TpchPartPartSupp, RowWindowAndTableOrder) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 64;
+  options.start_row = 137;
+  options.row_count = 250;
+
+  auto tables = CoGenerate({"partsupp", "part"}, options);
+  ASSERT_EQ(tables.size(), 2u);
+  ASSERT_TRUE(tables[0] && tables[1]);
+  EXPECT_EQ(tables[1]->num_rows(), 250);
+  EXPECT_EQ(tables[0]->num_rows(), 1000);
+
+  // partsupp row windows count partsupp rows, four per part.
+  auto part = GenerateTable("part", options);
+  GeneratorOptions partsupp_options = options;
+  partsupp_options.start_row = options.start_row * 4;
+  partsupp_options.row_count = options.row_count * 4;
+  auto partsupp = GenerateTable("partsupp", partsupp_options);
+  ASSERT_TRUE(part && partsupp);
+  EXPECT_TRUE(tables[1]->Equals(*part));
+  EXPECT_TRUE(tables[0]->Equals(*partsupp));
+}
+
+TEST(TpchPartPartSupp, RejectsUnsupportedTables) {
+  GeneratorOptions options;
+  std::unique_ptr<MultiRecordBatchIterator> iter;
+  EXPECT_FALSE(MakeMultiRecordBatchIterator(SuiteId::kTpch,
+                                            {"part", "lineitem"}, options,
+                                            &iter)
+                   .ok());
+  options.column_names = {"p_partkey"};
+  EXPECT_FALSE(MakeMultiRecordBatchIterator(SuiteId::kTpch,
+                                            {"part", "partsupp"}, options,
+                                            &iter)
+                   .ok());
+}
+
+}  // namespace benchgen::tpch
@@ -0,0 +1,122 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+#include "util/partitioned_file_sink.h"
+#include "util/record_batch_sink.h"
+
+namespace benchgen::tpch {
+namespace {
+
+namespace fs = std::filesystem;
+
+std::vector<std::string> SplitLines(const std::string& text) {
+  std::vector<std::string> lines;
+  std::istringstream in(text);
+  std::string line;
+  while (std::getline(in, line)) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+std::string ReadFile(const fs::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  std::ostringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+arrow::Status GenerateInto(internal::RecordBatchSink* sink) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 1000;
+  std::unique_ptr<RecordBatchIterator> iter;
+  ARROW_RETURN_NOT_OK(
+      MakeRecordBatchIterator(SuiteId::kTpch, "orders", options, &iter));
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    ARROW_RETURN_NOT_OK(iter->Next(&batch));
+    if (!batch) {
+      break;
+    }
+    ARROW_RETURN_NOT_OK(sink->Write(batch));
+  }
+  return sink->Close();
+}
+
+}  // namespace
+
+TEST(PartitionedOutputTest, OrdersByYearMatchesSingleFile) {
+  std::ostringstream single;
+  internal::StreamRecordBatchSink stream_sink(
+      &single, internal::RecordBatchWriterFormat::kTpch);
+  ASSERT_TRUE(GenerateInto(&stream_sink).ok());
+  std::vector<std::string> expected = SplitLines(single.str());
+
+  fs::path root = fs::temp_directory_path() / "benchgen_partitioned_test";
+  fs::remove_all(root);
+  internal::PartitionSpec spec;
+  ASSERT_TRUE(internal::PartitionSpec::Parse("o_orderdate:year", &spec).ok());
+  // Two handles and a tiny buffer force evictions and reopen-for-append.
+  internal::PartitionedFileSink sink(root.string(), spec, "part-0.tbl",
+                                     internal::RecordBatchWriterFormat::kTpch,
+                                     /*max_open_files=*/2,
+                                     /*max_buffered_bytes=*/4096);
+  auto status = GenerateInto(&sink);
+  ASSERT_TRUE(status.ok()) << status.ToString();
+
+  std::vector<std::string> actual;
+  int partitions = 0;
+  for (const auto& entry : fs::directory_iterator(root)) {
+    std::string dir = entry.path().filename().string();
+    ASSERT_EQ(dir.rfind("o_orderdate=", 0), 0u) << dir;
+    std::string year = dir.substr(std::string("o_orderdate=").size());
+    ++partitions;
+    for (const auto& line : SplitLines(ReadFile(entry.path() / "part-0.tbl"))) {
+      // o_orderdate is the fifth field.
+      size_t pos = 0;
+      for (int field = 0; field < 4; ++field) {
+        pos = line.find('|', pos) + 1;
+      }
+      EXPECT_EQ(line.substr(pos, 4), year);
+      actual.push_back(line);
+    }
+  }
+  EXPECT_EQ(partitions, 7);
+
+  std::sort(expected.begin(), expected.end());
+  std::sort(actual.begin(), actual.end());
+  EXPECT_EQ(actual, expected);
+  fs::remove_all(root);
+}
+
+TEST(PartitionedOutputTest, RejectsUnknownTransform) {
+  internal::PartitionSpec spec;
+  EXPECT_FALSE(internal::PartitionSpec::Parse("o_orderdate:week", &spec).ok());
+  EXPECT_FALSE(internal::PartitionSpec::Parse(":year", &spec).ok());
+}
+
+}  // namespace benchgen::tpch
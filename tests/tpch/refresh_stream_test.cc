@@ -0,0 +1,120 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+
+namespace benchgen::tpch {
+namespace {
+
+std::vector<std::vector<std::string>> CollectRows(
+    const std::string& table, const GeneratorOptions& options) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  auto status = MakeRecordBatchIterator(SuiteId::kTpch, table, options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  std::vector<std::vector<std::string>> rows;
+  if (!status.ok()) {
+    return rows;
+  }
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (iter->Next(&batch).ok() && batch) {
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      std::vector<std::string> values;
+      for (int col = 0; col < batch->num_columns(); ++col) {
+        values.push_back(
+            batch->column(col)->GetScalar(row).ValueOrDie()->ToString());
+      }
+      rows.push_back(std::move(values));
+    }
+  }
+  return rows;
+}
+
+GeneratorOptions StreamOptions(int32_t stream) {
+  GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.chunk_size = 500;
+  options.refresh_stream = stream;
+  return options;
+}
+
+}  // namespace
+
+// dbgen -U draws stream n's orders from the base rows (n - 1) * 1500 ..
+// n * 1500 and moves their keys into sparse key sequence 1 (key + 8), while
+// RF2 deletes the base keys of the same rows.
+TEST(TpchRefreshStream, InsertsReuseBaseRowsWithGapKeys) {
+  GeneratorOptions base_options;
+  base_options.scale_factor = 1.0;
+  base_options.start_row = 1500;
+  base_options.row_count = 1500;
+  auto base = CollectRows("orders", base_options);
+  auto inserts = CollectRows("orders", StreamOptions(2));
+  auto deletes = CollectRows("delete", StreamOptions(2));
+  ASSERT_EQ(base.size(), 1500u);
+  ASSERT_EQ(inserts.size(), 1500u);
+  ASSERT_EQ(deletes.size(), 1500u);
+  for (size_t i = 0; i < base.size(); ++i) {
+    EXPECT_EQ(deletes[i][0], base[i][0]);
+    EXPECT_EQ(std::stoll(inserts[i][0]), std::stoll(base[i][0]) + 8);
+    EXPECT_EQ(std::vector<std::string>(inserts[i].begin() + 1, inserts[i].end()),
+              std::vector<std::string>(base[i].begin() + 1, base[i].end()));
+  }
+}
+
+TEST(TpchRefreshStream, LineItemsFollowInsertedOrders) {
+  auto orders = CollectRows("orders", StreamOptions(1));
+  auto lines = CollectRows("lineitem", StreamOptions(1));
+  ASSERT_EQ(orders.size(), 1500u);
+  ASSERT_FALSE(lines.empty());
+  size_t order = 0;
+  for (size_t i = 0; i < lines.size(); ++i) {
+    if (lines[i][3] == "1" && i > 0) {
+      ++order;
+    }
+    ASSERT_LT(order, orders.size());
+    EXPECT_EQ(lines[i][0], orders[order][0]);
+  }
+  EXPECT_EQ(order + 1, orders.size());
+
+  GeneratorOptions skip_options = StreamOptions(1);
+  skip_options.start_row = 100;
+  skip_options.row_count = 50;
+  auto skipped = CollectRows("lineitem", skip_options);
+  ASSERT_EQ(skipped.size(), 50u);
+  for (size_t i = 0; i < skipped.size(); ++i) {
+    EXPECT_EQ(skipped[i], lines[i + 100]);
+  }
+}
+
+TEST(TpchRefreshStream, RejectsOtherTables) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  EXPECT_FALSE(MakeRecordBatchIterator(SuiteId::kTpch, "customer",
+                                       StreamOptions(1), &iter)
+                   .ok());
+  EXPECT_FALSE(MakeRecordBatchIterator(SuiteId::kTpch, "delete",
+                                       GeneratorOptions(), &iter)
+                   .ok());
+  EXPECT_FALSE(MakeRecordBatchIterator(SuiteId::kSsb, "lineorder",
+                                       StreamOptions(1), &iter)
+                   .ok());
+}
+
+}  // namespace benchgen::tpch
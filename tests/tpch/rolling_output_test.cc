@@ -0,0 +1,111 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+#include "util/record_batch_sink.h"
+#include "util/rolling_file_sink.h"
+
+namespace benchgen::tpch {
+namespace {
+
+namespace fs = std::filesystem;
+
+std::string ReadFile(const fs::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  std::ostringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+arrow::Status GenerateInto(internal::RecordBatchSink* sink) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 700;
+  options.start_row = 100;
+  std::unique_ptr<RecordBatchIterator> iter;
+  ARROW_RETURN_NOT_OK(
+      MakeRecordBatchIterator(SuiteId::kTpch, "customer", options, &iter));
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    ARROW_RETURN_NOT_OK(iter->Next(&batch));
+    if (!batch) {
+      break;
+    }
+    ARROW_RETURN_NOT_OK(sink->Write(batch));
+  }
+  return sink->Close();
+}
+
+}  // namespace
+
+TEST(RollingOutputTest, CustomerFilesConcatenateToSingleFile) {
+  std::ostringstream single;
+  internal::StreamRecordBatchSink stream_sink(
+      &single, internal::RecordBatchWriterFormat::kTpch);
+  ASSERT_TRUE(GenerateInto(&stream_sink).ok());
+
+  fs::path root = fs::temp_directory_path() / "benchgen_rolling_test";
+  fs::remove_all(root);
+  fs::create_directories(root);
+  const std::string output = (root / "customer.tbl").string();
+  internal::RollingFileSink sink(output, /*worker_index=*/3,
+                                 /*first_row=*/100,
+                                 /*max_file_bytes=*/0,
+                                 /*max_file_rows=*/1000,
+                                 internal::RecordBatchWriterFormat::kTpch);
+  auto status = GenerateInto(&sink);
+  ASSERT_TRUE(status.ok()) << status.ToString();
+
+  // Rows 100..1499 in 700-row batches: a second batch would pass 1000.
+  ASSERT_EQ(sink.files().size(), 2u);
+  std::string concatenated;
+  int64_t next_row = 100;
+  for (size_t i = 0; i < sink.files().size(); ++i) {
+    const auto& file = sink.files()[i];
+    EXPECT_EQ(file.path,
+              internal::RollingFileSink::FilePath(output, 3,
+                                                  static_cast<int64_t>(i)));
+    EXPECT_EQ(file.first_row, next_row);
+    EXPECT_LE(file.row_count, 1000);
+    next_row += file.row_count;
+    std::string data = ReadFile(file.path);
+    EXPECT_EQ(static_cast<int64_t>(data.size()), file.bytes);
+    concatenated += data;
+  }
+  EXPECT_EQ(next_row, 1500);
+  EXPECT_EQ(concatenated, single.str());
+  EXPECT_EQ(fs::path(sink.files()[0].path).filename(), "customer-3-0.tbl");
+
+  std::string manifest =
+      ReadFile(internal::RollingFileSink::ManifestPath(output, 3));
+  EXPECT_EQ(fs::path(internal::RollingFileSink::ManifestPath(output, 3))
+                .filename(),
+            "customer-3.manifest.json");
+  EXPECT_NE(manifest.find("\"complete\": true"), std::string::npos);
+  EXPECT_NE(manifest.find("{\"path\": \"customer-3-1.tbl\", "
+                          "\"first_row\": 800"),
+            std::string::npos);
+  fs::remove_all(root);
+}
+
+}  // namespace benchgen::tpch
@@ -0,0 +1,104 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "util/json.h"
+#include "util/run_stats.h"
+
+namespace benchgen::tpch {
+
+TEST(RunStatsTest, TimedStreambufPassesBytesThrough) {
+  std::ostringstream target;
+  internal::TimedStreambuf timed(target.rdbuf(), 8);
+  std::ostream out(&timed);
+  out << "abc" << 12345 << std::string(20, 'x') << 'z';
+  EXPECT_EQ(timed.bytes(), 29);
+  out.flush();
+  EXPECT_EQ(target.str(), "abc12345" + std::string(20, 'x') + "z");
+  EXPECT_EQ(timed.bytes(), 29);
+  EXPECT_GE(timed.write_seconds(), 0.0);
+}
+
+TEST(RunStatsTest, TimelineStaysBounded) {
+  internal::RunStatsTimeline timeline(1.0);
+  for (int i = 0; i < 5000; ++i) {
+    timeline.Update(i * 0.5, i);
+  }
+  timeline.Finish(2500.0, 5000);
+  EXPECT_LE(timeline.samples().size(),
+            internal::RunStatsTimeline::kMaxSamples + 1);
+  EXPECT_GT(timeline.interval_seconds(), 1.0);
+  EXPECT_EQ(timeline.samples().front().seconds, 0.0);
+  EXPECT_EQ(timeline.samples().back().rows, 5000);
+  for (size_t i = 1; i < timeline.samples().size(); ++i) {
+    EXPECT_LT(timeline.samples()[i - 1].seconds,
+              timeline.samples()[i].seconds);
+  }
+}
+
+TEST(RunStatsTest, WritesParseableReport) {
+  internal::RunStats stats;
+  stats.benchmark = "tpch";
+  stats.table = "lineitem";
+  stats.wall_seconds = 2.0;
+  for (int i = 0; i < 2; ++i) {
+    internal::WorkerStats worker;
+    worker.worker_index = i;
+    worker.rows = 100;
+    worker.bytes = i == 0 ? 1000 : -1;
+    worker.generate_seconds = 0.5;
+    worker.write_timed = i == 0;
+    worker.timeline.Finish(1.5, 100);
+    stats.workers.push_back(worker);
+  }
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "benchgen_run_stats.json")
+          .string();
+  ASSERT_TRUE(internal::WriteRunStats(path, stats).ok());
+  std::ifstream in(path);
+  std::stringstream text;
+  text << in.rdbuf();
+  std::filesystem::remove(path);
+
+  internal::JsonValue root;
+  ASSERT_TRUE(internal::ParseJson(text.str(), &root).ok());
+  EXPECT_EQ(root.Find("rows")->int_value, 200);
+  // One worker without a byte count makes the total unknown.
+  EXPECT_EQ(root.Find("bytes")->int_value, -1);
+  EXPECT_DOUBLE_EQ(root.Find("rows_per_second")->number_value, 100.0);
+  const auto& workers = root.Find("workers")->array_value;
+  ASSERT_EQ(workers.size(), 2u);
+  EXPECT_EQ(workers[0].Find("bytes")->int_value, 1000);
+  const internal::JsonValue* phases = workers[0].Find("phases");
+  ASSERT_NE(phases, nullptr);
+  EXPECT_DOUBLE_EQ(phases->Find("generate_seconds")->number_value, 0.5);
+  EXPECT_TRUE(phases->Find("write_timed")->bool_value);
+  ASSERT_EQ(workers[1].Find("timeline")->array_value.size(), 1u);
+}
+
+TEST(RunStatsTest, FormatsProgressLine) {
+  EXPECT_EQ(internal::FormatProgressLine("tpch.orders", 500, 1000,
+                                         2 * 1024 * 1024, 2.0),
+            "tpch.orders: 500 rows (50.0%), 250 rows/s, 1.0 MiB/s, 2.0 s");
+  EXPECT_EQ(internal::FormatProgressLine("tpcds.item", 10, -1, 0, 1.0),
+            "tpcds.item: 10 rows, 10 rows/s, 1.0 s");
+}
+
+}  // namespace benchgen::tpch
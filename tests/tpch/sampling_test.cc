@@ -0,0 +1,210 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "benchgen/arrow_compat.h"
+#include "benchgen/record_batch_iterator_factory.h"
+#include "util/sampled_record_batch_iterator.h"
+
+namespace benchgen::tpch {
+namespace {
+
+// Returns the first column (the table key) of every generated row.
+std::vector<int64_t> CollectKeys(const char* table,
+                                 const GeneratorOptions& options) {
+  std::unique_ptr<RecordBatchIterator> iter;
+  auto status =
+      MakeRecordBatchIterator(SuiteId::kTpch, table, options, &iter);
+  EXPECT_TRUE(status.ok()) << status.ToString();
+  std::vector<int64_t> keys;
+  if (!status.ok()) {
+    return keys;
+  }
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    status = iter->Next(&batch);
+    EXPECT_TRUE(status.ok()) << status.ToString();
+    if (!status.ok() || batch == nullptr) {
+      break;
+    }
+    auto column = std::static_pointer_cast<arrow::Int64Array>(batch->column(0));
+    for (int64_t row = 0; row < column->length(); ++row) {
+      keys.push_back(column->Value(row));
+    }
+  }
+  return keys;
+}
+
+// Counts the rows an iterator generates and checks that it is only sought
+// forward, so each skip continues from the previous position.
+class CountingIterator final : public RecordBatchIterator {
+ public:
+  explicit CountingIterator(std::unique_ptr<RecordBatchIterator> inner)
+      : inner_(std::move(inner)) {}
+
+  std::string_view name() const override { return inner_->name(); }
+  std::string_view suite_name() const override {
+    return inner_->suite_name();
+  }
+  std::shared_ptr<arrow::Schema> schema() const override {
+    return inner_->schema();
+  }
+  arrow::Status Next(std::shared_ptr<arrow::RecordBatch>* out) override {
+    ARROW_RETURN_NOT_OK(inner_->Next(out));
+    if (*out != nullptr) {
+      generated_rows_ += (*out)->num_rows();
+    }
+    return arrow::Status::OK();
+  }
+  arrow::Status Seek(int64_t start_row, int64_t row_count) override {
+    EXPECT_GE(start_row, last_seek_);
+    last_seek_ = start_row;
+    return inner_->Seek(start_row, row_count);
+  }
+
+  int64_t generated_rows() const { return generated_rows_; }
+
+ private:
+  std::unique_ptr<RecordBatchIterator> inner_;
+  int64_t generated_rows_ = 0;
+  int64_t last_seek_ = 0;
+};
+
+}  // namespace
+
+TEST(TpchSampling, SystematicKeepsEveryKthRow) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 100;
+  options.sample_mode = SampleMode::kSystematic;
+  options.sample_interval = 37;
+  options.sample_seed = 5;
+
+  auto keys = CollectKeys("customer", options);
+  ASSERT_FALSE(keys.empty());
+  // custkey is the 1-based row number.
+  for (size_t i = 0; i < keys.size(); ++i) {
+    EXPECT_EQ(keys[i], 6 + static_cast<int64_t>(i) * 37);
+  }
+  EXPECT_EQ(keys.size(), (1500u - 5u + 36u) / 37u);
+}
+
+TEST(TpchSampling, BernoulliIsRangeIndependent) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 64;
+  options.sample_mode = SampleMode::kBernoulli;
+  options.sample_fraction = 0.05;
+  options.sample_seed = 42;
+
+  auto full = CollectKeys("orders", options);
+  EXPECT_GT(full.size(), 15000u * 3 / 100);
+  EXPECT_LT(full.size(), 15000u * 7 / 100);
+
+  GeneratorOptions first = options;
+  first.row_count = 7000;
+  GeneratorOptions second = options;
+  second.start_row = 7000;
+  auto parts = CollectKeys("orders", first);
+  auto tail = CollectKeys("orders", second);
+  parts.insert(parts.end(), tail.begin(), tail.end());
+  EXPECT_EQ(parts, full);
+}
+
+TEST(TpchSampling, SampledRowsMatchFullGeneration) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 1000;
+  options.row_count = 2000;
+  auto full = CollectKeys("lineitem", options);
+  ASSERT_EQ(full.size(), 2000u);
+
+  options.sample_mode = SampleMode::kSystematic;
+  options.sample_interval = 3;
+  auto sampled = CollectKeys("lineitem", options);
+  ASSERT_EQ(sampled.size(), 667u);
+  for (size_t i = 0; i < sampled.size(); ++i) {
+    EXPECT_EQ(sampled[i], full[i * 3]);
+  }
+}
+
+// lineitem's total is interpolated between the scale 1/5/10 counts; at
+// scale 0.1 it estimates 600,121 rows of 600,572. Sampling must still run
+// to the real end of the table.
+TEST(TpchSampling, RunsPastInterpolatedTotal) {
+  constexpr int64_t kRows = 600572;
+  GeneratorOptions options;
+  options.scale_factor = 0.1;
+  options.chunk_size = 10000;
+  options.start_row = kRows - 1;
+  auto last = CollectKeys("lineitem", options);
+  ASSERT_EQ(last.size(), 1u);
+
+  options.start_row = 0;
+  options.sample_mode = SampleMode::kSystematic;
+  options.sample_interval = 100;
+  options.sample_seed = (kRows - 1) % 100;
+  auto sampled = CollectKeys("lineitem", options);
+  ASSERT_EQ(sampled.size(), static_cast<size_t>(kRows / 100 + 1));
+  EXPECT_EQ(sampled.back(), last.front());
+}
+
+TEST(TpchSampling, GeneratesOnlySampledRows) {
+  GeneratorOptions options;
+  options.scale_factor = 0.01;
+  options.chunk_size = 500;
+  std::unique_ptr<RecordBatchIterator> orders;
+  ASSERT_TRUE(
+      MakeRecordBatchIterator(SuiteId::kTpch, "orders", options, &orders)
+          .ok());
+  auto counting = std::make_unique<CountingIterator>(std::move(orders));
+  const CountingIterator* counter = counting.get();
+
+  options.sample_mode = SampleMode::kBernoulli;
+  options.sample_fraction = 0.01;
+  std::unique_ptr<RecordBatchIterator> sampled;
+  ASSERT_TRUE(internal::SampledRecordBatchIterator::Make(
+                  std::move(counting), options, 15000, &sampled)
+                  .ok());
+  int64_t rows = 0;
+  std::shared_ptr<arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_TRUE(sampled->Next(&batch).ok());
+    if (batch == nullptr) {
+      break;
+    }
+    rows += batch->num_rows();
+  }
+  EXPECT_GT(rows, 0);
+  EXPECT_EQ(counter->generated_rows(), rows);
+}
+
+TEST(TpchSampling, RejectsInvalidFraction) {
+  GeneratorOptions options;
+  options.sample_mode = SampleMode::kBernoulli;
+  options.sample_fraction = 0.0;
+  std::unique_ptr<RecordBatchIterator> iter;
+  EXPECT_FALSE(
+      MakeRecordBatchIterator(SuiteId::kTpch, "customer", options, &iter)
+          .ok());
+}
+
+}  // namespace benchgen::tpch
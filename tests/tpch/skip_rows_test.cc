@@ -127,4 +127,59 @@ TEST(TpchSkipRows, LineItem) {
   }
 }
 
+TEST(TpchSkipRows, SeekCustomer) {
+  GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.chunk_size = 4;
+
+  CustomerGenerator full_iter(options);
+  ASSERT_TRUE(full_iter.Init().ok());
+  auto all_rows = CollectRows(&full_iter, 30);
+  ASSERT_EQ(all_rows.size(), 30u);
+
+  CustomerGenerator iter(options);
+  ASSERT_TRUE(iter.Init().ok());
+  ASSERT_TRUE(iter.Seek(20, 5).ok());
+  auto forward_rows = CollectRows(&iter, 10);
+  ASSERT_EQ(forward_rows.size(), 5u);
+  for (size_t i = 0; i < forward_rows.size(); ++i) {
+    EXPECT_EQ(forward_rows[i], all_rows[i + 20]);
+  }
+
+  ASSERT_TRUE(iter.Seek(7, 3).ok());
+  auto backward_rows = CollectRows(&iter, 10);
+  ASSERT_EQ(backward_rows.size(), 3u);
+  for (size_t i = 0; i < backward_rows.size(); ++i) {
+    EXPECT_EQ(backward_rows[i], all_rows[i + 7]);
+  }
+
+  ASSERT_TRUE(iter.Seek(iter.total_rows(), -1).ok());
+  EXPECT_TRUE(CollectRows(&iter, 1).empty());
+  EXPECT_FALSE(iter.Seek(-1, 1).ok());
+}
+
+TEST(TpchSkipRows, SeekLineItem) {
+  GeneratorOptions options;
+  options.scale_factor = 1.0;
+  options.chunk_size = 8;
+
+  LineItemGenerator full_iter(options);
+  ASSERT_TRUE(full_iter.Init().ok());
+  auto all_rows = CollectRows(&full_iter, 40);
+  ASSERT_EQ(all_rows.size(), 40u);
+
+  LineItemGenerator iter(options);
+  ASSERT_TRUE(iter.Init().ok());
+  ASSERT_EQ(CollectRows(&iter, 3).size(), 3u);
+  ASSERT_TRUE(iter.Seek(30, 10).ok());
+  auto forward_rows = CollectRows(&iter, 10);
+  ASSERT_EQ(forward_rows.size(), 10u);
+  for (size_t i = 0; i < forward_rows.size(); ++i) {
+    EXPECT_EQ(forward_rows[i], all_rows[i + 30]);
+  }
+
+  ASSERT_TRUE(iter.Seek(0, 40).ok());
+  EXPECT_EQ(CollectRows(&iter, 40), all_rows);
+}
+
 }  // namespace benchgen::tpch
@@ -0,0 +1,59 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "util/thread_affinity.h"
+
+namespace benchgen::tpch {
+
+TEST(ThreadAffinityTest, ParsesCpuLists) {
+  std::vector<int> cpus;
+  ASSERT_TRUE(internal::ParseCpuList("0-3,8,10-11\n", &cpus).ok());
+  EXPECT_EQ(cpus, (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+  ASSERT_TRUE(internal::ParseCpuList("1,0,1", &cpus).ok());
+  EXPECT_EQ(cpus, (std::vector<int>{0, 1}));
+  EXPECT_FALSE(internal::ParseCpuList("3-1", &cpus).ok());
+  EXPECT_FALSE(internal::ParseCpuList("a", &cpus).ok());
+  EXPECT_FALSE(internal::ParseCpuList("1,,2", &cpus).ok());
+}
+
+TEST(ThreadAffinityTest, PlacesWorkersRoundRobinAcrossNodes) {
+  std::vector<internal::NumaNode> nodes(2);
+  nodes[0].id = 0;
+  nodes[0].cpus = {0, 1};
+  nodes[1].id = 1;
+  nodes[1].cpus = {2, 3};
+
+  // Workers alternate nodes; each node hands out its CPUs in order.
+  const int expected_node[] = {0, 1, 0, 1, 0};
+  const int expected_cpu[] = {0, 2, 1, 3, 0};
+  for (int worker = 0; worker < 5; ++worker) {
+    internal::WorkerPlacement pinned =
+        internal::PlaceWorker(nodes, worker, /*pin_cpu=*/true);
+    EXPECT_EQ(pinned.node, expected_node[worker]);
+    EXPECT_EQ(pinned.cpus, std::vector<int>{expected_cpu[worker]});
+  }
+
+  internal::WorkerPlacement node_bound =
+      internal::PlaceWorker(nodes, 3, /*pin_cpu=*/false);
+  EXPECT_EQ(node_bound.node, 1);
+  EXPECT_EQ(node_bound.cpus, (std::vector<int>{2, 3}));
+
+  EXPECT_FALSE(internal::DetectNumaNodes().empty());
+}
+
+}  // namespace benchgen::tpch
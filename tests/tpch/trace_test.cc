@@ -0,0 +1,106 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "util/json.h"
+#include "util/trace.h"
+
+namespace benchgen::tpch {
+
+TEST(TraceTest, SpansRecordOnlyWithinThreadScope) {
+  internal::TraceRecorder recorder("test");
+  internal::TraceBuffer* buffer = recorder.AddThread(1, "worker 0");
+  { internal::TraceSpan span("ignored", "generate"); }
+  EXPECT_TRUE(buffer->events().empty());
+  {
+    internal::TraceBuffer::ThreadScope scope(buffer);
+    internal::TraceSpan span("generate", "generate");
+    span.set_rows(42);
+  }
+  EXPECT_EQ(internal::TraceBuffer::Current(), nullptr);
+  ASSERT_EQ(buffer->events().size(), 1u);
+  EXPECT_STREQ(buffer->events()[0].name, "generate");
+  EXPECT_EQ(buffer->events()[0].rows, 42);
+  EXPECT_GE(buffer->events()[0].duration_ns, 0);
+}
+
+TEST(TraceTest, TracedLockRecordsOnlyContendedWaits) {
+  internal::TraceRecorder recorder("test");
+  internal::TraceBuffer* buffer = recorder.AddThread(1, "worker 0");
+  internal::TraceBuffer::ThreadScope scope(buffer);
+  std::mutex mutex;
+  { auto lock = internal::TracedLock(mutex, "wait"); }
+  EXPECT_TRUE(buffer->events().empty());
+
+  std::unique_lock<std::mutex> held(mutex);
+  std::thread releaser([&held] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    held.unlock();
+  });
+  { auto lock = internal::TracedLock(mutex, "wait"); }
+  releaser.join();
+  ASSERT_EQ(buffer->events().size(), 1u);
+  EXPECT_STREQ(buffer->events()[0].category, "lock");
+  EXPECT_GT(buffer->events()[0].duration_ns, 0);
+}
+
+TEST(TraceTest, WritesChromeTraceJson) {
+  internal::TraceRecorder recorder("benchgen tpch.orders");
+  internal::TraceBuffer* buffer = recorder.AddThread(1, "worker 0");
+  buffer->Add("generate", "generate", 1000, 3500, 10);
+  buffer->Add("write", "write", 3500, 4000);
+  const std::string path =
+      (std::filesystem::temp_directory_path() / "benchgen_trace.json")
+          .string();
+  ASSERT_TRUE(recorder.Write(path).ok());
+  std::ifstream in(path);
+  std::stringstream text;
+  text << in.rdbuf();
+  std::filesystem::remove(path);
+
+  internal::JsonValue root;
+  ASSERT_TRUE(internal::ParseJson(text.str(), &root).ok());
+  const internal::JsonValue* events = root.Find("traceEvents");
+  ASSERT_NE(events, nullptr);
+  int complete = 0;
+  bool named_thread = false;
+  for (const internal::JsonValue& event : events->array_value) {
+    const std::string& phase = event.Find("ph")->string_value;
+    if (phase == "M" && event.Find("name")->string_value == "thread_name") {
+      named_thread =
+          event.Find("args")->Find("name")->string_value == "worker 0";
+    }
+    if (phase == "X") {
+      ++complete;
+      EXPECT_EQ(event.Find("tid")->int_value, 1);
+      if (event.Find("name")->string_value == "generate") {
+        EXPECT_DOUBLE_EQ(event.Find("ts")->number_value, 1.0);
+        EXPECT_DOUBLE_EQ(event.Find("dur")->number_value, 2.5);
+        EXPECT_EQ(event.Find("args")->Find("rows")->int_value, 10);
+      }
+    }
+  }
+  EXPECT_EQ(complete, 2);
+  EXPECT_TRUE(named_thread);
+}
+
+}  // namespace benchgen::tpch